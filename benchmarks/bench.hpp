@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <fmt/core.h>
+
+//* Minimal timing harness for the microbenchmarks, results are printed as nanoseconds per operation
+namespace Bench {
+
+	//* Keep the compiler from optimizing away a computed value
+	template <typename T>
+	inline void keep(T&& value) {
+		asm volatile("" : : "g"(&value) : "memory");
+	}
+
+	//* Run <fn> <rounds> times after one warmup round and return the average duration of a round in nanoseconds
+	template <typename F>
+	double measure(size_t rounds, F&& fn) {
+		fn();
+		const auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < rounds; ++i) fn();
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / static_cast<double>(rounds);
+	}
+
+	//* Print one result row, <ops> is the number of operations done in a single round
+	inline void report(std::string_view name, double round_ns, size_t ops = 1) {
+		fmt::print("{:<40} {:>14.1f} ns/op\n", name, round_ns / static_cast<double>(ops ? ops : 1));
+	}
+
+	//* Print the relative speed of <after> compared to <before>
+	inline void compare(std::string_view name, double before_ns, double after_ns) {
+		fmt::print("{:<40} {:>14.2f}x\n", name, after_ns > 0 ? before_ns / after_ns : 0.0);
+	}
+}
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Listing a /proc like directory with 50k numeric entries through fs::directory_iterator (the previous Proc::collect code path)
+// versus Procfs::dir_lister, which calls getdents64() into a reused buffer and parses names in place.
+
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "bench.hpp"
+#include "linux/procfs.hpp"
+
+namespace fs = std::filesystem;
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50;
+	const size_t entries = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 50'000;
+
+	const auto root = fs::temp_directory_path() / ("mbtop_bench_list_" + std::to_string(getpid()));
+	fs::create_directories(root);
+	for (size_t pid = 1; pid <= entries; pid++) std::ofstream(root / std::to_string(pid));
+	for (const auto* name : {"stat", "meminfo", "self", "sys"}) std::ofstream(root / name);
+
+	const int dir_fd = Procfs::open_dir(root.c_str());
+	if (dir_fd < 0) {
+		fmt::print(stderr, "Failed to open {}\n", root.string());
+		return 1;
+	}
+	fmt::print("{} entries, {} rounds\n", entries, rounds);
+
+	std::vector<size_t> pids;
+	pids.reserve(entries);
+	const double before = Bench::measure(rounds, [&] {
+		pids.clear();
+		for (const auto& d : fs::directory_iterator(root)) {
+			const std::string pid_str = d.path().filename();
+			if (isdigit(pid_str[0])) pids.push_back(std::stoul(pid_str));
+		}
+		Bench::keep(pids);
+	});
+
+	Procfs::dir_lister lister;
+	const double after = Bench::measure(rounds, [&] {
+		pids.clear();
+		lister.numbers(dir_fd, pids);
+		Bench::keep(pids);
+	});
+
+	Bench::report("per entry: directory_iterator", before, entries);
+	Bench::report("per entry: dir_lister", after, entries);
+	Bench::compare("speedup", before, after);
+
+	close(dir_fd);
+	fs::remove_all(root);
+}
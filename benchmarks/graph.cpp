@@ -0,0 +1,446 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Draw::Graph keeps its columns in a ring of precomputed glyph cells and only writes one column per tick,
+// vertical graphs keep the fill of each value and redraw from that. The previous implementation below kept
+// each row as one string and cut the oldest glyph off the front (and for LTR reversed the whole row twice)
+// on every tick, and rebuilt vertical graphs from the raw data. Both are checked for identical output in
+// all four directions before timing them at a few widths.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <ranges>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "bench.hpp"
+#include "mbtop_config.hpp"
+#include "mbtop_draw.hpp"
+#include "mbtop_theme.hpp"
+#include "mbtop_tools.hpp"
+
+using std::clamp;
+using std::deque;
+using std::max;
+using std::round;
+using std::string;
+using std::vector;
+using std::views::iota;
+
+using namespace Tools;
+using namespace std::literals;
+
+namespace {
+	//* Draw::Graph before the ring buffer, kept as it was
+	class LegacyGraph {
+		int width, height;
+		string color_gradient;
+		string out, symbol = "default";
+		bool invert, no_zero;
+		int direction = 0;  //? 0=RTL, 1=LTR, 2=TTB, 3=BTT
+		long long offset;
+		long long last = 0, max_value = 0;
+		bool current = true, tty_mode = false;
+		std::unordered_map<bool, vector<string>> graphs = { {true, {}}, {false, {}}};
+
+		void _create(const deque<long long>& data, int data_offset);
+
+	public:
+		LegacyGraph(int width, int height,
+			const string& color_gradient,
+			const deque<long long>& data,
+			const string& symbol="default",
+			bool invert=false, bool no_zero=false,
+			long long max_value=0, long long offset=0,
+			int direction=0);
+
+		string& operator()(const deque<long long>& data, bool data_same=false);
+	};
+
+	//? Helper to reverse a graph line string for LTR direction
+	//? Handles: Mv::r(1) = 4 bytes, [color][braille] = variable+3, pure braille = 3 bytes, space = 1 byte
+	string reverse_graph_line(const string& line) {
+		if (line.empty()) return line;
+
+		vector<string> units;
+		size_t pos = 0;
+
+		while (pos < line.size()) {
+			if (line[pos] == '\033') {
+				//? Escape sequence - check if cursor move or color
+				if (pos + 3 < line.size() and line[pos + 1] == '[' and line[pos + 3] == 'C') {
+					//? Mv::r(1) = "\033[1C" (4 bytes)
+					units.push_back(line.substr(pos, 4));
+					pos += 4;
+				}
+				else {
+					//? Color code ending in 'm', followed by 3-byte braille
+					size_t m_pos = line.find('m', pos);
+					if (m_pos != string::npos and m_pos + 3 <= line.size()) {
+						units.push_back(line.substr(pos, (m_pos - pos) + 1 + 3));
+						pos = m_pos + 4;
+					}
+					else {
+						//? Malformed - just take rest
+						units.push_back(line.substr(pos));
+						break;
+					}
+				}
+			}
+			else if (line[pos] == ' ') {
+				//? Space padding (1 byte)
+				units.push_back(" ");
+				pos += 1;
+			}
+			else if ((unsigned char)line[pos] >= 0xE2) {
+				//? Pure braille character (3 bytes UTF-8)
+				if (pos + 3 <= line.size()) {
+					units.push_back(line.substr(pos, 3));
+					pos += 3;
+				}
+				else {
+					units.push_back(line.substr(pos));
+					break;
+				}
+			}
+			else {
+				//? Unknown - take single byte
+				units.push_back(line.substr(pos, 1));
+				pos += 1;
+			}
+		}
+
+		//? Reverse and rebuild
+		string result;
+		for (auto it = units.rbegin(); it != units.rend(); ++it) {
+			result += *it;
+		}
+		return result;
+	}
+
+	void LegacyGraph::_create(const deque<long long>& data, int data_offset) {
+		bool mult = (data.size() - data_offset > 1);
+		const auto& graph_symbol = Symbols::graph_symbols.at(symbol + '_' + (invert ? "down" : "up"));
+		array<int, 2> result;
+		const float mod = (height == 1) ? 0.3 : 0.1;
+		long long data_value = 0;
+
+		//? Build index list - same order for both directions
+		//? Both append, LTR reverses output at the end
+		vector<int> indices;
+		for (int i = data_offset; i < (int)data.size(); ++i) indices.push_back(i);
+		if (mult and data_offset > 0) {
+			last = data.at(data_offset - 1);
+			if (max_value > 0) last = clamp((last + offset) * 100 / max_value, 0ll, 100ll);
+		}
+
+		//? Horizontal iteration over values in <data>
+		for (const int& i : indices) {
+			// if (tty_mode and mult and i % 2 != 0) continue;
+			if (not tty_mode and mult) current = not current;
+			if (i < 0) {
+				data_value = 0;
+				last = 0;
+			}
+			else {
+				data_value = data.at(i);
+				if (max_value > 0) data_value = clamp((data_value + offset) * 100 / max_value, 0ll, 100ll);
+			}
+
+			//? Vertical iteration over height of graph
+			for (const int& horizon : iota(0, height)) {
+				const int cur_high = (height > 1) ? round(100.0 * (height - horizon) / height) : 100;
+				const int cur_low = (height > 1) ? round(100.0 * (height - (horizon + 1)) / height) : 0;
+				//? Calculate previous + current value to fit two values in 1 braille character
+				//? RTL: left=last, right=current (newest on right)
+				//? LTR: left=current, right=last (newest on left)
+				//? Held in an array, the backing array of an initializer_list picked by ?: would not outlive the statement
+				const auto value_order = (direction == 0) ? array<long long, 2>{last, data_value}
+				                                          : array<long long, 2>{data_value, last};
+				for (int ai = 0; const auto& value : value_order) {
+					const int clamp_min = (no_zero and horizon == height - 1 and not (mult and i == data_offset and ai == 0)) ? 1 : 0;
+					if (value >= cur_high)
+						result[ai++] = 4;
+					else if (value <= cur_low)
+						result[ai++] = clamp_min;
+					else {
+						result[ai++] = clamp((int)round((float)(value - cur_low) * 4 / (cur_high - cur_low) + mod), clamp_min, 4);
+					}
+				}
+				//? Generate graph symbol from 5x5 2D vector
+				//? RTL: append (newest at end), LTR: prepend (newest at start)
+				if (height == 1) {
+					if (result.at(0) + result.at(1) == 0 and not no_zero) {
+						if (direction == 0)
+							graphs.at(current).at(horizon) += Mv::r(1);
+						else
+							graphs.at(current).at(horizon) = Mv::r(1) + graphs.at(current).at(horizon);
+					}
+					else {
+						if (no_zero and result.at(0) + result.at(1) == 0) result[1] = 1;
+						if (direction == 0) {
+							if (not color_gradient.empty()) graphs.at(current).at(horizon) += Theme::gradients.at(color_gradient).at(clamp(max(last, data_value), 0ll, 100ll));
+							graphs.at(current).at(horizon) += graph_symbol.at((result.at(0) * 5 + result.at(1)));
+						} else {
+							string new_char;
+							if (not color_gradient.empty()) new_char = Theme::gradients.at(color_gradient).at(clamp(max(last, data_value), 0ll, 100ll));
+							new_char += graph_symbol.at((result.at(0) * 5 + result.at(1)));
+							graphs.at(current).at(horizon) = new_char + graphs.at(current).at(horizon);
+						}
+					}
+				}
+				else {
+					if (direction == 0)
+						graphs.at(current).at(horizon) += graph_symbol.at((result.at(0) * 5 + result.at(1)));
+					else
+						graphs.at(current).at(horizon) = graph_symbol.at((result.at(0) * 5 + result.at(1))) + graphs.at(current).at(horizon);
+				}
+			}
+			if (mult and i >= 0) last = data_value;
+		}
+		last = data_value;
+		out.clear();
+
+		//? Vertical graphs (direction 2=TTB, 3=BTT): build horizontal bars from raw data
+		if (direction >= 2) {
+			//? TTB: start at top, move DOWN (Mv::d), newest at top
+			//? BTT: start at bottom, move UP (Mv::u), newest at bottom (exact reverse of TTB)
+			const bool bottom_to_top = (direction == 3);
+			for (int row = 0; row < height; ++row) {
+				if (row > 0) out += (bottom_to_top ? Mv::u(1) : Mv::d(1)) + Mv::l(width);
+
+				//? Get 4 data points for this row - row 0 = newest (at cursor start position)
+				array<long long, 4> row_values = {0, 0, 0, 0};
+				for (int sub = 0; sub < 4; ++sub) {
+					int data_idx = (int)data.size() - 1 - (row * 4 + sub);
+					if (data_idx >= 0 and data_idx < (int)data.size()) {
+						long long val = data.at(data_idx);
+						if (max_value > 0) val = clamp((val + offset) * 100 / max_value, 0ll, 100ll);
+						row_values[sub] = val;
+					}
+				}
+
+				//? Build horizontal bar: each character = 2 horizontal dots (left, right)
+				//? invert=false: fill left→right, invert=true: fill right→left (mirrored)
+				//? Minimum visual: if ANY data in row, first braille char shows all 4 left dots
+				const bool row_has_data = (row_values[0] > 0 or row_values[1] > 0 or
+				                           row_values[2] > 0 or row_values[3] > 0);
+				for (int col = 0; col < width; ++col) {
+					//? For inverted, calculate thresholds from right side
+					int threshold_col = invert ? (width - 1 - col) : col;
+					const int col_mid = (threshold_col * 2 + 1) * 50 / width;
+					const int col_high = (threshold_col + 1) * 100 / width;
+
+					//? Calculate braille pattern: 4 rows, each with 0/1/2 horizontal fill
+					//? Braille dots: 1=0x01, 2=0x02, 3=0x04, 4=0x08, 5=0x10, 6=0x20, 7=0x40, 8=0x80
+					//? TTB: sub 0→top dots, sub 3→bottom dots (normal order)
+					//? BTT: sub 0→bottom dots, sub 3→top dots (reversed order)
+					int pattern = 0x2800;  //? Braille base
+
+					//? First column minimum: if row has any data, fill all 4 dots on starting edge
+					if (threshold_col == 0 and row_has_data) {
+						if (invert)
+							pattern |= 0xB8;  //? dots 4,5,6,8 (right column of braille) for inverted
+						else
+							pattern |= 0x47;  //? dots 1,2,3,7 (left column of braille) for normal
+					}
+
+					for (int sub = 0; sub < 4; ++sub) {
+						const int val = (int)row_values[sub];
+						//? For BTT, reverse dot position: sub 0→3, 1→2, 2→1, 3→0
+						const int dot_pos = bottom_to_top ? (3 - sub) : sub;
+						if (val >= col_high) {
+							//? Full: both dots (left + right)
+							if (dot_pos == 0) pattern |= 0x09;       //? dots 1,4
+							else if (dot_pos == 1) pattern |= 0x12;  //? dots 2,5
+							else if (dot_pos == 2) pattern |= 0x24;  //? dots 3,6
+							else pattern |= 0xC0;                    //? dots 7,8
+						} else if (val >= col_mid) {
+							//? Half: for normal fill left dot, for inverted fill right dot
+							if (not invert) {
+								if (dot_pos == 0) pattern |= 0x01;       //? dot 1
+								else if (dot_pos == 1) pattern |= 0x02;  //? dot 2
+								else if (dot_pos == 2) pattern |= 0x04;  //? dot 3
+								else pattern |= 0x40;                    //? dot 7
+							} else {
+								if (dot_pos == 0) pattern |= 0x08;       //? dot 4
+								else if (dot_pos == 1) pattern |= 0x10;  //? dot 5
+								else if (dot_pos == 2) pattern |= 0x20;  //? dot 6
+								else pattern |= 0x80;                    //? dot 8
+							}
+						}
+					}
+
+					//? Add color gradient based on amplitude (inverted uses opposite direction)
+					if (not color_gradient.empty()) {
+						int grad_val = invert ? ((width - col) * 100 / width) : ((col + 1) * 100 / width);
+						out += Theme::gradients.at(color_gradient).at(clamp(grad_val, 0, 100));
+					}
+
+					//? Always output braille character (even empty ⠀ U+2800 when value is 0)
+					//? UTF-8 for U+2800-U+28FF: E2 [A0-A3] [80-BF]
+					const int dots = pattern & 0xFF;  //? Extract dot pattern (0-255)
+					char utf8[4];
+					utf8[0] = '\xE2';
+					utf8[1] = static_cast<char>(0xA0 + (dots >> 6));     //? A0 for 0-63, A1 for 64-127, A2 for 128-191, A3 for 192-255
+					utf8[2] = static_cast<char>(0x80 + (dots & 0x3F));   //? Lower 6 bits
+					utf8[3] = 0;
+					out += utf8;
+				}
+			}
+			if (not color_gradient.empty()) out += Fx::reset;
+		}
+		//? Horizontal graphs (direction 0=RTL, 1=LTR): use buffer strings
+		else if (height == 1) {
+			out += graphs.at(current).at(0);
+		}
+		else {
+			for (const int& i : iota(1, height + 1)) {
+				if (i > 1) out += Mv::d(1) + Mv::l(width);
+				if (not color_gradient.empty())
+					out += (invert) ? Theme::gradients.at(color_gradient).at(i * 100 / height) : Theme::gradients.at(color_gradient).at(100 - ((i - 1) * 100 / height));
+				out += (invert) ? graphs.at(current).at(height - i) : graphs.at(current).at(i-1);
+			}
+		}
+		if (direction < 2 and not color_gradient.empty()) out += Fx::reset;
+	}
+
+	LegacyGraph::LegacyGraph(int width, int height, const string& color_gradient,
+				 const deque<long long>& data, const string& symbol,
+				 bool invert, bool no_zero, long long max_value, long long offset,
+				 int direction)
+	: width(width), height(height), color_gradient(color_gradient),
+	  invert(invert), no_zero(no_zero), direction(direction), offset(offset) {
+		if (Config::getB("tty_mode") or symbol == "tty") this->symbol = "tty";
+		else if (symbol != "default") this->symbol = symbol;
+		else this->symbol = Config::getS("graph_symbol");
+		if (this->symbol == "tty") tty_mode = true;
+
+		if (max_value == 0 and offset > 0) max_value = 100;
+		this->max_value = max_value;
+
+		const int value_width = (tty_mode ? data.size() : ceil((double)data.size() / 2));
+		int data_offset = (value_width > width) ? data.size() - width * (tty_mode ? 1 : 2) : 0;
+
+		if (not tty_mode and (data.size() - data_offset) % 2 != 0) {
+			data_offset--;
+		}
+
+		//? Populate graph vectors and fill empty space if data size < width
+		//? Both directions use double buffer - same logic, different output position
+		for (const int& i : iota(0, height * 2)) {
+			if (tty_mode and i % 2 != current) continue;
+			graphs[(i % 2 != 0)].push_back((value_width < width) ? ((height == 1) ? Mv::r(1) : " "s) * (width - value_width) : "");
+		}
+		if (data.size() == 0) return;
+		this->_create(data, data_offset);
+	}
+
+	string& LegacyGraph::operator()(const deque<long long>& data, bool data_same) {
+		if (data_same) return out;
+
+		//? Safety check: return empty if Graph wasn't properly initialized
+		if (graphs.empty() or height == 0 or width == 0) return out;
+
+		//? Toggle buffers for smooth animation
+		if (not tty_mode) current = not current;
+
+		//? Make room for new characters on graph
+		//? RTL: remove from start (oldest on left), LTR: remove from end (oldest on right)
+		for (const int& i : iota(0, height)) {
+			auto& graph_line = graphs.at(current).at(i);
+			if (direction == 1) {
+				//? LTR: reverse, apply RTL removal, reverse back
+				graph_line = reverse_graph_line(graph_line);
+			}
+			//? RTL removal logic (also used for reversed LTR)
+			if (height == 1 and graph_line.at(1) == '[') {
+				if (graph_line.at(3) == 'C') graph_line = graph_line.substr(4);
+				else graph_line = graph_line.substr(graph_line.find_first_of('m') + 4);
+			}
+			else if (graph_line.at(0) == ' ') graph_line = graph_line.substr(1);
+			else graph_line = graph_line.substr(3);
+			if (direction == 1) {
+				//? LTR: reverse back
+				graph_line = reverse_graph_line(graph_line);
+			}
+		}
+		this->_create(data, (int)data.size() - 1);
+		return out;
+	}
+
+	struct Case {
+		int width, height;
+		string symbol;
+		bool invert, no_zero, gradient;
+		int direction;
+		size_t initial;
+	};
+
+	//* Feed the same data to both graphs and compare every frame
+	bool same_output(const Case& c, std::mt19937& rng) {
+		std::uniform_int_distribution<long long> percent(0, 100);
+		deque<long long> data;
+		for (size_t i = 0; i < c.initial; ++i) data.push_back(percent(rng));
+		const string gradient = c.gradient ? "cpu" : "";
+		LegacyGraph before(c.width, c.height, gradient, data, c.symbol, c.invert, c.no_zero, 0, 0, c.direction);
+		Draw::Graph after(c.width, c.height, gradient, data, c.symbol, c.invert, c.no_zero, 0, 0, c.direction);
+		for (int tick = 0; tick <= c.width * 3; ++tick) {
+			if (tick > 0) {
+				data.push_back(tick % 7 == 0 ? 0 : percent(rng));
+				if (data.size() > (size_t)c.width * 2 + 10) data.pop_front();
+			}
+			if (before(data, tick == 0) != after(data, tick == 0)) {
+				fmt::print(stderr, "Output differs: width {} height {} symbol {} invert {} no_zero {} gradient {} direction {} initial {} tick {}\n",
+					c.width, c.height, c.symbol, c.invert, c.no_zero, c.gradient, c.direction, c.initial, tick);
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+	Theme::setTheme();
+
+	std::mt19937 rng(1);
+	size_t cases = 0;
+	for (const int width : {1, 4, 13, 40})
+	for (const int height : {1, 2, 5})
+	for (const auto& symbol : {"braille"s, "block"s, "tty"s})
+	for (const int direction : {0, 1, 2, 3})
+	for (const bool invert : {false, true})
+	for (const bool no_zero : {false, true})
+	for (const bool gradient : {false, true})
+	for (const size_t initial : {(size_t)0, (size_t)1, (size_t)width, (size_t)width * 2 - 1, (size_t)width * 3}) {
+		if (not same_output({width, height, symbol, invert, no_zero, gradient, direction, initial}, rng)) return 1;
+		cases++;
+	}
+	fmt::print("{} cases with identical output, {} rounds\n", cases, rounds);
+
+	for (const int direction : {0, 1, 2, 3}) {
+		for (const int width : {50, 100, 200, 400}) {
+			deque<long long> data;
+			for (int i = 0; i < width * 2; ++i) data.push_back(i % 101);
+			LegacyGraph before_graph(width, 8, "cpu", data, "braille", false, false, 0, 0, direction);
+			Draw::Graph after_graph(width, 8, "cpu", data, "braille", false, false, 0, 0, direction);
+
+			auto tick = [&data, n = 0]() mutable {
+				data.pop_front();
+				data.push_back(n++ % 101);
+			};
+			const double before = Bench::measure(rounds, [&] { tick(); Bench::keep(before_graph(data)); });
+			const double after = Bench::measure(rounds, [&] { tick(); Bench::keep(after_graph(data)); });
+
+			const string name = fmt::format("{} width {}", array{"RTL", "LTR", "TTB", "BTT"}[direction], width);
+			Bench::report("tick: string rows, " + name, before);
+			Bench::report("tick: ring, " + name, after);
+			Bench::compare("speedup", before, after);
+		}
+	}
+}
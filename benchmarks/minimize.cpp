@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Term::OutputMinimizer on a full screen frame, what the runner writes every frame with diff_output off.
+// Reports the bytes written with and without it and what the pass costs. The frame is composed from the same boxes,
+// graphs, meters and colored text rows the draw functions write, or read from a file given as the second argument,
+// for example the output of one mbtop frame captured with diff_output = false.
+
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "bench.hpp"
+#include "mbtop_config.hpp"
+#include "mbtop_draw.hpp"
+#include "mbtop_framebuffer.hpp"
+#include "mbtop_theme.hpp"
+#include "mbtop_tools.hpp"
+
+using std::string;
+
+namespace {
+	//* Frame of <width> x <height> with four boxes, each with a graph, meters and a column of process like rows
+	string compose_frame(int width, int height) {
+		const int box_width = width / 2, box_height = height / 2;
+		std::deque<long long> values;
+		for (int i = 0; i < width; ++i) values.push_back((i * 37) % 101);
+
+		string frame = Term::clear + Fx::reset;
+		for (int box = 0; box < 4; ++box) {
+			const int x = 1 + (box % 2) * box_width, y = 1 + (box / 2) * box_height;
+			frame += Draw::createBox(x, y, box_width, box_height, Theme::c("cpu_box"), true, "box", "", box + 1);
+
+			Draw::Graph graph(box_width / 2 - 2, 1, "cpu", values, "braille");
+			Draw::Meter meter(box_width / 2 - 12, "cpu");
+			for (int row = 0; row < box_height - 2; ++row) {
+				graph(values, false);
+				frame += Mv::to(y + 1 + row, x + 1) + Theme::c("main_fg") + Fx::ub + fmt::format("{:<8}", "row" + std::to_string(row))
+					+ Theme::c("inactive_fg") + graph(values, true) + Fx::reset + Mv::to(y + 1 + row, x + box_width / 2)
+					+ Theme::c("main_fg") + Fx::b + meter((row * 13) % 101) + Fx::ub + Theme::c("main_fg") + fmt::format("{:>3}%", (row * 13) % 101);
+			}
+		}
+		return frame + Mv::to(height, width) + Fx::reset;
+	}
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+
+	Config::set("truecolor", true);
+	Theme::setTheme();
+	Term::width = 200;
+	Term::height = 50;
+
+	string frame;
+	if (argc > 2) {
+		std::ifstream file(argv[2], std::ios::binary);
+		frame.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+	else frame = compose_frame(Term::width, Term::height);
+
+	Term::OutputMinimizer minimizer;
+	minimizer.resize(Term::width, Term::height);
+	const string minimized = minimizer.minimize(frame);
+
+	Term::FrameBuffer raw(Term::width, Term::height), replayed(Term::width, Term::height);
+	raw.write(frame);
+	replayed.write(minimized);
+	for (int r = 0; r < raw.height(); ++r) {
+		for (int c = 0; c < raw.width(); ++c) {
+			const auto& want = raw.get(r, c);
+			if (want != replayed.get(r, c) and not (want.len == 1 and want.glyph[0] == ' ' and want.style.bg == replayed.get(r, c).style.bg)) {
+				fmt::print("minimized frame differs at {},{}\n", r, c);
+				return 1;
+			}
+		}
+	}
+	fmt::print("frame of {} bytes, {} after minimizing ({:.1f}%), {} rounds\n", frame.size(), minimized.size(),
+		100.0 * static_cast<double>(minimized.size()) / static_cast<double>(frame.size()), rounds);
+
+	//? The first frame starts from an unknown terminal state, later ones from the state the last one left
+	Bench::report("minimize frame", Bench::measure(rounds, [&] { Bench::keep(minimizer.minimize(frame)); }));
+	Bench::report("minimize frame per byte", Bench::measure(rounds, [&] { Bench::keep(minimizer.minimize(frame)); }), frame.size());
+}
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Full frame Proc::draw with 1,000 visible process rows, then with a mostly idle list where the row cache can reuse
+// rows, once with every row changed between frames and once with nothing changed. Plus the cost of a single theme color lookup through the
+// string keyed map (what Theme::c did before, building a std::string from the literal on every call) versus the
+// compile time resolved slot used by Theme::c now, and the same for a config option read through the string keyed
+// map Config::getB used before versus the option id read from a runner cycle snapshot.
+
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "bench.hpp"
+#include "mbtop_config.hpp"
+#include "mbtop_draw.hpp"
+#include "mbtop_shared.hpp"
+#include "mbtop_theme.hpp"
+#include "mbtop_tools.hpp"
+
+//? Set by Shared::init() in mbtop, Mem::get_totalMem() reads meminfo from here
+namespace Shared {
+	extern std::filesystem::path procPath;
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+	const int rows = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+	Shared::procPath = "/proc";
+	Config::set("shown_boxes", "proc"s);
+	Theme::setTheme();
+	Term::width = 200;
+	Term::height = rows + 2;
+	Draw::calcSizes();
+
+	std::vector<Proc::proc_info> plist(rows * 2);
+	for (size_t i = 0; auto& p : plist) {
+		p.pid = 1000 + i;
+		p.name = "process_" + std::to_string(i % 97);
+		p.cmd = "/usr/bin/" + p.name + " --option value --another-option";
+		p.short_cmd = p.name;
+		p.user = (i % 3 == 0) ? "root" : "user";
+		p.threads = 1 + i % 17;
+		p.mem = (i % 512) << 20;
+		p.cpu_p = (double)(i % 1000) / 10.0;
+		p.cpu_c = p.cpu_p;
+		p.state = 'S';
+		p.ppid = 1;
+		++i;
+	}
+	Proc::numpids = (int)plist.size();
+	fmt::print("{} process rows drawn, {} rounds\n", Proc::select_max, rounds);
+
+	//? Frame buffer reused between frames like the runner does
+	std::string out;
+	auto draw = [&](bool force_redraw) -> const std::string& {
+		out.clear();
+		Proc::draw(out, plist, force_redraw, false);
+		return out;
+	};
+
+	draw(true);
+	const double frame = Bench::measure(rounds, [&] { Bench::keep(draw(false)); });
+	Bench::report("Proc::draw full frame", frame);
+	Bench::report("Proc::draw per row", frame, (size_t)Proc::select_max);
+
+	//? Most processes sit idle, only every tenth one uses cpu and gets a graph
+	for (size_t i = 0; auto& p : plist) {
+		if (i++ % 10 != 0) p.cpu_p = p.cpu_c = 0;
+	}
+	//? Graphs of the processes that went idle are dropped after ten frames
+	draw(true);
+	for (int i = 0; i < 12; ++i) draw(false);
+	const std::string unchanged = draw(false);
+	for (auto& p : plist) p.threads++;
+	draw(false);
+	for (auto& p : plist) p.threads--;
+	if (draw(false) != unchanged or draw(false) != unchanged) {
+		fmt::print("cached rows differ from freshly drawn rows\n");
+		return 1;
+	}
+	size_t tick = 0;
+	const double all_changed = Bench::measure(rounds, [&] {
+		const int step = (tick++ % 2 == 0) ? 1 : -1;
+		for (auto& p : plist) p.threads += step;
+		Bench::keep(draw(false));
+	});
+	const double none_changed = Bench::measure(rounds, [&] { Bench::keep(draw(false)); });
+	Bench::report("idle list, every row changed", all_changed);
+	Bench::report("idle list, no row changed", none_changed);
+	Bench::compare("speedup", all_changed, none_changed);
+
+	constexpr size_t lookups = 100'000;
+	const double by_name = Bench::measure(rounds, [&] {
+		for (size_t i = 0; i < lookups; ++i) Bench::keep(Theme::colors.at("inactive_fg"));
+	});
+	const double by_slot = Bench::measure(rounds, [&] {
+		for (size_t i = 0; i < lookups; ++i) Bench::keep(Theme::c("inactive_fg"));
+	});
+	Bench::report("color lookup: string key", by_name, lookups);
+	Bench::report("color lookup: slot", by_slot, lookups);
+	Bench::compare("speedup", by_name, by_slot);
+
+	std::unordered_map<std::string_view, bool> legacy_bools;
+	for (const auto& [name, value] : Config::bool_options) legacy_bools.emplace(name, value);
+	const double option_by_name = Bench::measure(rounds, [&] {
+		for (size_t i = 0; i < lookups; ++i) Bench::keep(legacy_bools.at("proc_colors"));
+	});
+	Config::publish();
+	Config::cycle_view view(Config::acquire());
+	const double option_by_id = Bench::measure(rounds, [&] {
+		for (size_t i = 0; i < lookups; ++i) Bench::keep(Config::getB("proc_colors"));
+	});
+	Bench::report("option lookup: string key", option_by_name, lookups);
+	Bench::report("option lookup: snapshot id", option_by_id, lookups);
+	Bench::compare("speedup", option_by_name, option_by_id);
+}
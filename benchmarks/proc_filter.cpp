@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Filtering a list of 20,000 processes the way collect() does on every update and on every key typed into the filter,
+// with the old per call matching (a std::regex compiled per process, std::to_string of every pid) against the
+// compiled filter_matcher and the per pid filter_cache.
+
+#include <cstdlib>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "mbtop_shared.hpp"
+#include "mbtop_tools.hpp"
+
+using std::string;
+
+namespace {
+	bool legacy_matches(const Proc::proc_info& proc, const string& filter) {
+		if (filter.starts_with("!")) {
+			if (filter.size() == 1) return true;
+			try {
+				std::regex regex { filter.substr(1), std::regex::extended };
+				return std::regex_search(std::to_string(proc.pid), regex) || std::regex_search(proc.name.str(), regex) ||
+					std::regex_match(proc.cmd.str(), regex) || std::regex_search(proc.user.str(), regex);
+			} catch (std::regex_error&) {
+				return false;
+			}
+		}
+		return std::to_string(proc.pid).contains(filter) || Tools::s_contains_ic(proc.name, filter) ||
+			Tools::s_contains_ic(proc.cmd, filter) || Tools::s_contains_ic(proc.user, filter);
+	}
+
+	std::vector<Proc::proc_info> make_processes(size_t count) {
+		static const char* names[] = {"bash", "sshd", "nginx", "postgres", "python3", "node", "java", "kworker/3:2", "chrome", "systemd-journald"};
+		static const char* users[] = {"root", "www-data", "postgres", "alice", "bob"};
+		std::vector<Proc::proc_info> procs;
+		procs.reserve(count);
+		for (size_t i = 0; i < count; ++i) {
+			Proc::proc_info p{1000 + i * 3};
+			p.name = names[(i * 7) % 10];
+			p.cmd = "/usr/bin/" + p.name + " --config /etc/" + p.name + "/worker-" + std::to_string(i % 97) + ".conf --log-level info";
+			p.user = users[(i * 11) % 5];
+			p.cpu_s = i;
+			procs.push_back(std::move(p));
+		}
+		return procs;
+	}
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20;
+	const auto procs = make_processes(20000);
+	fmt::print("{} processes, {} rounds\n", procs.size(), rounds);
+
+	const auto legacy_pass = [&](const string& filter) {
+		size_t found = 0;
+		for (const auto& p : procs) found += legacy_matches(p, filter);
+		return found;
+	};
+	const auto compiled_pass = [&](const string& filter) {
+		const Proc::filter_matcher matcher(filter);
+		size_t found = 0;
+		for (const auto& p : procs) found += matcher.matches(p);
+		return found;
+	};
+	Proc::filter_cache cache;
+	const auto cached_pass = [&](const string& filter) {
+		cache.set_filter(filter);
+		size_t found = 0;
+		for (const auto& p : procs) found += cache.matches(p);
+		return found;
+	};
+
+	for (const string filter : {"worker-42", "!^/usr/bin/py.*info$"}) {
+		if (legacy_pass(filter) != compiled_pass(filter) or legacy_pass(filter) != cached_pass(filter)) {
+			fmt::print("results differ for {}\n", filter);
+			return 1;
+		}
+		const double legacy = Bench::measure(rounds, [&] { Bench::keep(legacy_pass(filter)); });
+		const double compiled = Bench::measure(rounds, [&] { Bench::keep(compiled_pass(filter)); });
+		const double cached = Bench::measure(rounds, [&] { Bench::keep(cached_pass(filter)); });
+		Bench::report(fmt::format("'{}': per call", filter), legacy, procs.size());
+		Bench::report(fmt::format("'{}': compiled", filter), compiled, procs.size());
+		Bench::report(fmt::format("'{}': cached", filter), cached, procs.size());
+		Bench::compare("compiled speedup", legacy, compiled);
+	}
+
+	//? Typing a filter, every key filters the whole list again
+	const std::vector<string> typed = {"p", "po", "pos", "post", "postg", "postgr", "postgre", "postgres"};
+	const double legacy_typing = Bench::measure(rounds, [&] { for (const auto& f : typed) Bench::keep(legacy_pass(f)); });
+	const double cached_typing = Bench::measure(rounds, [&] {
+		cache.set_filter("");
+		for (const auto& f : typed) Bench::keep(cached_pass(f));
+	});
+	Bench::report("typing 'postgres': per call, per key", legacy_typing, typed.size());
+	Bench::report("typing 'postgres': cached, per key", cached_typing, typed.size());
+	Bench::compare("typing speedup", legacy_typing, cached_typing);
+}
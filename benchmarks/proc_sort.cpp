@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Sorting the process list on every update at different process counts, the whole list against only the rows up to a
+// page past the visible window the way the Linux collector does. Between rounds the cpu usage of a tenth of the
+// processes changes, so each round starts from the order of the last one like it does live.
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "mbtop_shared.hpp"
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20;
+	const size_t window = 100;
+	fmt::print("{} rounds, {} rows in order for the window\n", rounds, window);
+
+	for (const size_t count : {1'000, 10'000, 50'000, 200'000}) {
+		std::vector<Proc::proc_info> procs(count);
+		for (size_t i = 0; i < count; ++i) {
+			procs[i].pid = 1 + i;
+			procs[i].cpu_p = static_cast<double>((i * 7919) % 1000) / 10.0;
+			procs[i].mem = (i * 104729) % 4'000'000'000;
+		}
+		size_t tick = 0;
+		const auto update = [&](auto& list) {
+			++tick;
+			for (auto& p : list) {
+				if (p.pid % 10 == tick % 10) p.cpu_p = static_cast<double>((p.pid * 31 + tick * 17) % 1000) / 10.0;
+			}
+		};
+
+		auto full = procs, visible = procs;
+		const double by_full = Bench::measure(rounds, [&] {
+			update(full);
+			Bench::keep(Proc::proc_sorter(full, "cpu direct", false));
+		});
+		tick = 0;
+		const double by_window = Bench::measure(rounds, [&] {
+			update(visible);
+			Bench::keep(Proc::proc_sorter(visible, "cpu direct", false, false, window));
+		});
+		//? Equal values keep their previous order, which differs between the two lists after the first round
+		for (size_t i = 0; i < window; ++i) {
+			if (full[i].cpu_p != visible[i].cpu_p) {
+				fmt::print("window differs from the full sort at {} for {} processes\n", i, count);
+				return 1;
+			}
+		}
+		Bench::report(fmt::format("sort {}: whole list", count), by_full);
+		Bench::report(fmt::format("sort {}: visible window", count), by_window);
+		Bench::compare("speedup", by_full, by_window);
+	}
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// The process table at 50,000 processes, a host running many containers of the same few services. Compares the heap
+// used and the time to sort it with the process names, commands and users as plain strings in every proc_info and
+// sorted with a stable_sort of the whole structs, against the interned strings and the key column sort of proc_sorter.
+
+#include <algorithm>
+#include <cstdlib>
+#include <malloc.h>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "mbtop_shared.hpp"
+
+using std::string;
+
+namespace {
+	//* proc_info as it was before names, commands and users were interned
+	struct legacy_proc_info {
+		size_t pid{};
+		string name{}, cmd{}, short_cmd{};
+		size_t threads{};
+		string user{};
+		uint64_t mem{};
+		double cpu_p{}, cpu_c{}, gpu_p{};
+		char state = '0';
+		int64_t p_nice{};
+		int p_priority{};
+		uint64_t ppid{}, cpu_s{}, cpu_t{}, death_time{}, io_read{}, io_write{};
+		string prefix{};
+		size_t depth{}, tree_index{};
+		bool collapsed{}, filtered{};
+		uint32_t ports{};
+		uint64_t virt_mem{}, res_mem{}, shared_mem{}, send_bytes{}, recv_bytes{}, gpu_time{}, runtime{};
+	};
+
+	//* Bytes allocated, large blocks like the process vectors are mapped separately
+	size_t heap_in_use() {
+		const auto info = mallinfo2();
+		return info.uordblks + info.hblkhd;
+	}
+
+	//* Fill in process <i>, <T> is proc_info or legacy_proc_info
+	template <typename T>
+	void describe(T& p, size_t i) {
+		static const char* services[] = {"php-fpm", "postgres", "python3", "node", "nginx", "java", "redis-server", "sidekiq"};
+		static const char* users[] = {"www-data", "postgres", "app", "root", "redis"};
+		const string service = services[(i * 7) % 8];
+		p.name = service;
+		//? The same few commands per service, one per worker pool or database
+		p.cmd = "/usr/local/bin/" + service + " --config /etc/" + service + "/pool-" + std::to_string(i % 12) + ".conf --workers 8";
+		p.user = users[(i * 11) % 5];
+		p.cpu_p = static_cast<double>((i * 7919) % 1000) / 10.0;
+		p.mem = (i * 104729) % 4'000'000'000;
+		p.threads = i % 64;
+	}
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20;
+	const size_t count = 50'000;
+
+	size_t base = heap_in_use();
+	std::vector<legacy_proc_info> legacy(count);
+	for (size_t i = 0; i < count; ++i) {
+		legacy[i].pid = 1000 + i;
+		describe(legacy[i], i);
+	}
+	const size_t legacy_heap = heap_in_use() - base;
+
+	base = heap_in_use();
+	std::vector<Proc::proc_info> procs(count);
+	for (size_t i = 0; i < count; ++i) {
+		procs[i].pid = 1000 + i;
+		describe(procs[i], i);
+	}
+	const size_t interned_heap = heap_in_use() - base;
+
+	fmt::print("{} processes, {} rounds, proc_info {} bytes, before {} bytes\n", count, rounds, sizeof(Proc::proc_info), sizeof(legacy_proc_info));
+	fmt::print("{:<40} {:>14.1f} MiB\n", "heap: strings per process", static_cast<double>(legacy_heap) / (1 << 20));
+	fmt::print("{:<40} {:>14.1f} MiB\n", "heap: interned", static_cast<double>(interned_heap) / (1 << 20));
+	fmt::print("{:<40} {:>14}\n", "interned strings", Tools::interned_string::pool_size());
+
+	//? Every round sorts by cpu and then by name, the list goes back and forth between two orders like it does live
+	const double legacy_sort = Bench::measure(rounds, [&] {
+		std::ranges::stable_sort(legacy, std::ranges::greater{}, &legacy_proc_info::cpu_p);
+		std::ranges::stable_sort(legacy, std::ranges::less{}, &legacy_proc_info::name);
+	});
+	const double key_sort = Bench::measure(rounds, [&] {
+		Proc::proc_sorter(procs, "cpu direct", false, false);
+		Proc::proc_sorter(procs, "name", false, false);
+	});
+	for (size_t i = 0; i < count; ++i) {
+		if (legacy[i].pid != procs[i].pid) {
+			fmt::print("orders differ at {}\n", i);
+			return 1;
+		}
+	}
+	Bench::report("sort 50k: stable_sort of structs", legacy_sort);
+	Bench::report("sort 50k: key column", key_sort);
+	Bench::compare("speedup", legacy_sort, key_sort);
+}
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Building the process tree on every update at different process counts, the recursive tree of references it used to
+// be against tree_builder. Each process has a parent picked from the processes before it, plus one chain as deep as a
+// long pipeline of shells, and the list goes in sorted by cpu like proc_sorter leaves it.
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "mbtop_shared.hpp"
+
+namespace rng = std::ranges;
+using Proc::proc_info;
+
+namespace Legacy {
+	struct tree_proc {
+		std::reference_wrapper<proc_info> entry;
+		std::vector<tree_proc> children;
+	};
+
+	//? Without filtering and collapsing, neither is used here
+	void tree_gen(proc_info& cur_proc, std::vector<proc_info>& in_procs, std::vector<tree_proc>& out_procs, int cur_depth) {
+		cur_proc.depth = cur_depth;
+		out_procs.push_back({cur_proc, {}});
+		for (auto& p : rng::equal_range(in_procs, cur_proc.pid, rng::less{}, &proc_info::ppid)) {
+			tree_gen(p, in_procs, out_procs.back().children, cur_depth + 1);
+		}
+	}
+
+	void tree_sort(std::vector<tree_proc>& proc_vec, int& c_index) {
+		rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().cpu_p > b.entry.get().cpu_p; });
+		for (auto& r : proc_vec) {
+			r.entry.get().tree_index = c_index++;
+			if (not r.children.empty()) tree_sort(r.children, c_index);
+		}
+	}
+
+	void collect_prefixes(tree_proc& t, const bool is_last, const std::string& header = "") {
+		if (not t.children.empty()) t.entry.get().prefix = header + "[-]─";
+		else t.entry.get().prefix = header + (is_last ? " └─" : " ├─");
+		for (auto child = t.children.begin(); child != t.children.end(); ++child) {
+			collect_prefixes(*child, child == (t.children.end() - 1), header + (is_last ? "   " : " │ "));
+		}
+	}
+
+	void build(std::vector<proc_info>& procs) {
+		std::vector<tree_proc> tree_procs;
+		tree_procs.reserve(procs.size());
+		rng::stable_sort(procs, rng::less{}, &proc_info::ppid);
+		for (auto& p : rng::equal_range(procs, procs.at(0).ppid, rng::less{}, &proc_info::ppid)) tree_gen(p, procs, tree_procs, 0);
+		int index = 0;
+		tree_sort(tree_procs, index);
+		for (auto t = tree_procs.begin(); t != tree_procs.end(); ++t) collect_prefixes(*t, t == tree_procs.end() - 1);
+		rng::stable_sort(procs, rng::less{}, &proc_info::tree_index);
+	}
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20;
+	const size_t chain = 200;
+	fmt::print("{} rounds, chain of {} processes\n", rounds, chain);
+
+	for (const size_t count : {1'000, 10'000, 50'000}) {
+		std::vector<proc_info> procs(count);
+		for (size_t i = 0; i < count; ++i) {
+			procs[i].pid = 1 + i;
+			procs[i].ppid = i == 0 ? 0 : i >= count - chain ? i : 1 + (i * 7919) % i;
+			procs[i].cpu_p = static_cast<double>((i * 104729) % 1000) / 10.0;
+			procs[i].cmd = "/usr/bin/worker --id " + std::to_string(i);
+		}
+		Proc::proc_sorter(procs, "cpu direct", false);
+
+		//? The same list every round, as if nothing changed since the last update
+		auto recursive = procs, iterative = procs;
+		const double by_recursion = Bench::measure(rounds, [&] {
+			Legacy::build(recursive);
+			Bench::keep(recursive.front().tree_index);
+		});
+		Proc::tree_builder tree;
+		const double by_builder = Bench::measure(rounds, [&] {
+			tree.build(iterative, "cpu direct", false, false, "", true, false);
+			Bench::keep(iterative.front().tree_index);
+		});
+		for (size_t i = 0; i < count; ++i) {
+			if (recursive[i].pid != iterative[i].pid or recursive[i].prefix != iterative[i].prefix) {
+				fmt::print("trees differ at row {}\n", i);
+				return 1;
+			}
+		}
+		Bench::report(fmt::format("{:>6} procs: recursive", count), by_recursion);
+		Bench::report(fmt::format("{:>6} procs: tree_builder", count), by_builder);
+		Bench::compare("speedup", by_recursion, by_builder);
+	}
+}
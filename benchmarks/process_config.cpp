@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Config::find_process_config for every row of a process list, what Proc::draw does on each frame, with a few
+// hundred tagged workers. Compares the linear scan with a regex built for every wildcard it replaced, the index
+// grouped by name and the per process resolution used by the runner.
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench.hpp"
+#include "mbtop_config.hpp"
+
+using std::string;
+
+namespace {
+	const Config::ProcessLogConfig* legacy_find(const string& name, const string& cmdline) {
+		const Config::ProcessLogConfig* best = nullptr;
+		int best_specificity = 0;
+		for (const auto& cfg : Config::logging.processes) {
+			if (cfg.name != name or cfg.command.empty()) continue;
+			bool matched = false, exact = false;
+			if (cfg.compiled_pattern.has_value()) matched = std::regex_search(cmdline, *cfg.compiled_pattern);
+			else if (cfg.command.find('*') != string::npos) {
+				string regex_str;
+				for (char c : cfg.command) {
+					if (c == '*') regex_str += ".*";
+					else if (string(".?+[](){}^$|\\").find(c) != string::npos) regex_str += {'\\', c};
+					else regex_str += c;
+				}
+				matched = std::regex_match(cmdline, std::regex(regex_str));
+			}
+			else matched = exact = cfg.command == cmdline;
+			if (not matched) continue;
+			const int specificity = exact ? INT_MAX : static_cast<int>(cfg.command.size() - std::ranges::count(cfg.command, '*'));
+			if (best == nullptr or specificity > best_specificity) {
+				best = &cfg;
+				best_specificity = specificity;
+			}
+		}
+		return best;
+	}
+
+	//* Config with every field set, the ones not given empty
+	Config::ProcessLogConfig process_config(const string& name, const string& command, const string& pattern = "", const string& display_name = "",
+											bool tagged = false, const string& tag_color = "") {
+		return {.name = name, .command = command, .command_pattern = pattern, .log_path = "", .display_name = display_name,
+				.tagged = tagged, .tag_color = tag_color, .compiled_pattern = std::nullopt};
+	}
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50;
+	const size_t workers = 300, rows = 2000;
+
+	//? One wildcard and one exact rule per worker queue, a few catch all rules and a regex
+	for (size_t i = 0; i < workers; ++i) {
+		Config::save_process_config(process_config("python3", "python3 -m celery worker -Q queue" + std::to_string(i) + " *", "", "", true, "hi_fg"));
+		Config::save_process_config(process_config("python3", "python3 /srv/job" + std::to_string(i) + ".py", "", "job" + std::to_string(i)));
+	}
+	Config::save_process_config(process_config("python3", "python3 *"));
+	Config::save_process_config(process_config("node", "node", "--inspect(=\\d+)?"));
+	Config::save_process_config(process_config("bash", "*"));
+
+	std::vector<std::pair<string, string>> processes;
+	for (size_t i = 0; i < rows; ++i) {
+		if (i % 4 == 0) processes.emplace_back("python3", "python3 -m celery worker -Q queue" + std::to_string(i % workers) + " --concurrency 4");
+		else if (i % 4 == 1) processes.emplace_back("python3", "python3 /srv/job" + std::to_string(i % workers) + ".py");
+		else if (i % 4 == 2) processes.emplace_back("node", "node --inspect=9229 server.js");
+		else processes.emplace_back("kworker/" + std::to_string(i), "");
+	}
+
+	for (size_t i = 0; i < rows; ++i) {
+		const auto& [name, cmdline] = processes[i];
+		const auto* want = legacy_find(name, cmdline);
+		const auto* got = Config::find_process_config(i, 1, name, cmdline);
+		if ((want == nullptr) != (got == nullptr) or (want != nullptr and want->command != got->command)) {
+			fmt::print("result differs from the linear scan for {}\n", cmdline);
+			return 1;
+		}
+	}
+	fmt::print("{} configs, {} processes, {} rounds\n", Config::logging.processes.size(), rows, rounds);
+
+	const double by_scan = Bench::measure(rounds, [&] {
+		for (const auto& [name, cmdline] : processes) Bench::keep(legacy_find(name, cmdline));
+	});
+	const double by_index = Bench::measure(rounds, [&] {
+		for (const auto& [name, cmdline] : processes) Bench::keep(Config::find_process_config(name, cmdline));
+	});
+	const double by_pid = Bench::measure(rounds, [&] {
+		for (size_t i = 0; i < rows; ++i) Bench::keep(Config::find_process_config(i, 1, processes[i].first, processes[i].second));
+	});
+	Bench::report("process config: linear scan", by_scan, rows);
+	Bench::report("process config: index", by_index, rows);
+	Bench::report("process config: per process", by_pid, rows);
+	Bench::compare("speedup index", by_scan, by_index);
+	Bench::compare("speedup per process", by_scan, by_pid);
+}
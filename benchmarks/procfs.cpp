@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Per-PID cost of reading comm, cmdline, status, stat and statm with ifstream (the previous Proc::collect code path)
+// versus the Procfs openat()/per-thread buffer readers, and Procfs::sample_all() on one thread versus a worker pool.
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "linux/procfs.hpp"
+#include "mbtop_tools.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+	constexpr auto SSmax = std::numeric_limits<std::streamsize>::max();
+
+	struct sample {
+		std::string name, cmd, uid;
+		char state{};
+		uint64_t ppid{}, cpu_t{}, threads{}, starttime{}, mem{};
+	};
+
+	//? Mirrors the ifstream based parsing that Proc::collect used before the Procfs layer
+	bool legacy(const fs::path& dir, sample& s) {
+		std::ifstream pread;
+		std::string long_string, short_str;
+
+		pread.open(dir / "comm");
+		if (not pread.good()) return false;
+		getline(pread, s.name);
+		pread.close();
+		const auto offset = std::count(s.name.begin(), s.name.end(), ' ');
+
+		pread.open(dir / "cmdline");
+		if (not pread.good()) return false;
+		s.cmd.clear();
+		while (getline(pread, long_string, '\0')) s.cmd += long_string + ' ';
+		pread.close();
+
+		pread.open(dir / "status");
+		if (not pread.good()) return false;
+		std::string line;
+		while (pread.good()) {
+			getline(pread, line, ':');
+			if (line == "Uid") {
+				pread.ignore();
+				getline(pread, s.uid, '\t');
+				break;
+			}
+			pread.ignore(SSmax, '\n');
+		}
+		pread.close();
+
+		pread.open(dir / "stat");
+		if (not pread.good()) return false;
+		int x = 0;
+		try {
+			for (int next_x : {3, 4, 14, 15, 20, 22, 24}) {
+				while (pread.good() and ++x < next_x + offset) pread.ignore(SSmax, ' ');
+				if (not pread.good()) return false;
+				getline(pread, short_str, ' ');
+				switch (next_x) {
+					case 3: s.state = short_str.at(0); break;
+					case 4: s.ppid = stoull(short_str); break;
+					case 14: s.cpu_t = stoull(short_str); break;
+					case 15: s.cpu_t += stoull(short_str); break;
+					case 20: s.threads = stoull(short_str); break;
+					case 22: s.starttime = stoull(short_str); break;
+					case 24: s.mem = stoull(short_str); break;
+				}
+			}
+		}
+		catch (const std::exception&) { return false; }
+		pread.close();
+
+		pread.open(dir / "statm");
+		if (not pread.good()) return false;
+		pread.ignore(SSmax, ' ');
+		pread >> s.mem;
+		return true;
+	}
+
+	bool procfs(int proc_fd, size_t pid, sample& s) {
+		auto comm = Procfs::read_pid(proc_fd, pid, "comm");
+		if (not comm) return false;
+		s.name.assign(comm->substr(0, comm->find('\n')));
+
+		auto cmdline = Procfs::read_pid(proc_fd, pid, "cmdline");
+		if (not cmdline) return false;
+		Procfs::cmdline_to(*cmdline, s.cmd);
+
+		auto status = Procfs::read_pid(proc_fd, pid, "status");
+		if (not status) return false;
+		s.uid.assign(Procfs::find_key(*status, "Uid"));
+
+		Procfs::stat_fields stat;
+		auto stat_buf = Procfs::read_pid(proc_fd, pid, "stat");
+		if (not stat_buf or not Procfs::parse_stat(*stat_buf, stat)) return false;
+		s.state = stat.state;
+		s.ppid = stat.ppid;
+		s.cpu_t = stat.utime + stat.stime;
+		s.threads = stat.threads;
+		s.starttime = stat.starttime;
+
+		auto statm = Procfs::read_pid(proc_fd, pid, "statm");
+		if (not statm) return false;
+		s.mem = Procfs::parse_statm_resident(*statm).value_or(0);
+		return true;
+	}
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20;
+	const size_t threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 4;
+
+	std::vector<size_t> pids;
+	for (const auto& d : fs::directory_iterator("/proc")) {
+		const auto name = d.path().filename().string();
+		if (isdigit(name[0])) pids.push_back(std::stoul(name));
+	}
+	if (pids.empty() or not Procfs::init("/proc")) {
+		fmt::print(stderr, "No processes found in /proc\n");
+		return 1;
+	}
+
+	fmt::print("{} pids, {} rounds\n", pids.size(), rounds);
+	sample s;
+
+	const double before = Bench::measure(rounds, [&] {
+		for (const auto pid : pids) Bench::keep(legacy(fs::path("/proc") / std::to_string(pid), s));
+	});
+	const double after = Bench::measure(rounds, [&] {
+		for (const auto pid : pids) Bench::keep(procfs(Procfs::root(), pid, s));
+	});
+
+	Bench::report("per pid: ifstream", before, pids.size());
+	Bench::report("per pid: procfs", after, pids.size());
+	Bench::compare("speedup", before, after);
+
+	//? Sharding only kicks in above 256 pids per shard, repeat the pid list to get there on small systems
+	std::vector<Procfs::pid_sample> samples;
+	while (samples.size() < 256 * (threads + 1))
+		for (const auto pid : pids) {
+			samples.emplace_back().pid = pid;
+			samples.back().with_names = true;
+		}
+
+	Tools::WorkerPool pool(threads > 0 ? threads - 1 : 0);
+	const double serial = Bench::measure(rounds, [&] { Procfs::sample_all(Procfs::root(), samples, -1, nullptr); });
+	const double sharded = Bench::measure(rounds, [&] { Procfs::sample_all(Procfs::root(), samples, -1, &pool); });
+
+	Bench::report("sample_all: 1 thread", serial, samples.size());
+	Bench::report(fmt::format("sample_all: {} threads", threads), sharded, samples.size());
+	Bench::compare("speedup", serial, sharded);
+}
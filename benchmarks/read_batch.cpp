@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Cost of one update's worth of small /proc and /sys reads (stat, net counters, disk stats, hwmon, cpufreq)
+// with Tools::readfile() versus Procfs::read_batch with pread() and with io_uring.
+
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "bench.hpp"
+#include "linux/read_batch.hpp"
+#include "mbtop_tools.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+	void add_glob(std::vector<std::string>& out, const fs::path& dir, std::string_view prefix, std::string_view file) {
+		std::error_code ec;
+		for (const auto& entry : fs::directory_iterator(dir, ec)) {
+			if (not entry.path().filename().string().starts_with(prefix)) continue;
+			const auto path = entry.path() / file;
+			if (fs::exists(path, ec)) out.push_back(path.string());
+		}
+	}
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+
+	std::vector<std::string> paths = {"/proc/stat"};
+	add_glob(paths, "/sys/class/net", "", "statistics/rx_bytes");
+	add_glob(paths, "/sys/class/net", "", "statistics/tx_bytes");
+	add_glob(paths, "/sys/block", "", "stat");
+	add_glob(paths, "/sys/devices/system/cpu/cpufreq", "policy", "scaling_cur_freq");
+	add_glob(paths, "/sys/class/hwmon", "hwmon", "temp1_input");
+
+	fmt::print("{} files, {} rounds, io_uring {}\n", paths.size(), rounds,
+		Procfs::read_batch::uring_supported() ? "available" : "unavailable");
+
+	const double readfile = Bench::measure(rounds, [&] {
+		for (const auto& path : paths) Bench::keep(Tools::readfile(path, "0"));
+	});
+
+	Procfs::read_batch pread_batch, uring_batch;
+	const double pread = Bench::measure(rounds, [&] {
+		pread_batch.run(false);
+		for (const auto& path : paths) Bench::keep(pread_batch.read(path));
+	});
+	const double uring = Bench::measure(rounds, [&] {
+		uring_batch.run(true);
+		for (const auto& path : paths) Bench::keep(uring_batch.read(path));
+	});
+
+	Bench::report("update: readfile", readfile);
+	Bench::report(fmt::format("update: read_batch pread ({} sc)", pread_batch.last_syscall_count()), pread);
+	Bench::report(fmt::format("update: read_batch io_uring ({} sc)", uring_batch.last_syscall_count()), uring);
+	Bench::compare("pread speedup", readfile, pread);
+	Bench::compare("io_uring speedup", readfile, uring);
+}
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Fx::uncolor on a full screen frame, what the runner does to the whole output whenever a menu or overlay is shown,
+// with the escape scanner versus the std::regex_replace it replaced. The frame is composed from the same boxes,
+// graphs, meters and colored text rows the draw functions write, or read from a file given as the second argument,
+// for example the output of one mbtop frame captured with diff_output = false.
+
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <string>
+
+#include "bench.hpp"
+#include "mbtop_config.hpp"
+#include "mbtop_draw.hpp"
+#include "mbtop_theme.hpp"
+#include "mbtop_tools.hpp"
+
+using std::string;
+
+namespace {
+	//* Frame of <width> x <height> with four boxes, each with a graph, meters and a column of colored text rows
+	string compose_frame(int width, int height) {
+		const int box_width = width / 2, box_height = height / 2;
+		std::deque<long long> values;
+		for (int i = 0; i < width; ++i) values.push_back((i * 37) % 101);
+
+		string frame = Term::clear + Fx::reset;
+		for (int box = 0; box < 4; ++box) {
+			const int x = 1 + (box % 2) * box_width, y = 1 + (box / 2) * box_height;
+			frame += Draw::createBox(x, y, box_width, box_height, Theme::c("cpu_box"), true, "box", "", box + 1);
+
+			Draw::Graph graph(box_width / 2 - 2, box_height / 2, "cpu", values, "braille");
+			for (int tick = 0; tick < 3; ++tick) graph(values, false);
+			frame += Mv::to(y + 1, x + 1) + graph(values, true);
+
+			Draw::Meter meter(box_width / 2 - 12, "cpu");
+			for (int row = 0; row < box_height - 2; ++row) {
+				frame += Mv::to(y + 1 + row, x + box_width / 2) + Theme::c("main_fg") + Fx::b + fmt::format("{:<8}", "row" + std::to_string(row))
+					+ Fx::ub + meter((row * 13) % 101) + Theme::c("inactive_fg") + fmt::format("{:>3}%", (row * 13) % 101);
+			}
+		}
+		return frame + Mv::to(height, width) + Fx::reset;
+	}
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+
+	Config::set("truecolor", true);
+	Theme::setTheme();
+	Term::width = 200;
+	Term::height = 50;
+
+	string frame;
+	if (argc > 2) {
+		std::ifstream file(argv[2], std::ios::binary);
+		frame.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+	else frame = compose_frame(Term::width, Term::height);
+
+	const std::regex color_regex("\033\\[\\d+;?\\d?;?\\d*;?\\d*;?\\d*(m){1}");
+	const std::regex escape_regex("\033\\[\\d+;?\\d?;?\\d*;?\\d*;?\\d*(m|f|s|u|C|D|A|B){1}");
+	if (Fx::uncolor(frame) != std::regex_replace(frame, color_regex, "") or Fx::unescape(frame) != std::regex_replace(frame, escape_regex, "")) {
+		fmt::print("output differs from the regex\n");
+		return 1;
+	}
+	fmt::print("frame of {} bytes, {} left after uncolor, {} rounds\n", frame.size(), Fx::uncolor(frame).size(), rounds);
+
+	const double by_regex = Bench::measure(rounds, [&] { Bench::keep(std::regex_replace(frame, color_regex, "")); });
+	const double by_scanner = Bench::measure(rounds, [&] { Bench::keep(Fx::uncolor(frame)); });
+	Bench::report("uncolor frame: regex", by_regex);
+	Bench::report("uncolor frame: scanner", by_scanner);
+	Bench::compare("speedup", by_regex, by_scanner);
+
+	const double strip_regex = Bench::measure(rounds, [&] { Bench::keep(std::regex_replace(frame, escape_regex, "")); });
+	const double strip_scanner = Bench::measure(rounds, [&] { Bench::keep(Fx::unescape(frame)); });
+	Bench::report("unescape frame: regex", strip_regex);
+	Bench::report("unescape frame: scanner", strip_scanner);
+	Bench::compare("speedup", strip_regex, strip_scanner);
+}
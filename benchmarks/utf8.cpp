@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// The UTF-8 length, resize and justify functions on process names and command lines, the strings Proc::draw pads
+// and cuts for every row, with the block kernels versus the byte by byte and mbstowcs based versions they replaced.
+
+#include <algorithm>
+#include <clocale>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "mbtop_tools.hpp"
+#include "widechar_width.hpp"
+
+using std::string;
+using std::vector;
+
+namespace Legacy {
+	size_t ulen(const std::string_view str) {
+		return std::ranges::count_if(str, [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; });
+	}
+
+	size_t wide_ulen(const vector<wchar_t>& w_str) {
+		unsigned int chars = 0;
+		for (auto c : w_str) chars += widechar_wcwidth(c);
+		return chars;
+	}
+
+	size_t wide_ulen(const std::string_view str) {
+		if (str.empty()) return 0;
+		size_t w_len = 1 + std::mbstowcs(nullptr, str.data(), 0);
+		if (w_len <= 1) return ulen(str);
+		vector<wchar_t> w_str(w_len);
+		std::mbstowcs(&w_str[0], str.data(), w_len);
+		return wide_ulen(w_str);
+	}
+
+	string uresize(string str, const size_t len) {
+		if (len < 1 or str.empty()) return "";
+		size_t w_len = 1 + std::mbstowcs(nullptr, str.data(), 0);
+		if (w_len <= 1) return str;
+		vector<wchar_t> w_str(w_len);
+		std::mbstowcs(&w_str[0], str.data(), w_len);
+		while (w_str.size() > 1 and wide_ulen(w_str) > len) {
+			w_str.pop_back();
+			w_str.back() = L'\0';
+		}
+		string n_str;
+		n_str.resize(std::wcstombs(nullptr, &w_str[0], 0));
+		std::wcstombs(&n_str[0], &w_str[0], n_str.size());
+		return n_str;
+	}
+
+	string ljust(string str, const size_t x) {
+		if (wide_ulen(str) > x) return uresize(str, x);
+		return str + string(std::max((int)(x - wide_ulen(str)), 0), ' ');
+	}
+}
+
+int main(int argc, char** argv) {
+	const size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+	if (std::setlocale(LC_ALL, "C.UTF-8") == nullptr) std::setlocale(LC_ALL, "en_US.UTF-8");
+
+	//? A process list worth of names and commands, one in ten with non ASCII characters
+	vector<string> names, commands;
+	for (int i = 0; i < 400; ++i) {
+		const bool mixed = i % 10 == 0;
+		names.push_back((mixed ? "naïve-日本" : "kworker/u16:") + std::to_string(i));
+		commands.push_back("/usr/lib/" + string(mixed ? "アプリ/bin/" : "application/bin/") + "service-" + std::to_string(i)
+			+ " --config /etc/service/service.conf --log-level=info --workers 8" + (mixed ? " --title \"Überwachung — 監視\"" : ""));
+	}
+	for (size_t i = 0; i < names.size(); ++i) {
+		if (Tools::ulen(names[i], true) != Legacy::wide_ulen(names[i]) or Tools::ljust(commands[i], 60, true, true) != Legacy::ljust(commands[i], 60)) {
+			fmt::print("output differs from the legacy functions\n");
+			return 1;
+		}
+	}
+	const size_t ops = names.size() + commands.size();
+	fmt::print("{} names and {} commands, {} rounds\n", names.size(), commands.size(), rounds);
+
+	auto run = [&](auto&& fn) {
+		return Bench::measure(rounds, [&] {
+			for (const auto& s : names) Bench::keep(fn(s));
+			for (const auto& s : commands) Bench::keep(fn(s));
+		});
+	};
+
+	const double ulen_old = run([](const string& s) { return Legacy::ulen(s); });
+	const double ulen_new = run([](const string& s) { return Tools::ulen(s); });
+	Bench::report("ulen: bytewise", ulen_old, ops);
+	Bench::report("ulen: blocks", ulen_new, ops);
+	Bench::compare("speedup", ulen_old, ulen_new);
+
+	const double wide_old = run([](const string& s) { return Legacy::wide_ulen(s); });
+	const double wide_new = run([](const string& s) { return Tools::ulen(s, true); });
+	Bench::report("ulen wide: mbstowcs", wide_old, ops);
+	Bench::report("ulen wide: blocks", wide_new, ops);
+	Bench::compare("speedup", wide_old, wide_new);
+
+	const double resize_old = run([](const string& s) { return Legacy::uresize(s, 20); });
+	const double resize_new = run([](const string& s) { return Tools::uresize(s, 20, true); });
+	Bench::report("uresize wide 20: mbstowcs", resize_old, ops);
+	Bench::report("uresize wide 20: blocks", resize_new, ops);
+	Bench::compare("speedup", resize_old, resize_new);
+
+	const double ljust_old = run([](const string& s) { return Legacy::ljust(s, 60); });
+	const double ljust_new = run([](const string& s) { return Tools::ljust(s, 60, true, true); });
+	Bench::report("ljust wide 60: mbstowcs", ljust_old, ops);
+	Bench::report("ljust wide 60: blocks", ljust_new, ops);
+	Bench::compare("speedup", ljust_old, ljust_new);
+}
@@ -27,6 +27,8 @@ tab-size = 4
 #include <numeric>
 #include <optional>
 #include <ranges>
+#include <span>
+#include <spanstream>
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
@@ -55,6 +57,9 @@ tab-size = 4
 #include "../mbtop_log.hpp"
 #include "../mbtop_shared.hpp"
 #include "../mbtop_tools.hpp"
+#include "proc_events.hpp"
+#include "procfs.hpp"
+#include "read_batch.hpp"
 
 #if defined(GPU_SUPPORT)
 	#define class class_
@@ -287,7 +292,7 @@ namespace Shared {
 
 		//? Shared global variables init
 		procPath = (fs::is_directory(fs::path("/proc")) and access("/proc", R_OK) != -1) ? "/proc" : "";
-		if (procPath.empty())
+		if (procPath.empty() or not Procfs::init(procPath))
 			throw std::runtime_error("Proc filesystem not found or no permission to read from it!");
 
 		passwd_path = (fs::is_regular_file(fs::path("/etc/passwd")) and access("/etc/passwd", R_OK) != -1) ? "/etc/passwd" : "";
@@ -389,6 +394,9 @@ namespace Cpu {
 	bool has_battery = true;
 	tuple<int, float, long, string> current_bat;
 
+	//? /proc/stat, temperature sensors and cpu frequencies, read together at the start of every update
+	static Procfs::read_batch cpu_files;
+
 	const array time_names {
 		"user"s, "nice"s, "system"s, "idle"s, "iowait"s,
 		"irq"s, "softirq"s, "steal"s, "guest"s, "guest_nice"s
@@ -444,62 +452,63 @@ namespace Cpu {
 	bool get_sensors() {
 		bool got_cpu = false, got_coretemp = false;
 		vector<fs::path> search_paths;
+		//? Nested listings each need their own buffer
+		Procfs::dir_lister hwmon_dirs, hwmon_files, device_files;
+		const auto is_temp_input = [](std::string_view filename) { return filename.starts_with("temp") and filename.ends_with("_input"); };
 		try {
 			//? Setup up paths to search for sensors
 			if (fs::exists(fs::path("/sys/class/hwmon")) and access("/sys/class/hwmon", R_OK) != -1) {
-				for (const auto& dir : fs::directory_iterator(fs::path("/sys/class/hwmon"))) {
-					fs::path add_path = fs::canonical(dir.path());
-					if (v_contains(search_paths, add_path) or v_contains(search_paths, add_path / "device")) continue;
+				hwmon_dirs.each("/sys/class/hwmon", [&](std::string_view dir, unsigned char) {
+					fs::path add_path = fs::canonical(fs::path("/sys/class/hwmon") / dir);
+					if (v_contains(search_paths, add_path) or v_contains(search_paths, add_path / "device")) return;
 
 					if (std::string_view { add_path.c_str() }.contains("coretemp"))
 						got_coretemp = true;
 
-					for (const auto & file : fs::directory_iterator(add_path)) {
-						if (file.path().filename() == "device") {
-							for (const auto & dev_file : fs::directory_iterator(file.path())) {
-								string dev_filename = dev_file.path().filename();
-								if (dev_filename.starts_with("temp") and dev_filename.ends_with("_input")) {
-									search_paths.push_back(file.path());
-									break;
-								}
-							}
+					hwmon_files.each(add_path.c_str(), [&](std::string_view filename, unsigned char) {
+						if (filename == "device") {
+							const fs::path device_path = add_path / filename;
+							device_files.each(device_path.c_str(), [&](std::string_view dev_filename, unsigned char) {
+								if (not is_temp_input(dev_filename)) return true;
+								search_paths.push_back(device_path);
+								return false;
+							});
 						}
 
-						string filename = file.path().filename();
-						if (filename.starts_with("temp") and filename.ends_with("_input")) {
+						if (is_temp_input(filename)) {
 							search_paths.push_back(add_path);
-							break;
+							return false;
 						}
-					}
-				}
+						return true;
+					});
+				});
 			}
 			if (not got_coretemp and fs::exists(fs::path("/sys/devices/platform/coretemp.0/hwmon"))) {
-				for (auto& d : fs::directory_iterator(fs::path("/sys/devices/platform/coretemp.0/hwmon"))) {
-					fs::path add_path = fs::canonical(d.path());
+				hwmon_dirs.each("/sys/devices/platform/coretemp.0/hwmon", [&](std::string_view dir, unsigned char) {
+					fs::path add_path = fs::canonical(fs::path("/sys/devices/platform/coretemp.0/hwmon") / dir);
 
-					for (const auto & file : fs::directory_iterator(add_path)) {
-						string filename = file.path().filename();
-						if (filename.starts_with("temp") and filename.ends_with("_input") and not v_contains(search_paths, add_path)) {
+					hwmon_files.each(add_path.c_str(), [&](std::string_view filename, unsigned char) {
+						if (is_temp_input(filename) and not v_contains(search_paths, add_path)) {
 								search_paths.push_back(add_path);
 								got_coretemp = true;
-								break;
+								return false;
 						}
-					}
-				}
+						return true;
+					});
+				});
 			}
 			//? Scan any found directories for temperature sensors
 			if (not search_paths.empty()) {
 				for (const auto& path : search_paths) {
 					const string pname = readfile(path / "name", path.filename());
-					for (const auto & file : fs::directory_iterator(path)) {
+					hwmon_files.each(path.c_str(), [&](std::string_view filename, unsigned char) {
 						const string file_suffix = "input";
-						const string filename = file.path().filename().string();
 						//? Extract numeric ID safely, skip "temp" prefix (4 chars)
 						const int file_id = (filename.length() > 4) ? stoi_safe(filename.substr(4)) : 0;
-						string file_path = file.path();
+						string file_path = path / filename;
 
 						if (!file_path.contains(file_suffix) or file_path.contains("nvme")) {
-							continue;
+							return;
 						}
 
 						const string basepath = file_path.erase(file_path.find(file_suffix), file_suffix.length());
@@ -518,7 +527,7 @@ namespace Cpu {
 							got_coretemp = true;
 							if (not v_contains(core_sensors, sensor_name)) core_sensors.push_back(sensor_name);
 						}
-					}
+					});
 				}
 			}
 			//? If no good candidate for cpu temp has been found scan /sys/class/thermal
@@ -585,7 +594,7 @@ namespace Cpu {
 
 		const auto& cpu_sensor = (not Config::getS("cpu_sensor").empty() and found_sensors.contains(Config::getS("cpu_sensor")) ? Config::getS("cpu_sensor") : Cpu::cpu_sensor);
 
-		found_sensors.at(cpu_sensor).temp = stol_safe(readfile(found_sensors.at(cpu_sensor).path, "0")) / 1000;
+		found_sensors.at(cpu_sensor).temp = stol_safe(cpu_files.read(found_sensors.at(cpu_sensor).path).value_or("0")) / 1000;
 		current_cpu.temp.at(0).push_back(found_sensors.at(cpu_sensor).temp);
 		current_cpu.temp_max = found_sensors.at(cpu_sensor).crit;
 		if (current_cpu.temp.at(0).size() > 20) current_cpu.temp.at(0).pop_front();
@@ -593,7 +602,7 @@ namespace Cpu {
 		if (Config::getB("show_coretemp") and not cpu_temp_only) {
 			for (vector<string_view> done; const auto& sensor : core_sensors) {
 				if (v_contains(done, sensor)) continue;
-				found_sensors.at(sensor).temp = stol_safe(readfile(found_sensors.at(sensor).path, "0")) / 1000;
+				found_sensors.at(sensor).temp = stol_safe(cpu_files.read(found_sensors.at(sensor).path).value_or("0")) / 1000;
 				done.push_back(sensor);
 			}
 			for (const auto& [core, temp] : core_mapping) {
@@ -645,7 +654,7 @@ namespace Cpu {
         			continue;
     			}
 
-    			double core_hz = stod(readfile(*it, "0.0")) / 1000;
+    			double core_hz = static_cast<double>(Procfs::to_u64(cpu_files.read(*it).value_or(""))) / 1000;
     			if (core_hz <= 0.0 and ++failed >= 2) {
         			it = Cpu::core_freq.erase(it);
     			} else {
@@ -1060,6 +1069,9 @@ namespace Cpu {
 		if (Runner::stopping or (no_update and not current_cpu.cpu_percent.at("total").empty())) return current_cpu;
 		auto& cpu = current_cpu;
 
+		cpu_files.run(Config::getB("io_uring"));
+		if (Global::debug) Runner::debug_stat("cpu files", fmt::format("{} in {} sc", cpu_files.last_read_count(), cpu_files.last_syscall_count()));
+
 		if (Config::getB("show_cpu_freq"))
 			cpuHz = get_cpuHz();
 
@@ -1067,12 +1079,11 @@ namespace Cpu {
 			Logger::error("failed to get load averages");
 		}
 
-		ifstream cread;
+		std::ispanstream cread(cpu_files.read(Shared::procPath / "stat").value_or(""));
 
 		try {
 			//? Get cpu total times for all cores from /proc/stat
 			string cpu_name;
-			cread.open(Shared::procPath / "stat");
 			int i = 0;
 			int target = Shared::coreCount;
 			for (; i <= target or (cread.good() and cread.peek() == 'c'); i++) {
@@ -1174,10 +1185,10 @@ namespace Cpu {
 			}
 
 			//? Notify main thread to redraw screen if we found more cores than previously detected
+			//? Shared::coreCount is updated by the runner once no other collector is running, Proc::collect reads it
 			if (cmp_greater(cpu.core_percent.size(), Shared::coreCount)) {
 				Logger::debug("Changing CPU max corecount from {} to {}.", Shared::coreCount, cpu.core_percent.size());
 				Runner::coreNum_reset = true;
-				Shared::coreCount = cpu.core_percent.size();
 				while (cmp_less(current_cpu.temp.size(), cpu.core_percent.size() + 1)) current_cpu.temp.push_back({0});
 			}
 
@@ -1199,6 +1210,7 @@ namespace Cpu {
 
 		cpu.active_cpus = std::make_optional(detect_active_cpus());
 
+		++data_version;
 		return cpu;
 	}
 }
@@ -2029,6 +2041,9 @@ namespace Mem {
 
 	mem_info current_mem {};
 
+	//? Disk io statistics files, read together once per update
+	static Procfs::read_batch disk_files;
+
 	uint64_t get_totalMem() {
 		ifstream meminfo(Shared::procPath / "meminfo");
 		int64_t totalMem = 0;
@@ -2363,26 +2378,32 @@ namespace Mem {
 				//? Get disks IO
 				int64_t sectors_read, sectors_write, io_ticks, io_ticks_temp;
 				disk_ios = 0;
+				disk_files.run(Config::getB("io_uring"));
+				if (Global::debug) Runner::debug_stat("disk files", fmt::format("{} in {} sc", disk_files.last_read_count(), disk_files.last_syscall_count()));
 				for (auto& [ignored, disk] : disks) {
-					if (disk.stat.empty() or access(disk.stat.c_str(), R_OK) != 0) continue;
-					if (disk.fstype == "zfs" && zfs_hide_datasets && zfs_collect_pool_total_stats(disk)) {
-						disk_ios++;
-						continue;
+					if (disk.stat.empty()) continue;
+					if (disk.fstype == "zfs" && zfs_hide_datasets) {
+						if (access(disk.stat.c_str(), R_OK) == 0 and zfs_collect_pool_total_stats(disk)) {
+							disk_ios++;
+							continue;
+						}
 					}
-					diskread.open(disk.stat);
-					if (diskread.good()) {
+					auto stat_file = disk_files.read(disk.stat);
+					if (not stat_file) continue;
+					std::ispanstream statread(*stat_file);
+					if (statread.good()) {
 						disk_ios++;
 						//? ZFS Pool Support
 						if (disk.fstype == "zfs") {
 							// skip first three lines
-							for (int i = 0; i < 3; i++) diskread.ignore(numeric_limits<streamsize>::max(), '\n');
+							for (int i = 0; i < 3; i++) statread.ignore(numeric_limits<streamsize>::max(), '\n');
 							// skip characters until '4' is reached, indicating data type 4, next value will be out target
-							diskread.ignore(numeric_limits<streamsize>::max(), '4');
-							diskread >> io_ticks;
+							statread.ignore(numeric_limits<streamsize>::max(), '4');
+							statread >> io_ticks;
 
 							// skip characters until '4' is reached, indicating data type 4, next value will be out target
-							diskread.ignore(numeric_limits<streamsize>::max(), '4');
-							diskread >> sectors_write; // nbytes written
+							statread.ignore(numeric_limits<streamsize>::max(), '4');
+							statread >> sectors_write; // nbytes written
 							if (disk.io_write.empty())
 								disk.io_write.push_back(0);
 							else
@@ -2391,13 +2412,13 @@ namespace Mem {
 							while (cmp_greater(disk.io_write.size(), width * 2)) disk.io_write.pop_front();
 
 							// skip characters until '4' is reached, indicating data type 4, next value will be out target
-							diskread.ignore(numeric_limits<streamsize>::max(), '4');
-							diskread >> io_ticks_temp;
+							statread.ignore(numeric_limits<streamsize>::max(), '4');
+							statread >> io_ticks_temp;
 							io_ticks += io_ticks_temp;
 
 							// skip characters until '4' is reached, indicating data type 4, next value will be out target
-							diskread.ignore(numeric_limits<streamsize>::max(), '4');
-							diskread >> sectors_read; // nbytes read
+							statread.ignore(numeric_limits<streamsize>::max(), '4');
+							statread >> sectors_read; // nbytes read
 							if (disk.io_read.empty())
 								disk.io_read.push_back(0);
 							else
@@ -2412,8 +2433,8 @@ namespace Mem {
 							disk.old_io.at(2) = io_ticks;
 							while (cmp_greater(disk.io_activity.size(), width * 2)) disk.io_activity.pop_front();
 						} else {
-							for (int i = 0; i < 2; i++) { diskread >> std::ws; diskread.ignore(SSmax, ' '); }
-							diskread >> sectors_read;
+							for (int i = 0; i < 2; i++) { statread >> std::ws; statread.ignore(SSmax, ' '); }
+							statread >> sectors_read;
 							if (disk.io_read.empty())
 								disk.io_read.push_back(0);
 							else
@@ -2421,8 +2442,8 @@ namespace Mem {
 							disk.old_io.at(0) = sectors_read;
 							while (cmp_greater(disk.io_read.size(), width * 2)) disk.io_read.pop_front();
 
-							for (int i = 0; i < 3; i++) { diskread >> std::ws; diskread.ignore(SSmax, ' '); }
-							diskread >> sectors_write;
+							for (int i = 0; i < 3; i++) { statread >> std::ws; statread.ignore(SSmax, ' '); }
+							statread >> sectors_write;
 							if (disk.io_write.empty())
 								disk.io_write.push_back(0);
 							else
@@ -2430,8 +2451,8 @@ namespace Mem {
 							disk.old_io.at(1) = sectors_write;
 							while (cmp_greater(disk.io_write.size(), width * 2)) disk.io_write.pop_front();
 
-							for (int i = 0; i < 2; i++) { diskread >> std::ws; diskread.ignore(SSmax, ' '); }
-							diskread >> io_ticks;
+							for (int i = 0; i < 2; i++) { statread >> std::ws; statread.ignore(SSmax, ' '); }
+							statread >> io_ticks;
 							if (uptime == old_uptime || disk.io_activity.empty())
 								disk.io_activity.push_back(0);
 							else
@@ -2442,7 +2463,6 @@ namespace Mem {
 					} else {
 						Logger::debug("Error in Mem::collect() : when opening {}", disk.stat);
 					}
-					diskread.close();
 				}
 				old_uptime = uptime;
 			}
@@ -2451,6 +2471,7 @@ namespace Mem {
 			}
 		}
 
+		++data_version;
 		return mem;
 	}
 
@@ -2599,6 +2620,9 @@ namespace Net {
 	bool rescale{true};
 	uint64_t timestamp{};
 
+	//? Interface byte counters, read together once per update
+	static Procfs::read_batch net_files;
+
 	auto collect(bool no_update) -> net_info& {
 		if (Runner::stopping) return empty_net;
 		auto& net = current_net;
@@ -2667,20 +2691,19 @@ namespace Net {
 			}
 
 			//? Get total received and transmitted bytes + device address if no ip was found
+			net_files.run(Config::getB("io_uring"));
+			if (Global::debug) Runner::debug_stat("net files", fmt::format("{} in {} sc", net_files.last_read_count(), net_files.last_syscall_count()));
 			for (const auto& iface : interfaces) {
 				auto& netif = net.at(iface);
 				if (netif.ipv4.empty() and netif.ipv6.empty())
 					netif.ipv4 = readfile("/sys/class/net/" + iface + "/address");
 
 				for (const string dir : {"download", "upload"}) {
-					const fs::path sys_file = "/sys/class/net/" + iface + "/statistics/" + (dir == "download" ? "rx_bytes" : "tx_bytes");
+					const string sys_file = "/sys/class/net/" + iface + "/statistics/" + (dir == "download" ? "rx_bytes" : "tx_bytes");
 					auto& saved_stat = netif.stat.at(dir);
 					auto& bandwidth = netif.bandwidth.at(dir);
 
-					uint64_t val{};
-					try { val = stoull(readfile(sys_file, "0")); }
-					catch (const std::invalid_argument&) {}
-					catch (const std::out_of_range&) {}
+					const uint64_t val = Procfs::to_u64(net_files.read(sys_file).value_or(""));
 
 					//? Update speed, total and top values
 					if (val < saved_stat.last) {
@@ -2728,6 +2751,7 @@ namespace Net {
 			}
 
 			timestamp = new_timestamp;
+			++data_version;
 		}
 
 		//? Return empty net_info struct if no interfaces was found
@@ -2817,7 +2841,7 @@ namespace Proc {
 
 	//* Get detailed info for selected process
 	static void _collect_details(const size_t pid, const uint64_t uptime, vector<proc_info>& procs) {
-		fs::path pid_path = Shared::procPath / std::to_string(pid);
+		const int proc_fd = Procfs::root();
 
 		if (pid != detailed.last_pid) {
 			detailed = {};
@@ -2848,23 +2872,11 @@ namespace Proc {
 		//? Expand process status from single char to explanative string
 		detailed.status = (proc_states.contains(detailed.entry.state)) ? proc_states.at(detailed.entry.state) : "Unknown";
 
-		ifstream d_read;
-		string short_str;
-
 		//? Try to get RSS mem from proc/[pid]/smaps
 		detailed.memory.clear();
-		if (not detailed.skip_smaps and fs::exists(pid_path / "smaps")) {
-			d_read.open(pid_path / "smaps");
-			uint64_t rss = 0;
-			try {
-				while (d_read.good()) {
-					d_read.ignore(SSmax, 'R');
-					if (d_read.peek() == 's') {
-						d_read.ignore(SSmax, ':');
-						getline(d_read, short_str, 'k');
-						rss += stoull(short_str);
-					}
-				}
+		if (not detailed.skip_smaps) {
+			if (auto smaps = Procfs::read_pid(proc_fd, pid, "smaps")) {
+				const uint64_t rss = Procfs::sum_smaps_rss(*smaps);
 				if (rss == detailed.entry.mem >> 10)
 					detailed.skip_smaps = true;
 				else {
@@ -2872,9 +2884,6 @@ namespace Proc {
 					detailed.memory = floating_humanizer(rss, false, 1);
 				}
 			}
-			catch (const std::invalid_argument&) {}
-			catch (const std::out_of_range&) {}
-			d_read.close();
 		}
 		if (detailed.memory.empty()) {
 			detailed.mem_bytes.push_back(detailed.entry.mem);
@@ -2888,28 +2897,11 @@ namespace Proc {
 		while (cmp_greater(detailed.mem_bytes.size(), width)) detailed.mem_bytes.pop_front();
 
 		//? Get bytes read and written from proc/[pid]/io
-		if (fs::exists(pid_path / "io")) {
-			d_read.open(pid_path / "io");
-			try {
-				string name;
-				while (d_read.good()) {
-					getline(d_read, name, ':');
-					if (name.ends_with("read_bytes")) {
-						getline(d_read, short_str);
-						detailed.io_read = floating_humanizer(stoull(short_str));
-					}
-					else if (name.ends_with("write_bytes")) {
-						getline(d_read, short_str);
-						detailed.io_write = floating_humanizer(stoull(short_str));
-						break;
-					}
-					else
-						d_read.ignore(SSmax, '\n');
-				}
-			}
-			catch (const std::invalid_argument&) {}
-			catch (const std::out_of_range&) {}
-			d_read.close();
+		if (auto io = Procfs::read_pid(proc_fd, pid, "io")) {
+			if (auto read_bytes = Procfs::find_key(*io, "read_bytes"); not read_bytes.empty())
+				detailed.io_read = floating_humanizer(Procfs::to_u64(read_bytes));
+			if (auto write_bytes = Procfs::find_key(*io, "write_bytes"); not write_bytes.empty())
+				detailed.io_write = floating_humanizer(Procfs::to_u64(write_bytes));
 		}
 	}
 
@@ -2935,13 +2927,23 @@ namespace Proc {
 		}
 		if (tree_mode_change) is_tree_mode = tree;
 		ifstream pread;
-		string long_string;
-		string short_str;
+		const int proc_fd = Procfs::root();
 
 		//? Use unordered_set for O(1) PID lookup instead of O(n) vector search
 		static std::unordered_set<size_t> found;
 		//? Map from PID to index in current_procs for O(1) lookup
 		static std::unordered_map<size_t, size_t> pid_to_index;
+		//? Per pid samples and their index in current_procs, kept between updates to reuse string capacity
+		static vector<Procfs::pid_sample> samples;
+		static vector<size_t> sample_slots;
+		//? Never destroyed, the runner thread might still be collecting while the process exits
+		static auto& collect_pool = *new Tools::WorkerPool();
+		//? Open /proc/[pid]/stat descriptors for processes that live across updates, sized from RLIMIT_NOFILE
+		static Procfs::fd_cache stat_fds;
+		//? Pids for the current update and pids that called exec() since the last one
+		static vector<size_t> pid_list, exec_list;
+		static size_t updates_since_scan{};
+		static Procfs::dir_lister proc_dir;
 
 		const double uptime = system_uptime();
 
@@ -2975,7 +2977,6 @@ namespace Proc {
 			}
 
 			auto totalMem = Mem::get_totalMem();
-			int totalMem_len = to_string(totalMem >> 10).size();
 
 			//? Update uid_user map if /etc/passwd changed since last run
 			if (not Shared::passwd_path.empty() and fs::last_write_time(Shared::passwd_path) != passwd_time) {
@@ -3000,27 +3001,38 @@ namespace Proc {
 			}
 
 			//? Get cpu total times from /proc/stat
-			cputimes = 0;
-			pread.open(Shared::procPath / "stat");
-			if (pread.good()) {
-				pread.ignore(SSmax, ' ');
-				for (uint64_t times; pread >> times; cputimes += times);
-			}
+			if (auto proc_stat = Procfs::read_at(proc_fd, "stat"))
+				cputimes = Procfs::parse_cpu_total(*proc_stat);
 			else throw std::runtime_error("Failure to read /proc/stat");
-			pread.close();
 
-			//? Iterate over all pids in /proc
-			for (const auto& d: fs::directory_iterator(Shared::procPath)) {
+			//? Get pids from the process event listener if it's tracking, otherwise (and every 64th update to catch any drift) list /proc
+			if (not Config::getB("proc_events")) ProcEvents::stop();
+			const bool use_events = Config::getB("proc_events") and ProcEvents::start();
+			if (not use_events or ++updates_since_scan >= 64 or not ProcEvents::pids(pid_list)) {
+				updates_since_scan = 0;
+				if (use_events) ProcEvents::begin_resync();
+				pid_list.clear();
+				if (not proc_dir.numbers(proc_fd, pid_list))
+					throw std::runtime_error("Failure to list /proc");
 				if (Runner::stopping)
 					return current_procs;
+				if (use_events) ProcEvents::resync(pid_list);
+			}
 
-				if (pread.is_open()) pread.close();
-
-				const string pid_str = d.path().filename();
-				if (not isdigit(pid_str[0])) continue;
-
-				const size_t pid = stoul(pid_str);
+			//? Processes that replaced their image since last update need name and command line read again
+			exec_list.clear();
+			if (use_events) {
+				ProcEvents::take_execs(exec_list);
+				rng::sort(exec_list);
+				short_lived = ProcEvents::take_short_lived();
+			}
+			else short_lived = 0;
 
+			//? Pick a slot in current_procs for each pid, sampling happens afterwards
+			size_t sample_count = 0;
+			stat_fds.resize(Procfs::fd_budget());
+			size_t fd_room = stat_fds.capacity() - stat_fds.size();
+			for (const size_t pid : pid_list) {
 				if (should_filter_kernel and kernels_procs.contains(pid)) {
 					continue;
 				}
@@ -3046,45 +3058,58 @@ namespace Proc {
 					proc_idx = idx_it->second;
 				}
 
-				auto& new_proc = current_procs[proc_idx];
+				if (sample_count == samples.size()) {
+					samples.emplace_back();
+					sample_slots.emplace_back();
+				}
+				auto& sample = samples[sample_count];
+				sample.pid = pid;
+				sample.with_names = no_cache or rng::binary_search(exec_list, pid);
+				sample.starttime = current_procs[proc_idx].cpu_s;
+				sample.stat_fd = stat_fds.get(pid, sample.starttime);
+				sample.keep_stat_fd = sample.stat_fd < 0 and fd_room > 0;
+				if (sample.keep_stat_fd) --fd_room;
+				sample_slots[sample_count++] = proc_idx;
+			}
+
+			//? Read the files of every pid, split across the collector threads when there are enough processes
+			const int collect_threads = Config::getI("proc_collect_threads");
+			collect_pool.resize((collect_threads > 0 ? collect_threads : clamp(Shared::coreCount, 1l, 8l)) - 1);
+			const uint64_t statm_min_pages = (totalMem + Shared::page_size - 1) / Shared::page_size;
+			Procfs::sample_all(proc_fd, std::span(samples).first(sample_count), statm_min_pages, &collect_pool);
+
+			if (Runner::stopping)
+				return current_procs;
+
+			//? Merge the samples in /proc order, everything that touches shared state happens here on a single thread
+			size_t stat_fd_hits = 0;
+			for (size_t i = 0; i < sample_count; ++i) {
+				using Procfs::stage;
+				const auto& sample = samples[i];
+				auto& new_proc = current_procs[sample_slots[i]];
+
+				if (sample.stat_fd >= 0 and not sample.stale_fd) ++stat_fd_hits;
+				else if (sample.stale_fd) stat_fds.erase(sample.pid);
+				if (sample.opened_fd >= 0) {
+					if (sample.reached == stage::stat) stat_fds.put(sample.pid, sample.stat.starttime, sample.opened_fd);
+					else Procfs::fd_cache::close_fd(sample.opened_fd);
+				}
+
+				//? The pid now belongs to a different process, start over with a fresh entry
+				if (sample.reused) new_proc = proc_info{sample.pid};
 
 				//? Get program name, command and username
-				if (no_cache) {
-					pread.open(d.path() / "comm");
-					if (not pread.good()) continue;
-					getline(pread, new_proc.name);
-					pread.close();
-					//? Check for whitespace characters in name and set offset to get correct fields from stat file
-					new_proc.name_offset = rng::count(new_proc.name, ' ');
-
-					pread.open(d.path() / "cmdline");
-					if (not pread.good()) continue;
-					long_string.clear();
-					while(getline(pread, long_string, '\0')) {
-						new_proc.cmd += long_string + ' ';
-						if (new_proc.cmd.size() > 1000) {
-							new_proc.cmd.resize(1000);
-							break;
-						}
-					}
-					pread.close();
-					if (not new_proc.cmd.empty()) new_proc.cmd.pop_back();
+				if (sample.with_names) {
+					filter_results.forget(sample.pid);
+					Config::forget_process_config(sample.pid);
+					if (sample.reached < stage::comm) continue;
+					new_proc.name = sample.name;
 
-					pread.open(d.path() / "status");
-					if (not pread.good()) continue;
-					string uid;
-					string line;
-					while (pread.good()) {
-						getline(pread, line, ':');
-						if (line == "Uid") {
-							pread.ignore();
-							getline(pread, uid, '\t');
-							break;
-						} else {
-							pread.ignore(SSmax, '\n');
-						}
-					}
-					pread.close();
+					if (sample.reached < stage::cmdline) continue;
+					new_proc.cmd = sample.cmd;
+
+					if (sample.reached < stage::status) continue;
+					const string& uid = sample.uid;
 					if (uid_user.contains(uid)) {
 						new_proc.user = uid_user.at(uid);
 					}
@@ -3110,82 +3135,36 @@ namespace Proc {
 					}
 				}
 
-				//? Parse /proc/[pid]/stat
-				pread.open(d.path() / "stat");
-				if (not pread.good()) continue;
+				//? Values from /proc/[pid]/stat
+				if (sample.reached < stage::stat_read) continue;
+				const bool stat_ok = sample.reached == stage::stat;
+				const auto& stat = sample.stat;
 
-				const auto& offset = new_proc.name_offset;
-				short_str.clear();
-				int x = 0, next_x = 3;
-				uint64_t cpu_t = 0;
-				try {
-					for (;;) {
-						while (pread.good() and ++x < next_x + offset) pread.ignore(SSmax, ' ');
-						if (not pread.good()) break;
-						else getline(pread, short_str, ' ');
-
-						switch (x-offset) {
-							case 3: //? Process state
-								new_proc.state = short_str.at(0);
-								if (new_proc.ppid != 0) next_x = 14;
-								continue;
-							case 4: //? Parent pid
-								new_proc.ppid = stoull(short_str);
-								next_x = 14;
-								continue;
-							case 14: //? Process utime
-								cpu_t = stoull(short_str);
-								continue;
-							case 15: //? Process stime
-								cpu_t += stoull(short_str);
-								next_x = 19;
-								continue;
-							case 19: //? Nice value
-								new_proc.p_nice = stoll_safe(short_str);
-								continue;
-							case 20: //? Number of threads
-								new_proc.threads = stoull(short_str);
-								if (new_proc.cpu_s == 0) {
-									next_x = 22;
-									new_proc.cpu_t = cpu_t;
-								}
-								else
-									next_x = 24;
-								continue;
-							case 22: //? Get cpu seconds if missing
-								new_proc.cpu_s = stoull(short_str);
-								next_x = 24;
-								continue;
-							case 24: //? RSS memory (can be inaccurate, but parsing smaps increases total cpu usage by ~20x)
-								if (cmp_greater(short_str.size(), totalMem_len))
-									new_proc.mem = totalMem;
-								else
-									new_proc.mem = stoull(short_str) * Shared::page_size;
-						}
-						break;
+				if (stat_ok) {
+					new_proc.state = stat.state;
+					if (new_proc.ppid == 0) new_proc.ppid = stat.ppid;
+					new_proc.p_nice = stat.nice;
+					new_proc.threads = stat.threads;
+					if (new_proc.cpu_s == 0) {
+						new_proc.cpu_s = stat.starttime;
+						new_proc.cpu_t = stat.utime + stat.stime;
 					}
-
+					//? RSS memory (can be inaccurate, but parsing smaps increases total cpu usage by ~20x)
+					new_proc.mem = (stat.rss_pages > totalMem / Shared::page_size) ? totalMem : stat.rss_pages * Shared::page_size;
 				}
-				catch (const std::invalid_argument&) { continue; }
-				catch (const std::out_of_range&) { continue; }
-
-				pread.close();
+				const uint64_t cpu_t = stat.utime + stat.stime;
 
 				if (should_filter_kernel and new_proc.ppid == KTHREADD) {
 					kernels_procs.emplace(new_proc.pid);
 					found.erase(new_proc.pid);
 				}
 
-				if (x-offset < 24) continue;
+				if (not stat_ok) continue;
 
-				//? Get RSS memory from /proc/[pid]/statm if value from /proc/[pid]/stat looks wrong
+				//? RSS memory from /proc/[pid]/statm if value from /proc/[pid]/stat looks wrong
 				if (new_proc.mem >= totalMem) {
-					pread.open(d.path() / "statm");
-					if (not pread.good()) continue;
-					pread.ignore(SSmax, ' ');
-					pread >> new_proc.mem;
-					new_proc.mem *= Shared::page_size;
-					pread.close();
+					if (not sample.statm_pages) continue;
+					new_proc.mem = *sample.statm_pages * Shared::page_size;
 				}
 
 				//? Process cpu usage since last update
@@ -3202,6 +3181,16 @@ namespace Proc {
 				}
 			}
 
+			//? Close descriptors of processes that are gone or filtered out
+			stat_fds.retain([&](size_t pid) { return found.contains(pid); });
+			filter_results.retain([&](size_t pid) { return found.contains(pid); });
+			Config::retain_process_configs([&](size_t pid) { return found.contains(pid); });
+			//? A cached descriptor saves the openat(), the read() hitting end of file and the close() of a plain read
+			if (Global::debug) {
+				Runner::debug_stat("stat fd hits", fmt::format("{}/{} {}%", stat_fd_hits, sample_count, stat_fd_hits * 100 / max<size_t>(sample_count, 1)));
+				Runner::debug_stat("syscalls saved", to_string(stat_fd_hits * 3));
+			}
+
 			//? Clear dead processes from current_procs and remove kernel processes if enabled and not paused
 			if (not pause_proc_list) {
 				//? Use O(1) set lookup instead of O(n) vector search
@@ -3237,6 +3226,7 @@ namespace Proc {
 			}
 
 			old_cputimes = cputimes;
+			++data_version;
 		}
 		//* ---------------------------------------------Collection done-----------------------------------------------
 
@@ -3258,9 +3248,18 @@ namespace Proc {
 		}
 
 		//* Sort processes
+		//? Only the processes up to a page past the visible window are put in order, the rest once scrolled to
+		static size_t sorted_rows{};
+		size_t needed_rows = SIZE_MAX;
+		if (not Config::getB("follow_process") and Config::getI("restore_detailed_pid") == 0)
+			needed_rows = static_cast<size_t>(Config::getI("proc_start")) + static_cast<size_t>(max(Proc::select_max, 50)) * 2;
 		if ((sorted_change or tree_mode_change) or (not no_update and not pause_proc_list)) {
-			proc_sorter(current_procs, sorting, reverse, tree);
+			sorted_rows = proc_sorter(current_procs, sorting, reverse, tree, needed_rows);
+		}
+		else if (needed_rows > sorted_rows) {
+			sorted_rows = proc_sorter(current_procs, sorting, reverse, tree, needed_rows, sorted_rows);
 		}
+		if (Global::debug) Runner::debug_stat("sorted rows", sorted_rows == SIZE_MAX ? "all"s : fmt::format("{}/{}", sorted_rows, current_procs.size()));
 
 		//* Generate tree view if enabled
 		if (tree and (not no_update or should_filter or sorted_change)) {
@@ -3277,7 +3276,7 @@ namespace Proc {
 							}
 						}
 					}
-					if (Config::ints.at("proc_selected") > 0) locate_selection = true;
+					if (Config::getI("proc_selected") > 0) locate_selection = true;
 				}
 				toggle_children = -1;
 			}
@@ -3294,15 +3293,12 @@ namespace Proc {
 					else if (expand > -1) {
 						collapser->collapsed = false;
 					}
-					if (Config::ints.at("proc_selected") > 0) locate_selection = true;
+					if (Config::getI("proc_selected") > 0) locate_selection = true;
 				}
 				collapse = expand = -1;
 			}
 			if (should_filter or not filter.empty()) filter_found = 0;
 
-			vector<tree_proc> tree_procs;
-			tree_procs.reserve(current_procs.size());
-
 			if (!pause_proc_list) {
 				for (auto& p : current_procs) {
 					//? Use O(1) set lookup instead of O(n) vector search
@@ -3310,32 +3306,18 @@ namespace Proc {
 				}
 			}
 
-			//? Stable sort to retain selected sorting among processes with the same parent
-			rng::stable_sort(current_procs, rng::less{}, & proc_info::ppid);
-
-			//? Start recursive iteration over processes with the lowest shared parent pids
-			for (auto& p : rng::equal_range(current_procs, current_procs.at(0).ppid, rng::less{}, &proc_info::ppid)) {
-				_tree_gen(p, current_procs, tree_procs, 0, false, filter, false, no_update, should_filter);
-			}
-
-			//? Recursive sort over tree structure to account for collapsed processes in the tree
-			int index = 0;
-			tree_sort(tree_procs, sorting, reverse, (pause_proc_list and not (sorted_change or tree_mode_change)), index, current_procs.size());
-
-			//? Recursive construction of ASCII tree prefixes.
-			for (auto t = tree_procs.begin(); t != tree_procs.end(); ++t) {
-				_collect_prefixes(*t, t == tree_procs.end() - 1);
-			}
-
-			//? Final sort based on tree index
-			rng::stable_sort(current_procs, rng::less {}, &proc_info::tree_index);
+			//? Build the tree from the parent pids, sort each level and order the list by tree position
+			process_tree.build(current_procs, sorting, reverse, (pause_proc_list and not (sorted_change or tree_mode_change)), filter, no_update, should_filter);
+			if (Global::debug) Runner::debug_stat("tree prefixes", to_string(process_tree.rebuilt_prefixes()));
 
 			//? Move current selection/view to the selected process when collapsing/expanding in the tree
 			if (locate_selection) {
 				int loc = rng::find(current_procs, Proc::selected_pid, &proc_info::pid)->tree_index;
-				if (Config::ints.at("proc_start") >= loc or Config::ints.at("proc_start") <= loc - Proc::select_max)
-					Config::ints.at("proc_start") = max(0, loc - 1);
-				Config::ints.at("proc_selected") = loc - Config::ints.at("proc_start") + 1;
+				//? Changes made on a collector thread aren't read back until the runner has them, so keep the new start here
+				int proc_start = Config::getI("proc_start");
+				if (proc_start >= loc or proc_start <= loc - Proc::select_max)
+					Config::set("proc_start", proc_start = max(0, loc - 1));
+				Config::set("proc_selected", loc - proc_start + 1);
 			}
 		}
 
@@ -0,0 +1,241 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <linux/cn_proc.h>
+#include <linux/connector.h>
+#include <linux/netlink.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "proc_events.hpp"
+#include "../mbtop_log.hpp"
+
+namespace ProcEvents {
+
+	void tracker::fork(size_t pid) {
+		live.insert(pid);
+		born.insert(pid);
+		if (resyncing) {
+			resync_forks.insert(pid);
+			resync_exits.erase(pid);
+		}
+	}
+
+	void tracker::exec(size_t pid) {
+		execs.push_back(pid);
+	}
+
+	void tracker::exit(size_t pid) {
+		live.erase(pid);
+		if (born.erase(pid) > 0) ++short_lived;
+		if (resyncing) {
+			resync_exits.insert(pid);
+			resync_forks.erase(pid);
+		}
+	}
+
+	void tracker::begin_resync() {
+		resync_forks.clear();
+		resync_exits.clear();
+		resyncing = true;
+		lost = false;
+	}
+
+	void tracker::resync(const std::vector<size_t>& scanned) {
+		live.clear();
+		for (const auto pid : scanned)
+			if (not resync_exits.contains(pid)) live.insert(pid);
+		live.insert(resync_forks.begin(), resync_forks.end());
+		resync_forks.clear();
+		resync_exits.clear();
+		resyncing = false;
+	}
+
+	bool tracker::pids(std::vector<size_t>& out) const {
+		if (lost or resyncing) return false;
+		out.assign(live.begin(), live.end());
+		std::ranges::sort(out);
+		return true;
+	}
+
+	void tracker::take_execs(std::vector<size_t>& out) {
+		out.swap(execs);
+		execs.clear();
+	}
+
+	uint64_t tracker::take_short_lived() noexcept {
+		born.clear();
+		return std::exchange(short_lived, 0);
+	}
+
+	namespace {
+		std::mutex mtx;
+		tracker state;
+		int sock = -1;
+		std::atomic<bool> active{}, failed{};
+		//? Declared last so it's joined before the state it uses is destroyed at exit
+		std::jthread listener;
+
+		bool send_op(proc_cn_mcast_op op) {
+			alignas(nlmsghdr) std::array<char, NLMSG_SPACE(sizeof(cn_msg) + sizeof(proc_cn_mcast_op))> buf{};
+			auto* hdr = reinterpret_cast<nlmsghdr*>(buf.data());
+			hdr->nlmsg_len = NLMSG_LENGTH(sizeof(cn_msg) + sizeof(op));
+			hdr->nlmsg_type = NLMSG_DONE;
+			auto* msg = static_cast<cn_msg*>(NLMSG_DATA(hdr));
+			msg->id.idx = CN_IDX_PROC;
+			msg->id.val = CN_VAL_PROC;
+			msg->len = sizeof(op);
+			std::memcpy(msg->data, &op, sizeof(op));
+			return send(sock, buf.data(), hdr->nlmsg_len, 0) >= 0;
+		}
+
+		//* Apply all events in a datagram, only whole processes are tracked so thread forks and exits are skipped
+		void apply(char* data, int len) {
+			for (auto* hdr = reinterpret_cast<nlmsghdr*>(data); NLMSG_OK(hdr, len); hdr = NLMSG_NEXT(hdr, len)) {
+				if (hdr->nlmsg_type == NLMSG_NOOP or hdr->nlmsg_type == NLMSG_ERROR) continue;
+				const auto* msg = static_cast<const cn_msg*>(NLMSG_DATA(hdr));
+				if (msg->id.idx != CN_IDX_PROC or msg->id.val != CN_VAL_PROC) continue;
+				const auto* event = reinterpret_cast<const proc_event*>(msg->data);
+				switch (event->what) {
+					case proc_event::PROC_EVENT_FORK:
+						if (event->event_data.fork.child_pid == event->event_data.fork.child_tgid)
+							state.fork(event->event_data.fork.child_tgid);
+						break;
+					case proc_event::PROC_EVENT_EXEC:
+						state.exec(event->event_data.exec.process_tgid);
+						break;
+					case proc_event::PROC_EVENT_EXIT:
+						if (event->event_data.exit.process_pid == event->event_data.exit.process_tgid)
+							state.exit(event->event_data.exit.process_tgid);
+						break;
+					default:
+						break;
+				}
+			}
+		}
+
+		void listen_loop(std::stop_token stop) {
+			//? Signals should only ever be delivered to the main and runner threads
+			sigset_t mask;
+			sigfillset(&mask);
+			pthread_sigmask(SIG_BLOCK, &mask, nullptr);
+
+			alignas(nlmsghdr) std::array<char, 16384> buf;
+			while (not stop.stop_requested()) {
+				const ssize_t len = recv(sock, buf.data(), buf.size(), 0);
+				if (len < 0) {
+					//? Receive timeout, gives the loop a chance to see a stop request
+					if (errno == EINTR or errno == EAGAIN or errno == EWOULDBLOCK) continue;
+					std::lock_guard lock(mtx);
+					state.overflow();
+					//? The socket buffer overflowed during a burst of events, the next collect does a full scan
+					if (errno == ENOBUFS) continue;
+					Logger::warning("Process events: recv failed ({}), falling back to /proc scan", strerror(errno));
+					failed = true;
+					break;
+				}
+				std::lock_guard lock(mtx);
+				apply(buf.data(), static_cast<int>(len));
+			}
+			active = false;
+		}
+	}
+
+	bool start() {
+		if (active) return true;
+		if (failed) return false;
+		stop();
+
+		sock = socket(PF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_CONNECTOR);
+		sockaddr_nl addr{};
+		addr.nl_family = AF_NETLINK;
+		addr.nl_groups = CN_IDX_PROC;
+
+		if (sock < 0 or bind(sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 or not send_op(PROC_CN_MCAST_LISTEN)) {
+			Logger::info("Process events unavailable ({}), using /proc scan", strerror(errno));
+			if (sock >= 0) close(sock);
+			sock = -1;
+			failed = true;
+			return false;
+		}
+
+		//? Room for a few thousand events between wakeups, SO_RCVBUFFORCE only works with CAP_NET_ADMIN
+		const int rcvbuf = 4 << 20;
+		if (setsockopt(sock, SOL_SOCKET, SO_RCVBUFFORCE, &rcvbuf, sizeof(rcvbuf)) < 0)
+			setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+		const timeval timeout{0, 250'000};
+		setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+		{
+			std::lock_guard lock(mtx);
+			state = {};
+		}
+		active = true;
+		listener = std::jthread(listen_loop);
+		Logger::debug("Process events: listening on netlink process connector");
+		return true;
+	}
+
+	void stop() {
+		if (listener.joinable()) listener = {};
+		if (sock >= 0) {
+			send_op(PROC_CN_MCAST_IGNORE);
+			close(sock);
+			sock = -1;
+		}
+		active = false;
+		failed = false;
+	}
+
+	bool running() noexcept { return active; }
+
+	void begin_resync() {
+		std::lock_guard lock(mtx);
+		state.begin_resync();
+	}
+
+	void resync(const std::vector<size_t>& scanned) {
+		std::lock_guard lock(mtx);
+		state.resync(scanned);
+	}
+
+	bool pids(std::vector<size_t>& out) {
+		std::lock_guard lock(mtx);
+		return state.pids(out);
+	}
+
+	void take_execs(std::vector<size_t>& out) {
+		std::lock_guard lock(mtx);
+		state.take_execs(out);
+	}
+
+	uint64_t take_short_lived() {
+		std::lock_guard lock(mtx);
+		return state.take_short_lived();
+	}
+}
@@ -0,0 +1,80 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+//* Incremental process tracking through the netlink process connector (PROC_EVENT_FORK, EXEC and EXIT)
+//* A listener thread applies events to a pid set as they arrive, Proc::collect reads the set instead of listing /proc.
+//* Subscribing needs CAP_NET_ADMIN on most kernels, start() returns false without it and callers keep scanning /proc.
+namespace ProcEvents {
+
+	//* Pid bookkeeping shared by the listener and the collector, kept separate from the socket so it can be tested
+	class tracker {
+		std::unordered_set<size_t> live;
+		std::unordered_set<size_t> born;		//? Forked since the last take_short_lived()
+		std::unordered_set<size_t> resync_forks, resync_exits;
+		std::vector<size_t> execs;				//? Called exec() since the last take_execs()
+		uint64_t short_lived{};
+		bool resyncing{};
+		bool lost{true};						//? Nothing is known until the first resync()
+	public:
+		void fork(size_t pid);
+		void exec(size_t pid);
+		void exit(size_t pid);
+
+		//* Events were dropped, the pid set can't be trusted until the next resync()
+		void overflow() noexcept { lost = true; }
+
+		//* Mark the start of a full /proc scan, events seen from now on are applied on top of the scan result
+		void begin_resync();
+
+		//* Replace the pid set with <scanned> plus the forks and exits seen since begin_resync()
+		void resync(const std::vector<size_t>& scanned);
+
+		//* Copy the tracked pids in ascending order to <out>, returns false if a full scan is needed
+		bool pids(std::vector<size_t>& out) const;
+
+		//* Move pids that called exec() since the last call to <out>
+		void take_execs(std::vector<size_t>& out);
+
+		//* Number of processes that were forked and exited again since the last call
+		uint64_t take_short_lived() noexcept;
+	};
+
+	//* Subscribe to process events and start the listener thread, returns false if the connector is unavailable
+	//* A failed attempt is remembered and not retried until stop() has been called
+	bool start();
+
+	//* Unsubscribe and stop the listener thread
+	void stop();
+
+	//* True while the listener thread is subscribed
+	bool running() noexcept;
+
+	//? Thread safe wrappers for the tracker owned by the listener
+	void begin_resync();
+	void resync(const std::vector<size_t>& scanned);
+	bool pids(std::vector<size_t>& out);
+	void take_execs(std::vector<size_t>& out);
+	uint64_t take_short_lived();
+}
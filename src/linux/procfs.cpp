@@ -0,0 +1,381 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "procfs.hpp"
+#include "../mbtop_tools.hpp"
+
+namespace Procfs {
+
+	namespace {
+		std::atomic<int> root_fd{-1};
+
+		//? Grown on demand and never shrunk, a few pages covers everything but smaps on most systems
+		thread_local std::string buffer(4096, '\0');
+
+		constexpr bool is_space(char c) noexcept { return c == ' ' or c == '\t' or c == '\n'; }
+
+		//* Scanner over a single line of whitespace separated fields
+		struct field_scanner {
+			const char* pos;
+			const char* end;
+
+			std::string_view next() noexcept {
+				while (pos < end and *pos == ' ') ++pos;
+				const char* start = pos;
+				while (pos < end and not is_space(*pos)) ++pos;
+				return {start, static_cast<size_t>(pos - start)};
+			}
+
+			void skip(int fields) noexcept {
+				for (; fields > 0; --fields) next();
+			}
+		};
+
+		//* "<pid>/<name>\0", pids are at most 7 digits on Linux but leave room for a full size_t
+		class pid_path {
+			std::array<char, 64> path;
+		public:
+			bool set(size_t pid, std::string_view name) noexcept {
+				if (name.size() > path.size() - 22) return false;
+				auto [ptr, ec] = std::to_chars(path.data(), path.data() + 20, pid);
+				if (ec != std::errc{}) return false;
+				*ptr++ = '/';
+				ptr = std::copy(name.begin(), name.end(), ptr);
+				*ptr = '\0';
+				return true;
+			}
+			const char* data() const noexcept { return path.data(); }
+		};
+
+		constexpr int64_t to_i64(std::string_view str) noexcept {
+			if (not str.empty() and str.front() == '-') return -static_cast<int64_t>(to_u64(str.substr(1)));
+			return static_cast<int64_t>(to_u64(str));
+		}
+	}
+
+	bool init(const std::string& path) {
+		const int fd = open_dir(path.c_str());
+		if (fd < 0) return false;
+		if (const int old = root_fd.exchange(fd); old >= 0) close(old);
+		return true;
+	}
+
+	int root() noexcept { return root_fd.load(std::memory_order_relaxed); }
+
+	int open_dir(const char* path) noexcept {
+		return open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	}
+
+	dir_lister::dir_lister(size_t size) : buf(std::make_unique<char[]>(size)), buf_size(size) {}
+
+	auto dir_lister::fill(int dir_fd, bool rewind) -> std::optional<std::span<const char>> {
+		if (rewind and lseek(dir_fd, 0, SEEK_SET) < 0) return std::nullopt;
+		for (;;) {
+			const long len = syscall(SYS_getdents64, dir_fd, buf.get(), buf_size);
+			if (len >= 0) return std::span<const char>(buf.get(), static_cast<size_t>(len));
+			if (errno != EINTR) return std::nullopt;
+		}
+	}
+
+	bool dir_lister::numbers(int dir_fd, std::vector<size_t>& out) {
+		return each(dir_fd, [&](std::string_view name, unsigned char) {
+			if (name.front() >= '0' and name.front() <= '9') out.push_back(to_u64(name));
+		});
+	}
+
+	void dir_lister::close_dir(int dir_fd) noexcept { close(dir_fd); }
+
+	auto read_at(int dir_fd, const char* name) -> std::optional<std::string_view> {
+		const int fd = openat(dir_fd, name, O_RDONLY | O_CLOEXEC);
+		if (fd < 0) return std::nullopt;
+
+		size_t len = 0;
+		for (;;) {
+			if (len == buffer.size()) buffer.resize(buffer.size() * 2);
+			const ssize_t n = read(fd, buffer.data() + len, buffer.size() - len);
+			if (n < 0) {
+				if (errno == EINTR) continue;
+				close(fd);
+				return std::nullopt;
+			}
+			if (n == 0) break;
+			len += static_cast<size_t>(n);
+		}
+		close(fd);
+		return std::string_view{buffer.data(), len};
+	}
+
+	auto read_pid(int dir_fd, size_t pid, std::string_view name) -> std::optional<std::string_view> {
+		pid_path path;
+		if (not path.set(pid, name)) return std::nullopt;
+		return read_at(dir_fd, path.data());
+	}
+
+	int open_pid(int dir_fd, size_t pid, std::string_view name) noexcept {
+		pid_path path;
+		if (not path.set(pid, name)) return -1;
+		return openat(dir_fd, path.data(), O_RDONLY | O_CLOEXEC);
+	}
+
+	auto read_fd(int fd) -> std::optional<std::string_view> {
+		for (;;) {
+			const ssize_t n = pread(fd, buffer.data(), buffer.size(), 0);
+			if (n < 0) {
+				if (errno == EINTR) continue;
+				return std::nullopt;
+			}
+			//? Files in /proc are generated in full on each read from offset 0, a short read means we got all of it
+			if (static_cast<size_t>(n) < buffer.size()) return std::string_view{buffer.data(), static_cast<size_t>(n)};
+			buffer.resize(buffer.size() * 2);
+		}
+	}
+
+	bool parse_stat(std::string_view buf, stat_fields& out) noexcept {
+		//? Field 2 is the command name in parentheses and may contain spaces and parentheses itself, skip past the last ')'
+		const auto comm_end = buf.rfind(')');
+		if (comm_end == std::string_view::npos) return false;
+		field_scanner scan{buf.data() + comm_end + 1, buf.data() + buf.size()};
+
+		auto state = scan.next(); //? 3: state
+		auto ppid = scan.next(); //? 4: ppid
+		scan.skip(9); //? 5-13
+		auto utime = scan.next(); //? 14: utime
+		auto stime = scan.next(); //? 15: stime
+		scan.skip(3); //? 16-18
+		auto nice = scan.next(); //? 19: nice
+		auto threads = scan.next(); //? 20: num_threads
+		scan.skip(1); //? 21
+		auto starttime = scan.next(); //? 22: starttime
+		scan.skip(1); //? 23
+		auto rss = scan.next(); //? 24: rss
+
+		if (state.empty() or rss.empty()) return false;
+
+		out.state = state.front();
+		out.ppid = to_u64(ppid);
+		out.utime = to_u64(utime);
+		out.stime = to_u64(stime);
+		out.nice = to_i64(nice);
+		out.threads = to_u64(threads);
+		out.starttime = to_u64(starttime);
+		out.rss_pages = to_u64(rss);
+		return true;
+	}
+
+	auto parse_statm_resident(std::string_view buf) noexcept -> std::optional<uint64_t> {
+		field_scanner scan{buf.data(), buf.data() + buf.size()};
+		scan.skip(1);
+		auto resident = scan.next();
+		if (resident.empty()) return std::nullopt;
+		return to_u64(resident);
+	}
+
+	auto parse_cpu_total(std::string_view buf) noexcept -> uint64_t {
+		buf = buf.substr(0, buf.find('\n'));
+		field_scanner scan{buf.data(), buf.data() + buf.size()};
+		scan.skip(1);
+		uint64_t total{};
+		for (auto field = scan.next(); not field.empty(); field = scan.next())
+			total += to_u64(field);
+		return total;
+	}
+
+	auto find_key(std::string_view buf, std::string_view key) noexcept -> std::string_view {
+		for (size_t line = 0; line < buf.size();) {
+			auto line_end = buf.find('\n', line);
+			if (line_end == std::string_view::npos) line_end = buf.size();
+
+			if (buf.compare(line, key.size(), key) == 0 and line + key.size() < line_end and buf[line + key.size()] == ':') {
+				size_t start = line + key.size() + 1;
+				while (start < line_end and is_space(buf[start])) ++start;
+				size_t stop = start;
+				while (stop < line_end and not is_space(buf[stop])) ++stop;
+				return buf.substr(start, stop - start);
+			}
+			line = line_end + 1;
+		}
+		return {};
+	}
+
+	auto sum_smaps_rss(std::string_view buf) noexcept -> uint64_t {
+		uint64_t total{};
+		for (size_t line = 0; line < buf.size();) {
+			auto line_end = buf.find('\n', line);
+			if (line_end == std::string_view::npos) line_end = buf.size();
+
+			if (buf.compare(line, 4, "Rss:") == 0) {
+				size_t start = line + 4;
+				while (start < line_end and is_space(buf[start])) ++start;
+				total += to_u64(buf.substr(start, line_end - start));
+			}
+			line = line_end + 1;
+		}
+		return total;
+	}
+
+	void cmdline_to(std::string_view buf, std::string& out, size_t max_len) {
+		out.clear();
+		if (buf.empty() or max_len == 0) return;
+
+		//? Arguments are NUL terminated, the last one might not be if the process rewrote its argv
+		if (buf.back() == '\0') buf.remove_suffix(1);
+		if (buf.size() >= max_len) buf = buf.substr(0, max_len - 1);
+
+		out.assign(buf);
+		for (auto& c : out) if (c == '\0') c = ' ';
+	}
+
+	void sample(int dir_fd, pid_sample& sample, uint64_t statm_min_pages) {
+		sample.reached = stage::none;
+		sample.stat = {};
+		sample.statm_pages.reset();
+		sample.opened_fd = -1;
+		sample.stale_fd = false;
+		sample.reused = false;
+
+		if (sample.with_names) {
+			auto comm = read_pid(dir_fd, sample.pid, "comm");
+			if (not comm) return;
+			sample.name.assign(comm->substr(0, comm->find('\n')));
+			sample.reached = stage::comm;
+
+			auto cmdline = read_pid(dir_fd, sample.pid, "cmdline");
+			if (not cmdline) return;
+			cmdline_to(*cmdline, sample.cmd);
+			sample.reached = stage::cmdline;
+
+			auto status = read_pid(dir_fd, sample.pid, "status");
+			if (not status) return;
+			sample.uid.assign(find_key(*status, "Uid"));
+			sample.reached = stage::status;
+		}
+
+		//? A cached descriptor stays tied to the process it was opened for and fails to read once that process has exited
+		std::optional<std::string_view> stat;
+		if (sample.stat_fd >= 0) {
+			stat = read_fd(sample.stat_fd);
+			sample.stale_fd = not stat.has_value();
+		}
+		if (not stat and sample.keep_stat_fd) {
+			if (const int fd = open_pid(dir_fd, sample.pid, "stat"); fd >= 0) {
+				if ((stat = read_fd(fd))) sample.opened_fd = fd;
+				else close(fd);
+			}
+		}
+		else if (not stat) stat = read_pid(dir_fd, sample.pid, "stat");
+		if (not stat) return;
+		sample.reached = stage::stat_read;
+		if (not parse_stat(*stat, sample.stat)) return;
+		sample.reached = stage::stat;
+
+		//? Same pid but a different start time, the process we knew exited and the pid was given to a new one
+		if (sample.starttime != 0 and sample.stat.starttime != sample.starttime and not sample.with_names) {
+			if (sample.opened_fd >= 0) close(sample.opened_fd);
+			sample.with_names = true;
+			sample.starttime = 0;
+			Procfs::sample(dir_fd, sample, statm_min_pages);
+			sample.reused = true;
+			return;
+		}
+
+		if (sample.stat.rss_pages >= statm_min_pages) {
+			if (auto statm = read_pid(dir_fd, sample.pid, "statm"))
+				sample.statm_pages = parse_statm_resident(*statm).value_or(0);
+		}
+	}
+
+	void sample_all(int dir_fd, std::span<pid_sample> samples, uint64_t statm_min_pages, Tools::WorkerPool* pool) {
+		auto run = [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) sample(dir_fd, samples[i], statm_min_pages);
+		};
+		//? Below a few hundred processes per shard the wakeup cost of the workers outweighs the gain
+		if (pool != nullptr) pool->parallel_for(samples.size(), run, 256);
+		else run(0, samples.size());
+	}
+
+	fd_cache::~fd_cache() {
+		for (const auto& [pid, item] : entries) close_fd(item.fd);
+	}
+
+	void fd_cache::close_fd(int fd) noexcept {
+		if (fd >= 0) close(fd);
+	}
+
+	int fd_cache::get(size_t pid, uint64_t starttime) {
+		auto it = entries.find(pid);
+		if (it == entries.end()) return -1;
+		if (it->second.starttime != starttime) {
+			close_fd(it->second.fd);
+			entries.erase(it);
+			return -1;
+		}
+		it->second.last_used = ++clock;
+		return it->second.fd;
+	}
+
+	void fd_cache::put(size_t pid, uint64_t starttime, int fd) {
+		erase(pid);
+		if (max_size == 0) {
+			close_fd(fd);
+			return;
+		}
+		//? Make room for a few more at once, every eviction scans the whole cache
+		if (entries.size() >= max_size) evict(max_size - std::max<size_t>(1, max_size / 16));
+		entries[pid] = {fd, starttime, ++clock};
+	}
+
+	void fd_cache::erase(size_t pid) {
+		if (auto it = entries.find(pid); it != entries.end()) {
+			close_fd(it->second.fd);
+			entries.erase(it);
+		}
+	}
+
+	void fd_cache::resize(size_t capacity) {
+		max_size = capacity;
+		if (entries.size() > max_size) evict(max_size);
+	}
+
+	void fd_cache::evict(size_t keep) {
+		scratch.clear();
+		for (const auto& [pid, item] : entries) scratch.emplace_back(item.last_used, pid);
+		const auto drop = scratch.size() - keep;
+		std::ranges::nth_element(scratch, scratch.begin() + drop);
+		for (size_t i = 0; i < drop; ++i) erase(scratch[i].second);
+	}
+
+	size_t fd_budget() noexcept {
+		//? Leave room for sockets, sensors and anything else mbtop opens, and never take more than half of the limit
+		constexpr rlim_t reserve = 256, max_budget = 1 << 16;
+		rlimit limit{};
+		if (getrlimit(RLIMIT_NOFILE, &limit) != 0 or limit.rlim_cur <= reserve) return 0;
+		if (limit.rlim_cur == RLIM_INFINITY) return max_budget;
+		return static_cast<size_t>(std::min((limit.rlim_cur - reserve) / 2, max_budget));
+	}
+}
@@ -0,0 +1,241 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Tools { class WorkerPool; }
+
+//* Allocation free readers and scanners for files in /proc
+//* All reads go through openat() relative to a directory fd and land in a per-thread buffer that is reused between calls,
+//* returned views are only valid until the next read on the same thread.
+namespace Procfs {
+
+	//* Fields of interest from /proc/[pid]/stat
+	struct stat_fields {
+		char state = '0';
+		uint64_t ppid{};
+		uint64_t utime{};
+		uint64_t stime{};
+		int64_t nice{};
+		uint64_t threads{};
+		uint64_t starttime{};
+		uint64_t rss_pages{};
+
+		bool operator==(const stat_fields&) const = default;
+	};
+
+	//* How far sample() got before a file was missing, in the order the files are read
+	enum class stage : uint8_t { none, comm, cmdline, status, stat_read, stat };
+
+	//* Everything Proc::collect reads from the files of a single process
+	struct pid_sample {
+		//? Input
+		size_t pid{};
+		bool with_names{};		//? Also read comm, cmdline and status, only needed the first time a process is seen
+		uint64_t starttime{};	//? Start time from the last update, a different value means the pid was reused, 0 if unknown
+		int stat_fd = -1;		//? Cached descriptor for stat, -1 to open it by path
+		bool keep_stat_fd{};	//? Leave a newly opened stat descriptor open in opened_fd for the caller to cache
+
+		//? Output
+		stage reached{};
+		std::string name;
+		std::string cmd;
+		std::string uid;
+		stat_fields stat;
+		std::optional<uint64_t> statm_pages;	//? Resident pages from statm, only read when stat rss looks wrong
+		int opened_fd = -1;		//? Descriptor opened because of keep_stat_fd, owned by the caller
+		bool stale_fd{};		//? stat_fd couldn't be read, the process it belonged to has exited
+		bool reused{};			//? stat start time doesn't match <starttime>
+
+		bool operator==(const pid_sample&) const = default;
+	};
+
+	//* LRU cache of open descriptors keyed by pid and process start time, not thread safe
+	class fd_cache {
+		struct entry {
+			int fd;
+			uint64_t starttime;
+			uint64_t last_used;
+		};
+		std::unordered_map<size_t, entry> entries;
+		std::vector<std::pair<uint64_t, size_t>> scratch;
+		size_t max_size{};
+		uint64_t clock{};
+
+		void evict(size_t keep);
+	public:
+		explicit fd_cache(size_t capacity = 0) : max_size(capacity) {}
+		~fd_cache();
+		fd_cache(const fd_cache& other) = delete;
+		fd_cache& operator=(const fd_cache& other) = delete;
+
+		//* Descriptor cached for <pid> and marks it as used, -1 if missing or cached for a different start time
+		int get(size_t pid, uint64_t starttime);
+
+		//* Take ownership of <fd> for <pid>, closing the least recently used descriptors first if the cache is full
+		void put(size_t pid, uint64_t starttime, int fd);
+
+		//* Close and forget the descriptor for <pid>
+		void erase(size_t pid);
+
+		//* Close descriptors of all pids that <keep> returns false for
+		template <typename Pred>
+		void retain(Pred keep) {
+			std::erase_if(entries, [&](const auto& item) {
+				if (keep(item.first)) return false;
+				close_fd(item.second.fd);
+				return true;
+			});
+		}
+
+		//* Change capacity, closing the least recently used descriptors if shrinking
+		void resize(size_t capacity);
+
+		size_t size() const noexcept { return entries.size(); }
+		size_t capacity() const noexcept { return max_size; }
+
+		static void close_fd(int fd) noexcept;
+	};
+
+	//* Number of descriptors that can be spent on caching, half of what RLIMIT_NOFILE leaves after a reserve for everything else
+	size_t fd_budget() noexcept;
+
+	//* Open the proc filesystem root at <path> and cache the directory fd, returns false on failure
+	bool init(const std::string& path);
+
+	//* Cached directory fd for the proc filesystem root, -1 if init() hasn't succeeded
+	int root() noexcept;
+
+	//* Open a directory and return its fd, -1 on failure
+	int open_dir(const char* path) noexcept;
+
+	//* Directory listing with getdents64() into a buffer that is reused between calls, not thread safe
+	//* Entry names are passed on as views into the buffer and are only valid during the callback.
+	class dir_lister {
+		std::unique_ptr<char[]> buf;
+		size_t buf_size;
+
+		//* Next batch of raw linux_dirent64 records from <dir_fd>, empty at the end and nullopt on error
+		auto fill(int dir_fd, bool rewind) -> std::optional<std::span<const char>>;
+	public:
+		explicit dir_lister(size_t size = 32768);
+
+		//* Call <fn> with the name and d_type of every entry in <dir_fd> except "." and "..", starting from the beginning
+		//* <fn> can return false to stop early, returns false if the directory couldn't be read
+		template <typename Fn>
+		bool each(int dir_fd, Fn&& fn) {
+			//? Layout of struct linux_dirent64 up to the name, d_ino and d_off aren't used
+			constexpr size_t reclen_offset = 16, type_offset = 18, name_offset = 19;
+			for (bool first = true;; first = false) {
+				const auto chunk = fill(dir_fd, first);
+				if (not chunk) return false;
+				if (chunk->empty()) return true;
+				for (size_t pos = 0; pos < chunk->size();) {
+					const char* record = chunk->data() + pos;
+					uint16_t reclen;
+					std::memcpy(&reclen, record + reclen_offset, sizeof(reclen));
+					pos += reclen;
+					const std::string_view name(record + name_offset);
+					if (name == "." or name == "..") continue;
+					const auto type = static_cast<unsigned char>(record[type_offset]);
+					if constexpr (std::is_same_v<std::invoke_result_t<Fn, std::string_view, unsigned char>, bool>) {
+						if (not fn(name, type)) return true;
+					}
+					else fn(name, type);
+				}
+			}
+		}
+
+		//* Same as each() for the directory at <path>
+		template <typename Fn>
+		bool each(const char* path, Fn&& fn) {
+			const int dir_fd = Procfs::open_dir(path);
+			if (dir_fd < 0) return false;
+			const bool ok = each(dir_fd, std::forward<Fn>(fn));
+			close_dir(dir_fd);
+			return ok;
+		}
+
+		//* Append all numeric entries of <dir_fd> to <out>, i.e. the pids in /proc or the thread ids in /proc/[pid]/task
+		bool numbers(int dir_fd, std::vector<size_t>& out);
+
+		static void close_dir(int dir_fd) noexcept;
+	};
+
+	//* Read the whole file <name> relative to <dir_fd> into the per-thread buffer
+	auto read_at(int dir_fd, const char* name) -> std::optional<std::string_view>;
+
+	//* Read /proc/<pid>/<name> relative to <dir_fd> into the per-thread buffer
+	auto read_pid(int dir_fd, size_t pid, std::string_view name) -> std::optional<std::string_view>;
+
+	//* Open /proc/<pid>/<name> relative to <dir_fd> for reading, -1 on failure
+	int open_pid(int dir_fd, size_t pid, std::string_view name) noexcept;
+
+	//* Read an already open file from offset 0 into the per-thread buffer with pread()
+	auto read_fd(int fd) -> std::optional<std::string_view>;
+
+	//* Parse the content of /proc/[pid]/stat, returns false if any field up to rss is missing or malformed
+	bool parse_stat(std::string_view buf, stat_fields& out) noexcept;
+
+	//* Parse resident pages (second field) from /proc/[pid]/statm
+	auto parse_statm_resident(std::string_view buf) noexcept -> std::optional<uint64_t>;
+
+	//* Sum of all numbers on the first line of /proc/stat, i.e. total cpu time in ticks
+	auto parse_cpu_total(std::string_view buf) noexcept -> uint64_t;
+
+	//* Return the first whitespace separated token after "<key>:" in a file formatted like /proc/[pid]/status
+	auto find_key(std::string_view buf, std::string_view key) noexcept -> std::string_view;
+
+	//* Sum of all "Rss:" entries in /proc/[pid]/smaps in kilobytes
+	auto sum_smaps_rss(std::string_view buf) noexcept -> uint64_t;
+
+	//* Convert NUL separated /proc/[pid]/cmdline to a space separated command in <out>, limited to <max_len> - 1 characters
+	void cmdline_to(std::string_view buf, std::string& out, size_t max_len = 1000);
+
+	//* Fill <sample> for sample.pid from the files in <dir_fd>/<pid>/, statm is read if stat rss is at least <statm_min_pages>
+	//* A reused pid is sampled again from scratch as a new process with reused set
+	void sample(int dir_fd, pid_sample& sample, uint64_t statm_min_pages);
+
+	//* Run sample() over all <samples>, split in contiguous shards across <pool> if given
+	//* Every sample only depends on its own files, so the result is identical to a serial run regardless of thread count
+	void sample_all(int dir_fd, std::span<pid_sample> samples, uint64_t statm_min_pages, Tools::WorkerPool* pool = nullptr);
+
+	//* Parse an unsigned decimal number, returns fallback if <str> doesn't start with a digit
+	constexpr uint64_t to_u64(std::string_view str, uint64_t fallback = 0) noexcept {
+		if (str.empty() or str.front() < '0' or str.front() > '9') return fallback;
+		uint64_t value{};
+		for (const char c : str) {
+			if (c < '0' or c > '9') break;
+			value = value * 10 + static_cast<uint64_t>(c - '0');
+		}
+		return value;
+	}
+}
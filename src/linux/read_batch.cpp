@@ -0,0 +1,269 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <span>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "read_batch.hpp"
+#include "../mbtop_log.hpp"
+
+namespace Procfs {
+
+	//* Minimal io_uring over the raw system calls, only what's needed to submit a batch of reads and wait for all of them
+	class read_batch::ring {
+		int fd = -1;
+		void* sq_map = MAP_FAILED;
+		void* cq_map = MAP_FAILED;
+		void* sqe_map = MAP_FAILED;
+		size_t sq_len{}, cq_len{}, sqe_len{};
+		unsigned* sq_tail{};
+		unsigned* sq_mask{};
+		unsigned* sq_array{};
+		unsigned* cq_head{};
+		unsigned* cq_tail{};
+		unsigned* cq_mask{};
+		io_uring_sqe* sqes{};
+		io_uring_cqe* cqes{};
+		unsigned entries{};
+
+		static int enter(int fd, unsigned submit, unsigned wait) noexcept {
+			return static_cast<int>(syscall(__NR_io_uring_enter, fd, submit, wait, IORING_ENTER_GETEVENTS, nullptr, 0));
+		}
+
+		//? Check that the kernel knows IORING_OP_READ (5.6+), older kernels accept the ring but fail every read
+		bool supports_read() const {
+			const size_t len = sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op);
+			auto probe = std::make_unique<char[]>(len);
+			std::memset(probe.get(), 0, len);
+			auto* p = reinterpret_cast<io_uring_probe*>(probe.get());
+			if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, p, 256) < 0) return false;
+			return p->last_op >= IORING_OP_READ and (p->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED);
+		}
+
+	public:
+		explicit ring(unsigned size) {
+			io_uring_params params{};
+			fd = static_cast<int>(syscall(__NR_io_uring_setup, size, &params));
+			if (fd < 0) return;
+			entries = params.sq_entries;
+
+			sq_len = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+			cq_len = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+			const bool single_map = params.features & IORING_FEAT_SINGLE_MMAP;
+			if (single_map) sq_len = cq_len = std::max(sq_len, cq_len);
+
+			sq_map = mmap(nullptr, sq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+			if (sq_map == MAP_FAILED) { close_ring(); return; }
+			cq_map = single_map ? sq_map
+				: mmap(nullptr, cq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+			if (cq_map == MAP_FAILED) { close_ring(); return; }
+			sqe_len = params.sq_entries * sizeof(io_uring_sqe);
+			sqe_map = mmap(nullptr, sqe_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+			if (sqe_map == MAP_FAILED) { close_ring(); return; }
+
+			auto* sq = static_cast<char*>(sq_map);
+			auto* cq = static_cast<char*>(cq_map);
+			sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+			sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+			sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+			cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+			cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+			cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+			cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+			sqes = static_cast<io_uring_sqe*>(sqe_map);
+
+			if (not supports_read()) close_ring();
+		}
+
+		~ring() { close_ring(); }
+		ring(const ring& other) = delete;
+		ring& operator=(const ring& other) = delete;
+
+		void close_ring() noexcept {
+			if (sqe_map != MAP_FAILED) munmap(sqe_map, sqe_len);
+			if (cq_map != MAP_FAILED and cq_map != sq_map) munmap(cq_map, cq_len);
+			if (sq_map != MAP_FAILED) munmap(sq_map, sq_len);
+			sq_map = cq_map = sqe_map = MAP_FAILED;
+			if (fd >= 0) close(fd);
+			fd = -1;
+		}
+
+		bool ok() const noexcept { return fd >= 0; }
+		unsigned capacity() const noexcept { return entries; }
+
+		//* Read every file in <batch> from offset 0 into its buffer, at most capacity() files per call
+		//* Returns false if the ring itself failed, <results> gets the byte count of each read or a negative errno
+		bool read_all(std::span<file*> batch, std::span<ssize_t> results) {
+			const unsigned tail = __atomic_load_n(sq_tail, __ATOMIC_RELAXED);
+			for (unsigned i = 0; i < batch.size(); i++) {
+				const unsigned index = (tail + i) & *sq_mask;
+				auto& sqe = sqes[index];
+				std::memset(&sqe, 0, sizeof(sqe));
+				sqe.opcode = IORING_OP_READ;
+				sqe.fd = batch[i]->fd;
+				sqe.addr = reinterpret_cast<uintptr_t>(batch[i]->buf.data());
+				sqe.len = static_cast<unsigned>(batch[i]->buf.size());
+				sqe.off = 0;
+				sqe.user_data = i;
+				sq_array[index] = index;
+			}
+			__atomic_store_n(sq_tail, tail + static_cast<unsigned>(batch.size()), __ATOMIC_RELEASE);
+
+			std::ranges::fill(results, -1);
+			unsigned submitted = 0, reaped = 0;
+			while (reaped < batch.size()) {
+				const int ret = enter(fd, static_cast<unsigned>(batch.size()) - submitted, static_cast<unsigned>(batch.size()) - reaped);
+				if (ret < 0) {
+					if (errno == EINTR) continue;
+					return false;
+				}
+				submitted += static_cast<unsigned>(ret);
+
+				unsigned head = __atomic_load_n(cq_head, __ATOMIC_RELAXED);
+				const unsigned ready = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+				for (; head != ready; head++, reaped++) {
+					const auto& cqe = cqes[head & *cq_mask];
+					if (cqe.user_data < results.size()) results[cqe.user_data] = cqe.res;
+				}
+				__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+			}
+			return true;
+		}
+	};
+
+	read_batch::read_batch() = default;
+
+	read_batch::~read_batch() { clear(); }
+
+	bool read_batch::uring_supported() {
+		static const bool supported = ring(1).ok();
+		return supported;
+	}
+
+	void read_batch::clear() {
+		for (auto& [path, f] : files)
+			if (f.fd >= 0) close(f.fd);
+		files.clear();
+		pending.clear();
+	}
+
+	void read_batch::read_now(file& f) {
+		f.ok = false;
+		if (f.fd < 0) return;
+		if (f.buf.empty()) f.buf.resize(4096);
+		for (;;) {
+			const ssize_t len = pread(f.fd, f.buf.data(), f.buf.size(), 0);
+			if (len < 0) {
+				if (errno == EINTR) continue;
+				//? The file is gone, e.g. an unplugged device, reopened by the next read() asking for it
+				close(f.fd);
+				f.fd = -1;
+				return;
+			}
+			//? A full buffer might mean a truncated read, grow it and read again
+			if (static_cast<size_t>(len) == f.buf.size()) {
+				f.buf.resize(f.buf.size() * 2);
+				continue;
+			}
+			f.len = static_cast<size_t>(len);
+			f.ok = true;
+			return;
+		}
+	}
+
+	void read_batch::run(bool use_uring) {
+		pending.clear();
+		for (auto it = files.begin(); it != files.end();) {
+			auto& f = it->second;
+			if (not f.used) {
+				if (f.fd >= 0) close(f.fd);
+				it = files.erase(it);
+				continue;
+			}
+			f.used = false;
+			f.ok = false;
+			if (f.fd >= 0) pending.push_back(&f);
+			++it;
+		}
+		last_reads = pending.size();
+		last_syscalls = 0;
+
+		if (not use_uring) uring.reset();
+		else if (uring == nullptr and not uring_failed) {
+			uring = std::make_unique<ring>(64);
+			if (not uring->ok()) {
+				Logger::info("io_uring unavailable ({}), reading files one by one", strerror(errno));
+				uring.reset();
+				uring_failed = true;
+			}
+		}
+
+		if (uring != nullptr) {
+			std::vector<ssize_t> results;
+			for (size_t start = 0; start < pending.size(); start += uring->capacity()) {
+				const auto chunk = std::span(pending).subspan(start, std::min<size_t>(uring->capacity(), pending.size() - start));
+				results.resize(chunk.size());
+				if (not uring->read_all(chunk, results)) {
+					Logger::warning("io_uring read failed ({}), reading files one by one", strerror(errno));
+					uring.reset();
+					uring_failed = true;
+					break;
+				}
+				last_syscalls++;
+				for (size_t i = 0; i < chunk.size(); i++) {
+					auto& f = *chunk[i];
+					if (results[i] >= 0 and static_cast<size_t>(results[i]) < f.buf.size()) {
+						f.len = static_cast<size_t>(results[i]);
+						f.ok = true;
+					}
+					//? Failed or possibly truncated, sort it out with regular reads
+					else {
+						read_now(f);
+						last_syscalls++;
+					}
+				}
+			}
+			if (uring != nullptr) return;
+		}
+
+		for (auto* f : pending) {
+			if (f->ok) continue;
+			read_now(*f);
+			last_syscalls++;
+		}
+	}
+
+	auto read_batch::read(const std::string& path) -> std::optional<std::string_view> {
+		auto& f = files[path];
+		f.used = true;
+		if (not f.ok) {
+			if (f.fd < 0) f.fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+			read_now(f);
+			if (not f.ok) return std::nullopt;
+		}
+		return std::string_view(f.buf.data(), f.len);
+	}
+}
@@ -0,0 +1,82 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Procfs {
+
+	//* Small files in /proc and /sys that a collector reads every update, kept open and read together in run()
+	//* With io_uring enabled all reads of a run are submitted and reaped with a single io_uring_enter(),
+	//* otherwise, or if the kernel or a seccomp filter refuses io_uring, every file is read with one pread().
+	//* Not thread safe, each collector owns its own batch.
+	class read_batch {
+		struct file {
+			int fd = -1;
+			std::string buf;
+			size_t len{};
+			bool ok{};		//? Read successfully in the last run
+			bool used{};	//? Asked for since the last run
+		};
+		std::unordered_map<std::string, file> files;
+		std::vector<file*> pending;
+
+		class ring;
+		std::unique_ptr<ring> uring;
+		bool uring_failed{};
+
+		size_t last_reads{}, last_syscalls{};
+
+		static void read_now(file& f);
+	public:
+		read_batch();
+		~read_batch();
+		read_batch(const read_batch& other) = delete;
+		read_batch& operator=(const read_batch& other) = delete;
+
+		//* Read all files used since the previous run, closing the ones that weren't
+		//* io_uring is set up on first use with <use_uring> and torn down again when it's turned off
+		void run(bool use_uring);
+
+		//* Content of <path> from the last run(), a path not seen before is opened and read right away and joins the next run
+		//* The view stays valid until the next run() or until the same path is read again, nullopt if it can't be read
+		auto read(const std::string& path) -> std::optional<std::string_view>;
+		auto read(const std::filesystem::path& path) -> std::optional<std::string_view> { return read(path.native()); }
+
+		//* Close all files
+		void clear();
+
+		//* True if the last run() went through io_uring
+		bool uses_uring() const noexcept { return uring != nullptr; }
+
+		size_t size() const noexcept { return files.size(); }
+		size_t last_read_count() const noexcept { return last_reads; }
+		size_t last_syscall_count() const noexcept { return last_syscalls; }
+
+		//* Check if io_uring can be set up and supports IORING_OP_READ, the result is cached
+		static bool uring_supported();
+	};
+}
@@ -19,11 +19,14 @@ tab-size = 4
 #include "mbtop.hpp"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <csignal>
 #include <clocale>
 #include <filesystem>
 #include <iterator>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <pthread.h>
 #include <span>
@@ -38,6 +41,8 @@ tab-size = 4
 #include <cmath>
 #include <iostream>
 #include <exception>
+#include <functional>
+#include <future>
 #include <tuple>
 #include <regex>
 #include <chrono>
@@ -62,6 +67,7 @@ tab-size = 4
 #include "mbtop_cli.hpp"
 #include "mbtop_config.hpp"
 #include "mbtop_draw.hpp"
+#include "mbtop_framebuffer.hpp"
 #include "mbtop_input.hpp"
 #include "mbtop_log.hpp"
 #include "mbtop_menu.hpp"
@@ -69,6 +75,7 @@ tab-size = 4
 #include "mbtop_socket.hpp"
 #include "mbtop_theme.hpp"
 #include "mbtop_tools.hpp"
+#include "mbtop_writer.hpp"
 
 using std::atomic;
 using std::cout;
@@ -156,7 +163,7 @@ void term_resize(bool force) {
 	Global::resized = true;
 	if (Runner::active) Runner::stop();
 	Term::refresh();
-	Config::unlock();
+	Config::merge();
 
 	auto boxes = Config::getS("shown_boxes");
 	auto min_size = Term::get_min_size(boxes);
@@ -513,6 +520,7 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 		gain_priv& operator=(gain_priv&& other) = delete;
 	};
 
+	//? Frame being drawn, the box draw functions append to it directly and it keeps its capacity between frames
 	string output;
 	string empty_bg;
 	bool pause_output{};
@@ -535,6 +543,83 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 
 	string debug_bg;
 	std::unordered_map<string, array<uint64_t, 2>> debug_times;
+#ifdef MBTOP_ALLOC_STATS
+	uint64_t draw_allocations{}, draw_allocations_begin{};
+#endif
+
+	//? Extra debug overlay lines by name, sorted so lines keep their place between frames
+	std::mutex debug_stats_mtx;
+	std::map<string, string> debug_stats;
+	size_t debug_stat_lines{};
+
+	void debug_stat(const string& name, string value) {
+		if (not Global::debug) return;
+		std::lock_guard lock(debug_stats_mtx);
+		debug_stats[name] = std::move(value);
+	}
+
+	//? What's on the terminal, kept up to date with everything written through write_screen()
+	static Term::FrameBuffer screen;
+	static Term::OutputMinimizer minimizer;
+	static std::mutex screen_mtx;
+	static bool screen_sync{};
+
+	//? Writes frames from its own thread, frames the terminal isn't ready for go out coalesced with the catch up write
+	static Term::Writer writer;
+	static string frame_out;
+
+	//* Changes to the screen since the last write that reached the writer, called by the writer when it dropped frames
+	static void catch_up(string& out) {
+		std::lock_guard lock(screen_mtx);
+		if (screen_sync) out += Term::sync_start;
+		const size_t start = out.size();
+		screen.flush(out);
+		minimizer.invalidate();
+		if (out.size() == start) out.clear();
+		else if (screen_sync) out += Term::sync_end;
+	}
+
+	//* Write <out> to the terminal, with diff_output only the cells it changes, returns the number of bytes written
+	//* Returns without writing anything while the terminal is still busy with an earlier frame, the changes are then
+	//* kept in the frame buffer and written as soon as it's done
+	static size_t write_screen(const string& out) {
+		const bool term_sync = Config::getB("terminal_sync");
+		std::lock_guard lock(screen_mtx);
+		if (not writer.started()) writer.start(STDOUT_FILENO, catch_up);
+		screen_sync = term_sync;
+		screen.resize(Term::width, Term::height);
+		minimizer.resize(Term::width, Term::height);
+		screen.write(out);
+		if (not writer.reserve()) return 0;
+
+		frame_out.clear();
+		if (term_sync) frame_out += Term::sync_start;
+		const size_t start = frame_out.size();
+		if (not Config::getB("diff_output")) {
+			screen.sync();
+			if (Config::getB("minimize_output")) frame_out += minimizer.minimize(out);
+			else {
+				minimizer.invalidate();
+				frame_out += out;
+			}
+		}
+		else {
+			//? The frame buffer already writes the smallest SGR changes, the minimizer only has to know it lost track
+			minimizer.invalidate();
+			screen.flush(frame_out);
+		}
+		const size_t written = frame_out.size() - start;
+		if (written == 0) frame_out.clear();
+		else if (term_sync) frame_out += Term::sync_end;
+		writer.submit(frame_out);
+		return written;
+	}
+
+	void invalidate_screen() {
+		std::lock_guard lock(screen_mtx);
+		screen.invalidate();
+		minimizer.invalidate();
+	}
 
 	class MyNumPunct : public std::numpunct<char>
 	{
@@ -601,19 +686,78 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 				return;
 			case draw_begin_only:
 				debug_times[name].at(draw) = time_micros();
+			#ifdef MBTOP_ALLOC_STATS
+				draw_allocations_begin = thread_allocations();
+			#endif
 				return;
 			case draw_begin:
 				debug_times[name].at(draw) = time_micros();
 				debug_times[name].at(collect) = debug_times[name].at(draw) - debug_times[name].at(collect);
 				debug_times["total"].at(collect) += debug_times[name].at(collect);
+			#ifdef MBTOP_ALLOC_STATS
+				draw_allocations_begin = thread_allocations();
+			#endif
 				return;
 			case draw_done:
 				debug_times[name].at(draw) = time_micros() - debug_times[name].at(draw);
 				debug_times["total"].at(draw) += debug_times[name].at(draw);
+			#ifdef MBTOP_ALLOC_STATS
+				draw_allocations += thread_allocations() - draw_allocations_begin;
+			#endif
 				return;
 		}
 	}
 
+	//? Threads running box collectors, never destroyed since a collector might still be running when the process exits
+	static auto& box_pool = *new Tools::WorkerPool();
+	static constexpr size_t box_pool_threads = 4;
+
+	//* Collector for a single box running on box_pool, waited for on destruction so no collector outlives its frame
+	class box_collect {
+		std::future<void> done;
+		uint64_t micros{};
+	public:
+		box_collect() = default;
+		box_collect(const box_collect& other) = delete;
+		box_collect& operator=(const box_collect& other) = delete;
+		~box_collect() { if (done.valid()) done.wait(); }
+
+		void start(std::function<void()> collect) {
+			done = box_pool.submit([this, snapshot = Config::view, collect = std::move(collect)] {
+				Config::cycle_view config_view(snapshot, true);
+				const uint64_t start = time_micros();
+				collect();
+				micros = time_micros() - start;
+			});
+		}
+
+		//* Wait for the collector without taking its result, options it changed are read from here on
+		void wait() {
+			if (not done.valid()) return;
+			done.wait();
+			Config::sync_view();
+		}
+
+		//* Wait for the collector, rethrow anything it threw and report its time as the collect time of <name>
+		void get(const char* name) {
+			if (not done.valid()) return;
+			done.get();
+			Config::sync_view();
+			if (Global::debug) {
+				debug_times[name].at(collect) = micros;
+				debug_times["total"].at(collect) += micros;
+			}
+		}
+	};
+
+	//? Collector data version each box was last drawn with
+	static struct { uint64_t cpu, mem, net, proc; } drawn_version{};
+
+	//* Graphs only take new values when the collector stored a new sample since the box was last drawn
+	static bool same_data(uint64_t& drawn, uint64_t version) {
+		return std::exchange(drawn, version) == version;
+	}
+
 	//? ------------------------------- Secondary thread: async launcher and drawing ----------------------------------
 	static void * _runner(void *) {
 		//? Block some signals in this thread to avoid deadlock from any signal handlers trying to stop this thread
@@ -660,6 +804,9 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 			//? Atomic lock used for blocking non thread-safe actions in main thread
 			atomic_lock lck(active);
 
+			//? Options are read from the snapshot published by run() for the rest of the cycle
+			Config::cycle_view config_view(Config::acquire());
+
 			//? Set effective user if SUID bit is set
 			gain_priv powers{};
 
@@ -667,23 +814,32 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 
 			//! DEBUG stats
 			if (Global::debug) {
-                if (debug_bg.empty() or redraw)
+				std::lock_guard lock(debug_stats_mtx);
+                if (debug_bg.empty() or redraw or debug_stat_lines != debug_stats.size()) {
+					debug_stat_lines = debug_stats.size();
                     Runner::debug_bg = Draw::createBox(2, 2, 33,
 					#ifdef GPU_SUPPORT
-						9,
+						9 + (int)debug_stat_lines,
 					#else
-						8,
+						8 + (int)debug_stat_lines,
 					#endif
 					"", true, "μs");
+				}
 
 				debug_times.clear();
 				debug_times["total"] = {0, 0};
+			#ifdef MBTOP_ALLOC_STATS
+				draw_allocations = 0;
+			#endif
 			}
 
 			output.clear();
 
 			//* Run collection and draw functions for all boxes
 			try {
+				//? Collectors of all shown boxes are started at once and the boxes are drawn in the usual order as their data is ready
+				box_pool.resize(Config::getB("concurrent_collect") ? box_pool_threads : 0);
+				const uint64_t collect_start = Global::debug ? time_micros() : 0;
 			#ifdef GPU_SUPPORT
 				//? GPU data collection
 				const bool gpu_in_cpu_panel = Gpu::gpu_names.size() > 0 and (
@@ -698,13 +854,26 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 					if (box.starts_with("gpu"))
 						gpu_panels.push_back(box.back()-'0');
 
-				vector<Gpu::gpu_info> gpus;
-				if (gpu_in_cpu_panel or not gpu_panels.empty()) {
-					if (Global::debug) debug_timer("gpu", collect_begin);
-					gpus = Gpu::collect(conf.no_update);
-					if (Global::debug) debug_timer("gpu", collect_done);
-				}
-				auto& gpus_ref = gpus;
+				//? Collected data is borrowed from the collectors, it's only written again by the next collect
+				static const vector<Gpu::gpu_info> no_gpus;
+				const vector<Gpu::gpu_info>* gpus = &no_gpus;
+				box_collect gpu_task;
+				if (gpu_in_cpu_panel or not gpu_panels.empty())
+					gpu_task.start([&] { gpus = &Gpu::collect(conf.no_update); });
+			#endif
+				const Cpu::cpu_info* cpu = nullptr;
+				const Mem::mem_info* mem = nullptr;
+				const Net::net_info* net = nullptr;
+				const vector<Proc::proc_info>* proc = nullptr;
+				box_collect cpu_task, mem_task, net_task, proc_task;
+				if (v_contains(conf.boxes, "cpu")) cpu_task.start([&] { cpu = &Cpu::collect(conf.no_update); });
+				if (v_contains(conf.boxes, "mem")) mem_task.start([&] { mem = &Mem::collect(conf.no_update); });
+				if (v_contains(conf.boxes, "net")) net_task.start([&] { net = &Net::collect(conf.no_update); });
+				if (v_contains(conf.boxes, "proc")) proc_task.start([&] { proc = &Proc::collect(conf.no_update); });
+
+			#ifdef GPU_SUPPORT
+				gpu_task.get("gpu");
+				const auto& gpus_ref = *gpus;
 			#else
 				vector<Gpu::gpu_info> gpus_ref{};
 			#endif
@@ -712,23 +881,25 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 				//? CPU
 				if (v_contains(conf.boxes, "cpu")) {
 					try {
-						if (Global::debug) debug_timer("cpu", collect_begin);
-
-						//? Start collect
-						auto cpu = Cpu::collect(conf.no_update);
+						cpu_task.get("cpu");
 
 						if (coreNum_reset) {
 							coreNum_reset = false;
+							//? More cores were found, published once the other collectors that read the count are done
+							mem_task.wait();
+							net_task.wait();
+							proc_task.wait();
+							Shared::coreCount = cpu->core_percent.size();
 							Cpu::core_mapping = Cpu::get_core_mapping();
 							Global::resized = true;
 							Input::interrupt();
 							continue;
 						}
 
-						if (Global::debug) debug_timer("cpu", draw_begin);
+						if (Global::debug) debug_timer("cpu", draw_begin_only);
 
 						//? Draw box
-						if (not pause_output) output += Cpu::draw(cpu, gpus_ref, conf.force_redraw, conf.no_update);
+						if (not pause_output) Cpu::draw(output, *cpu, gpus_ref, conf.force_redraw, same_data(drawn_version.cpu, Cpu::data_version));
 
 						if (Global::debug) debug_timer("cpu", draw_done);
 					}
@@ -745,7 +916,7 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 						//? Draw box
 						if (not pause_output)
 							for (unsigned long i = 0; i < gpu_panels.size(); ++i)
-								output += Gpu::draw(gpus_ref[gpu_panels[i]], i, conf.force_redraw, conf.no_update);
+								Gpu::draw(output, gpus_ref[gpu_panels[i]], i, conf.force_redraw, conf.no_update);
 
 						if (Global::debug) debug_timer("gpu", draw_done);
 					}
@@ -760,7 +931,7 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 						if (Global::debug) debug_timer("pwr", draw_begin_only);
 
 						//? Draw box (no collect needed, data comes from Shared namespace)
-						if (not pause_output) output += Pwr::draw(conf.force_redraw, conf.no_update);
+						if (not pause_output) Pwr::draw(output, conf.force_redraw, conf.no_update);
 
 						if (Global::debug) debug_timer("pwr", draw_done);
 					}
@@ -772,15 +943,12 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 				//? MEM
 				if (v_contains(conf.boxes, "mem")) {
 					try {
-						if (Global::debug) debug_timer("mem", collect_begin);
-
-						//? Start collect
-						auto mem = Mem::collect(conf.no_update);
+						mem_task.get("mem");
 
-						if (Global::debug) debug_timer("mem", draw_begin);
+						if (Global::debug) debug_timer("mem", draw_begin_only);
 
 						//? Draw box
-						if (not pause_output) output += Mem::draw(mem, conf.force_redraw, conf.no_update);
+						if (not pause_output) Mem::draw(output, *mem, conf.force_redraw, same_data(drawn_version.mem, Mem::data_version));
 
 						if (Global::debug) debug_timer("mem", draw_done);
 					}
@@ -792,15 +960,12 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 				//? NET
 				if (v_contains(conf.boxes, "net")) {
 					try {
-						if (Global::debug) debug_timer("net", collect_begin);
+						net_task.get("net");
 
-						//? Start collect
-						auto net = Net::collect(conf.no_update);
-
-						if (Global::debug) debug_timer("net", draw_begin);
+						if (Global::debug) debug_timer("net", draw_begin_only);
 
 						//? Draw box
-						if (not pause_output) output += Net::draw(net, conf.force_redraw, conf.no_update);
+						if (not pause_output) Net::draw(output, *net, conf.force_redraw, same_data(drawn_version.net, Net::data_version));
 
 						if (Global::debug) debug_timer("net", draw_done);
 					}
@@ -812,15 +977,12 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 				//? PROC
 				if (v_contains(conf.boxes, "proc")) {
 					try {
-						if (Global::debug) debug_timer("proc", collect_begin);
-
-						//? Start collect
-						auto proc = Proc::collect(conf.no_update);
+						proc_task.get("proc");
 
-						if (Global::debug) debug_timer("proc", draw_begin);
+						if (Global::debug) debug_timer("proc", draw_begin_only);
 
 						//? Draw box
-						if (not pause_output) output += Proc::draw(proc, conf.force_redraw, conf.no_update);
+						if (not pause_output) Proc::draw(output, *proc, conf.force_redraw, same_data(drawn_version.proc, Proc::data_version));
 
 						if (Global::debug) debug_timer("proc", draw_done);
 					}
@@ -829,20 +991,30 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 					}
 				}
 
-				//? Logs panel (tied to Proc, shown via key 8)
-				if (Logs::shown) {
+				//? Time from starting the collectors until the last box was drawn, compare with the sum of collect and draw times
+				if (Global::debug) debug_stat("boxes wall", fmt::format("{} μs", time_micros() - collect_start));
+
+				//? Logs panel (tied to Proc, shown via key 8), only updated along with the proc box
+				if (Logs::shown and (v_contains(conf.boxes, "proc") or conf.force_redraw)) {
 					try {
 						//? Collect logs from macOS unified logging
 						Logs::collect();
 
 						//? Draw logs panel
-						if (not pause_output) output += Logs::draw(conf.force_redraw, conf.no_update);
+						if (Global::debug) debug_timer("logs", draw_begin_only);
+						if (not pause_output) Logs::draw(output, conf.force_redraw, conf.no_update);
+						if (Global::debug) debug_timer("logs", draw_done);
 					}
 					catch (const std::exception& e) {
 						throw std::runtime_error("Logs:: -> " + string{e.what()});
 					}
 				}
 
+			#ifdef MBTOP_ALLOC_STATS
+				//? Heap allocations made while drawing the boxes
+				if (Global::debug) debug_stat("draw allocs", to_string(draw_allocations));
+			#endif
+
 			}
 			catch (const std::exception& e) {
 				Global::exit_error_msg = "Exception in runner thread -> " + string{e.what()};
@@ -914,19 +1086,25 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 						"draw"_a = time_draw
 					);
 				}
+				output += Fx::ub;
+				std::lock_guard lock(debug_stats_mtx);
+				for (const auto& [name, value] : debug_stats | std::views::take(debug_stat_lines)) {
+					output += fmt::format("{mvLD}{name:13.13} {value:>17.17}",
+						"mvLD"_a = Mv::l(31) + Mv::d(1),
+						"name"_a = name,
+						"value"_a = value
+					);
+				}
 			}
 
 			//? If overlay isn't empty, print output without color and then print overlay on top
-			const bool term_sync = Config::getB("terminal_sync");
-
 			//? Add read-only message overlay if timer is active
-			string final_output = conf.overlay.empty()
-				? output
-				: (output.empty() ? "" : Fx::ub + Theme::c("inactive_fg") + Fx::uncolor(output)) + conf.overlay;
+			if (not conf.overlay.empty())
+				output = (output.empty() ? "" : Fx::ub + Theme::c("inactive_fg") + Fx::uncolor(output)) + conf.overlay;
 
 			if (Global::read_only_msg_until > 0) {
 				if (Tools::time_ms() < Global::read_only_msg_until) {
-					final_output += Draw::read_only_overlay();
+					output += Draw::read_only_overlay();
 				} else {
 					Global::read_only_msg_until = 0;  //? Clear the timer
 					//? Clear only the exact message box area
@@ -940,22 +1118,103 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 					const string clear_box = string(box_width, ' ');
 					for (int line = y - 1; line < y - 1 + box_height; line++) {
 						if (line >= 1 and line <= Term::height) {
-							final_output += Mv::to(line, x) + clear_box;
+							output += Mv::to(line, x) + clear_box;
 						}
 					}
 					Global::resized = true;  //? Trigger full redraw to restore content
 				}
 			}
 
-			cout << (term_sync ? Term::sync_start : "") << final_output
-				<< (term_sync ? Term::sync_end : "") << flush;
+			const size_t written = write_screen(output);
+			if (Global::debug) {
+				const auto counters = writer.get_counters();
+				debug_stat("frame bytes", fmt::format("{} of {}", written, output.size()));
+				debug_stat("out dropped", to_string(counters.dropped));
+				debug_stat("out coalesced", to_string(counters.coalesced));
+				debug_stat("out stalls", to_string(counters.stalls));
+			}
 		}
 		//* ----------------------------------------------- THREAD LOOP -----------------------------------------------
 		return {};
 	}
 	//? ------------------------------------------ Secondary thread end -----------------------------------------------
 
-	//* Runs collect and draw in a secondary thread, unlocks and locks config to update cached values
+	//? Boxes by timer id with the option holding their update interval, gpu and pwr boxes share the last timer
+	struct timed_box {
+		std::string_view box, option;
+	};
+	static constexpr std::array<timed_box, 5> timed_boxes = {{
+		{"cpu", "cpu_update_ms"}, {"mem", "mem_update_ms"}, {"net", "net_update_ms"}, {"proc", "proc_update_ms"}, {"gpu", "update_ms"}
+	}};
+	static Tools::TimerWheel box_timers;
+	static bool timers_started{};
+
+	//? Boxes passed to the runner thread by run("due")
+	static vector<string> due_boxes;
+
+	static size_t box_timer(const string& box) {
+		for (size_t id = 0; id < timed_boxes.size() - 1; ++id)
+			if (box == timed_boxes[id].box) return id;
+		return timed_boxes.size() - 1;
+	}
+
+	//* Update interval of timer <id>, the box's own setting or update_ms if that is 0
+	static uint64_t box_interval(size_t id) {
+		if (const int ms = Config::getI(timed_boxes[id].option); ms > 0) return ms;
+		return Config::getI("update_ms");
+	}
+
+	//* Arm the timers of shown boxes and disarm the rest, a timer whose interval changed starts over from <now>
+	static void sync_timers(uint64_t now) {
+		std::array<bool, timed_boxes.size()> shown{};
+		for (const auto& box : Config::current_boxes) shown[box_timer(box)] = true;
+		//? Keep redrawing the "No boxes shown!" screen at update_ms
+		if (Config::current_boxes.empty()) shown.back() = true;
+
+		for (size_t id = 0; id < timed_boxes.size(); ++id) {
+			if (not shown[id]) {
+				box_timers.cancel(id);
+				continue;
+			}
+			const uint64_t interval = box_interval(id);
+			//? Everything is due right away on start, boxes shown later were just drawn by whatever showed them
+			if (not box_timers.armed(id))
+				box_timers.set(id, interval, timers_started ? now + interval : now);
+			else if (box_timers.interval(id) != interval)
+				box_timers.set(id, interval, now + interval);
+			//? Due further away than its interval, the system clock was turned back
+			else if (box_timers.due(id) > now + interval)
+				box_timers.set(id, interval, now);
+		}
+		timers_started = true;
+	}
+
+	void update() {
+		const uint64_t now = time_ms();
+		sync_timers(now);
+		static vector<size_t> fired;
+		fired.clear();
+		box_timers.expire(now, fired);
+		if (fired.empty()) return;
+		if (Config::current_boxes.empty()) return run("all");
+
+		due_boxes.clear();
+		for (const auto& box : Config::current_boxes)
+			if (v_contains(fired, box_timer(box))) due_boxes.push_back(box);
+		if (Global::debug) {
+			string names;
+			for (const auto& box : due_boxes) names += (names.empty() ? "" : " ") + box;
+			debug_stat("due boxes", names);
+		}
+		run("due");
+	}
+
+	uint64_t next_update() {
+		sync_timers(time_ms());
+		return box_timers.next_due();
+	}
+
+	//* Runs collect and draw in a secondary thread, publishes a config snapshot for the cycle first
 	void run(const string& box, bool no_update, bool force_redraw) {
 		const int timeout = get_adaptive_timeout();
 		atomic_wait_for(active, true, timeout);
@@ -1042,19 +1301,16 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 		if (stopping or Global::resized) return;
 
 		if (box == "overlay") {
-			const bool term_sync = Config::getB("terminal_sync");
-			cout << (term_sync ? Term::sync_start : "") << Global::overlay << (term_sync ? Term::sync_end : "") << flush;
+			write_screen(Global::overlay);
 		}
 		else if (box == "clock") {
-			const bool term_sync = Config::getB("terminal_sync");
-			cout << (term_sync ? Term::sync_start : "") << Global::clock << (term_sync ? Term::sync_end : "") << flush;
+			write_screen(Global::clock);
 		}
 		else {
-			Config::unlock();
-			Config::lock();
+			Config::publish();
 
 			current_conf = {
-				(box == "all" ? Config::current_boxes : vector{box}),
+				(box == "all" ? Config::current_boxes : box == "due" ? due_boxes : vector{box}),
 				no_update, force_redraw,
 				(not Config::getB("tty_mode") and Config::getB("background_update")),
 				Global::overlay,
@@ -1099,6 +1355,8 @@ atomic<bool> should_terminate (false);  //? Flag for cooperative thread terminat
 			atomic_wait_for(active, false, 100);
 			atomic_wait_for(active, true, 100);
 		}
+		//? Anything written to the terminal after this should come after the last frame
+		writer.drain(1000);
 		stopping = false;
 	}
 
@@ -1400,8 +1658,7 @@ static auto configure_tty_mode(std::optional<bool> force_tty) {
 	Draw::calcSizes();
 
 	//? Print out box outlines
-	const bool term_sync = Config::getB("terminal_sync");
-	cout << (term_sync ? Term::sync_start : "") << Cpu::box << Mem::box << Net::box << Proc::box << Pwr::box << (term_sync ? Term::sync_end : "") << flush;
+	Runner::write_screen(Cpu::box + Mem::box + Net::box + Proc::box + Pwr::box);
 
 	//? Start socket server for MCP control
 	Socket::start();
@@ -1411,7 +1668,6 @@ static auto configure_tty_mode(std::optional<bool> force_tty) {
 	if (cli.updates.has_value()) {
 		Config::set("update_ms", static_cast<int>(cli.updates.value()));
 	}
-	uint64_t update_ms = Config::getI("update_ms");
 	auto future_time = time_ms();
 
 	try {
@@ -1431,7 +1687,7 @@ static auto configure_tty_mode(std::optional<bool> force_tty) {
 			else if (Global::reload_conf) {
 				Global::reload_conf = false;
 				if (Runner::active) Runner::stop();
-				Config::unlock();
+				Config::merge();
 				init_config(cli.low_color, cli.filter);
 				Theme::updateThemes();
 				Theme::setTheme();
@@ -1444,6 +1700,8 @@ static auto configure_tty_mode(std::optional<bool> force_tty) {
 
 			//? Trigger secondary thread to redraw if terminal has been resized
 			if (Global::resized) {
+				//? Whatever cleared the screen or changed its size wrote to it directly, repaint all of it
+				Runner::invalidate_screen();
 				Draw::calcSizes();
 				Draw::update_clock(true);
 				Draw::update_hostname(true);
@@ -1488,27 +1746,22 @@ static auto configure_tty_mode(std::optional<bool> force_tty) {
 				Socket::process_pending_command();
 			}
 
-			//? Start secondary collect & draw thread at the interval set by <update_ms> config value
+			//? Start secondary collect & draw thread for the boxes whose update interval has passed
 			if (time_ms() >= future_time and not Global::resized) {
-				Runner::run("all");
-				update_ms = Config::getI("update_ms");
-				future_time = time_ms() + update_ms;
+				Runner::update();
+				future_time = Runner::next_update();
 			}
 
 			//? Loop over input polling and input action processing
 			for (auto current_time = time_ms(); current_time < future_time; current_time = time_ms()) {
 
-				//? Check for external clock changes and for changes to the update timer
-				if (std::cmp_not_equal(update_ms, Config::getI("update_ms"))) {
-					update_ms = Config::getI("update_ms");
-					future_time = time_ms() + update_ms;
-				}
-				else if (future_time - current_time > update_ms) {
-					future_time = current_time;
+				//? Check for external clock changes and for changes to the update intervals or shown boxes
+				if (const auto next_update = Runner::next_update(); next_update != future_time) {
+					future_time = next_update;
 				}
 				//? Poll for input and process any input detected
 				else if (Input::poll(min((uint64_t)1000, future_time - current_time))) {
-					if (not Runner::active) Config::unlock();
+					if (not Runner::active) Config::merge();
 
 					if (Menu::active) Menu::process(Input::get());
 					else Input::process(Input::get());
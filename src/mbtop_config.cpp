@@ -21,12 +21,16 @@ tab-size = 4
 #include <charconv>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iterator>
 #include <locale>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <ranges>
 #include <regex>
 #include <string_view>
+#include <unordered_set>
 #include <utility>
 
 #include <fmt/base.h>
@@ -58,9 +62,7 @@ using namespace Tools;
 //* Functions and variables for reading and writing the btop config file
 namespace Config {
 
-	atomic<bool> locked (false);
-	atomic<bool> writelock (false);
-	bool write_new;
+	atomic<bool> write_new;
 
 	const vector<array<string, 2>> descriptions = {
 		{"color_theme", 		"#* Name of a mbtop/btop++/bpytop/bashtop formatted \".theme\" file, \"Default\" and \"TTY\" for builtin themes.\n"
@@ -86,6 +88,10 @@ namespace Config {
 
 		{"terminal_sync", 		"#* Use terminal synchronized output sequences to reduce flickering on supported terminals."},
 
+		{"diff_output",			"#* Only write the parts of the screen that changed since the last frame, lowers output a lot over slow connections."},
+
+		{"minimize_output",		"#* When whole frames are written (diff_output off), drop color changes that change nothing and merge cursor moves first."},
+
 		{"graph_symbol", 		"#* Default symbols to use for graph creation, \"braille\", \"block\" or \"tty\".\n"
 								"#* \"braille\" offers the highest resolution but might not be included in all fonts.\n"
 								"#* \"block\" has half the resolution of braille but uses more common characters.\n"
@@ -107,6 +113,19 @@ namespace Config {
 
 		{"update_ms", 			"#* Update time in milliseconds, recommended 2000 ms or above for better sample times for graphs."},
 
+		{"cpu_update_ms",		"#* Update time in milliseconds for the cpu box, 0 = same as update_ms. Lower values show short usage spikes."},
+
+		{"mem_update_ms",		"#* Update time in milliseconds for the mem box including disks, 0 = same as update_ms."},
+
+		{"net_update_ms",		"#* Update time in milliseconds for the net box, 0 = same as update_ms. Lower values show short traffic spikes."},
+
+		{"proc_update_ms",		"#* Update time in milliseconds for the proc box, 0 = same as update_ms. Higher values lower the cost of reading all processes."},
+
+		{"concurrent_collect",	"#* Collect data for all shown boxes at the same time on separate threads, boxes are still drawn in order."},
+
+		{"io_uring",			"#* (Linux) Read /proc and /sys files for cpu, disks and network with one io_uring batch per update.\n"
+								"#* Falls back to regular reads if the kernel is too old or io_uring is blocked."},
+
 		{"proc_sorting",		"#* Processes sorting, \"pid\" \"program\" \"arguments\" \"threads\" \"user\" \"memory\" \"cpu lazy\" \"cpu direct\" \"gpu\",\n"
 								"#* \"cpu lazy\" sorts top process over time (easier to follow), \"cpu direct\" updates top process directly.\n"
 								"#* \"gpu\" sorts by GPU usage (Apple Silicon only)."},
@@ -169,6 +188,11 @@ namespace Config {
 
 		{"proc_filter_kernel",  "#* (Linux) Filter processes tied to the Linux kernel(similar behavior to htop)."},
 
+		{"proc_collect_threads",	"#* (Linux) Number of threads used to read process information, 0 = automatic, 1 = only the collection thread."},
+
+		{"proc_events",			"#* (Linux) Track processes with the netlink process connector instead of listing /proc every update.\n"
+								"#* Also counts processes that start and exit between updates. Needs root or CAP_NET_ADMIN, falls back to /proc otherwise."},
+
 		{"proc_follow_detailed",	"#* Should the process list follow the selected process when detailed view is open."},
 
 		{"proc_aggregate",		"#* In tree-view, always accumulate child process resources in the parent process."},
@@ -356,196 +380,28 @@ namespace Config {
 	#endif
 	};
 
-	std::unordered_map<std::string_view, string> strings = {
-		{"color_theme", "Default"},
-		{"shown_boxes", "cpu pwr mem net proc"},
-		{"graph_symbol", "braille"},
-		{"presets", "cpu:1:default,pwr:0:default cpu:0:default,pwr:0:default,mem:0:default,net:0:default cpu:0:braille,mem:0:braille,net:0:braille"},
-		{"graph_symbol_cpu", "default"},
-		{"graph_symbol_gpu", "default"},
-		{"graph_symbol_pwr", "default"},
-		{"graph_symbol_mem", "default"},
-		{"graph_symbol_net", "default"},
-		{"graph_symbol_proc", "default"},
-		{"proc_sorting", "cpu lazy"},
-		{"proc_tag_mode", "name"},
-		{"cpu_graph_upper", "Auto"},
-		{"cpu_graph_lower", "Auto"},
-		{"cpu_sensor", "Auto"},
-		{"selected_battery", "Auto"},
-		{"cpu_core_map", ""},
-		{"temp_scale", "celsius"},
-	#ifdef __linux__
-		{"freq_mode", "first"},
-	#endif
-		{"clock_format", "%X"},
-		{"preset_names", "Standard LLM Processes Power CPU/MEM"},
-		{"preset_0", ""},
-		{"custom_cpu_name", ""},
-		{"disks_filter", ""},
-		{"io_graph_speeds", ""},
-		{"net_iface", ""},
-		{"net_iface_filter", ""},
-		{"base_10_bitrate", "Auto"},
-		{"log_level", "WARNING"},
-		{"log_export_path", ""},
-		{"log_default_source", "system"},
-		{"proc_filter", ""},
-		{"selected_name", ""},
-		{"selected_cmd", ""},
-	#ifdef GPU_SUPPORT
-		{"custom_gpu_name0", ""},
-		{"custom_gpu_name1", ""},
-		{"custom_gpu_name2", ""},
-		{"custom_gpu_name3", ""},
-		{"custom_gpu_name4", ""},
-		{"custom_gpu_name5", ""},
-		{"show_gpu_info", "Auto"},
-	#if defined(__APPLE__)
-		{"shown_gpus", "apple"}  //? Default to Apple on macOS (Apple Silicon)
-	#else
-		{"shown_gpus", "nvidia amd intel"}
-	#endif
-	#endif
-	};
-	std::unordered_map<std::string_view, string> stringsTmp;
-
-	std::unordered_map<std::string_view, bool> bools = {
-		{"theme_background", true},
-		{"truecolor", true},
-		{"rounded_corners", true},
-		{"proc_reversed", false},
-		{"proc_tree", false},
-		{"proc_filter_tagged", false},
-		{"proc_colors", true},
-		{"proc_gradient", true},
-		{"proc_per_core", false},
-		{"proc_gpu", true},
-		{"proc_mem_bytes", true},
-		{"proc_cpu_graphs", true},
-		{"proc_gpu_graphs", true},
-		{"proc_show_cmd", true},
-		{"proc_show_threads", true},
-		{"proc_show_user", true},
-		{"proc_show_memory", true},
-		{"proc_show_cpu", true},
-		{"proc_show_io", true},
-		{"proc_show_io_read", true},
-		{"proc_show_io_write", true},
-		{"proc_show_state", true},
-		{"proc_show_priority", true},
-		{"proc_show_nice", true},
-		{"proc_show_ports", true},
-		{"proc_show_virt", true},
-		{"proc_show_runtime", true},
-		{"proc_show_cputime", true},
-		{"proc_show_gputime", true},
-		{"proc_info_smaps", false},
-		{"proc_left", false},
-		{"proc_filter_kernel", false},
-		{"cpu_invert_lower", true},
-		{"cpu_single_graph", false},
-		{"cpu_bottom", false},
-		{"gpu_bottom", false},
-		{"pwr_bottom", false},
-		{"show_uptime", true},
-		{"show_cpu_watts", true},
-		{"check_temp", true},
-		{"show_coretemp", true},
-		{"show_cpu_freq", true},
-		{"clock_12h", false},
-		{"show_hostname", true},
-		{"show_uptime_header", false},
-		{"show_username_header", false},
-		{"background_update", true},
-		{"mem_graphs", true},
-		{"mem_bar_mode", true},
-		{"mem_below_net", false},
-		{"net_beside_mem", true},
-		{"proc_full_width", false},
-		{"logs_below_proc", false},
-		{"log_color_full_line", false},
-		{"stacked_layout", false},
-		{"zfs_arc_cached", true},
-		{"show_swap", true},
-		{"swap_disk", true},
-		{"show_disks", false},
-		{"mem_horizontal", true},
-		{"mem_show_used", true},
-		{"mem_show_available", true},
-		{"mem_show_cached", true},
-		{"mem_show_free", true},
-		{"swap_show_used", true},
-		{"swap_show_free", true},
-		{"vram_show_used", true},
-		{"vram_show_free", true},
-		{"only_physical", true},
-		{"show_network_drives", false},
-		{"use_fstab", true},
-		{"zfs_hide_datasets", false},
-		{"show_io_stat", true},
-		{"io_mode", false},
-		{"swap_upload_download", false},
-		{"base_10_sizes", false},
-		{"io_graph_combined", false},
-		{"net_auto", true},
-		{"net_sync", true},
-		{"show_battery", true},
-		{"show_battery_watts", true},
-		{"vim_keys", false},
-		{"tty_mode", false},
-		{"disk_free_priv", false},
-		{"force_tty", false},
-		{"lowcolor", false},
-		{"show_detailed", false},
-		{"proc_filtering", false},
-		{"proc_aggregate", false},
-		{"pause_proc_list", false},
-		{"keep_dead_proc_usage", false},
-		{"proc_banner_shown", false},
-		{"proc_follow_detailed", true},
-		{"follow_process", false},
-		{"update_following", false},
-		{"should_selection_return_to_followed", false},
-	#ifdef GPU_SUPPORT
-		{"nvml_measure_pcie_speeds", true},
-		{"rsmi_measure_pcie_speeds", true},
-		{"gpu_mirror_graph", true},
-	#endif
-		{"terminal_sync", true},
-		{"save_config_on_exit", true},
-		{"prevent_autosave", true},
-		{"show_instance_indicator", true},
-		{"preview_unicode", true},
-		{"disable_mouse", false},
-	};
-	std::unordered_map<std::string_view, bool> boolsTmp;
-
-	std::unordered_map<std::string_view, int> ints = {
-		{"update_ms", 2000},
-		{"net_download", 100},
-		{"net_upload", 100},
-		{"net_graph_direction", 0},
-		{"detailed_pid", 0},
-		{"restore_detailed_pid", 0},
-		{"selected_pid", 0},
-		{"followed_pid", 0},
-		{"selected_depth", 0},
-		{"proc_start", 0},
-		{"proc_selected", 0},
-		{"proc_last_selected", 0},
-		{"proc_followed", 0},
-		{"disk_selected", 0},
-		{"disk_start", 0},
-		{"mem_vram_mode", 0},
-		{"mem_toggle_mode", 0},
-		{"swap_toggle_mode", 0},
-		{"vram_toggle_mode", 0},
-		{"mem_start", 0},
-		{"mem_selected", 0},
-		{"log_buffer_size", 500}
-	};
-	std::unordered_map<std::string_view, int> intsTmp;
+	Table<string, string_options> strings;
+	Table<bool, bool_options> bools;
+	Table<int, int_options> ints;
+
+	thread_local Snapshot* view{};
+	thread_local bool shared_view{};
+
+	//? Changes made during runner cycles, written to the live values by merge()
+	static struct {
+		std::array<std::optional<string>, string_options.size()> strings;
+		std::array<std::optional<bool>, bool_options.size()> bools;
+		std::array<std::optional<int>, int_options.size()> ints;
+	} pending;
+	static std::mutex pending_mtx;
+	static atomic<bool> has_pending (false);
+
+	//? Triple buffer of snapshots, the runner owns <front>, the main thread owns <back>
+	//? and <middle> holds the latest published one with the fresh bit set until the runner takes it
+	static std::array<Snapshot, 3> snapshots;
+	static constexpr int fresh = 4;
+	static atomic<int> middle (1);
+	static int front = 0, back = 2;
 
 	// Returns a valid config dir or an empty optional
 	// The config dir might be read only, a warning is printed, but a path is returned anyway
@@ -606,13 +462,44 @@ namespace Config {
 		return {};
 	}
 
-	bool _locked(const std::string_view name) {
-		atomic_wait(writelock, true);
-		if (not write_new and rng::find_if(descriptions, [&name](const auto& a) { return a.at(0) == name; }) != descriptions.end())
-			write_new = true;
-		return locked.load();
+	//* Mark the config file for writing if option <name> is written to it
+	static void changed(const std::string_view name) {
+		if (write_new) return;
+		static const auto described = [] {
+			std::unordered_set<std::string_view> names;
+			for (const auto& description : descriptions) names.insert(description.at(0));
+			return names;
+		}();
+		if (described.contains(name)) write_new = true;
+	}
+
+	//* Set option <id> of <live> to <value>, during a runner cycle queued for merge() instead and on the runner also on the cycle's snapshot
+	template <typename T, const auto& Options>
+	static void set_value(Table<T, Options>& live, std::array<T, Options.size()> Snapshot::* cycle_values,
+						  std::array<std::optional<T>, Options.size()>& queued, size_t id, const T& value) {
+		changed(Options[id].name);
+		if (view == nullptr) {
+			live[id] = value;
+			//? Newer than anything queued by a cycle for the same option
+			if (has_pending) {
+				std::lock_guard lock(pending_mtx);
+				queued[id].reset();
+			}
+			return;
+		}
+		//? Collectors share the snapshot with the runner, sync_view() copies their changes once they're done
+		if (not shared_view) (view->*cycle_values)[id] = value;
+		std::lock_guard lock(pending_mtx);
+		queued[id] = value;
+		has_pending = true;
 	}
 
+	void set(bool_key key, bool value) { set_value(bools, &Snapshot::bools, pending.bools, key.id, value); }
+
+	void set(int_key key, const int value) { set_value(ints, &Snapshot::ints, pending.ints, key.id, value); }
+
+	void set(string_key key, const string& value) { set_value(strings, &Snapshot::strings, pending.strings, key.id, value); }
+
 	fs::path conf_dir;
 	fs::path conf_file;
 	fs::path toml_file;
@@ -626,6 +513,9 @@ namespace Config {
 	// Typed logging config (coexists with flat maps)
 	LoggingConfig logging;
 
+	//? Bumped by every change to logging.processes
+	static std::atomic<uint64_t> process_configs_changes{};
+
 	vector<string> available_batteries = {"Auto"};
 
 	vector<string> current_boxes;
@@ -918,11 +808,6 @@ namespace Config {
 		return false;
 	}
 
-	void lock() {
-		atomic_wait(writelock);
-		locked = true;
-	}
-
 	string validError;
 
 	bool intValid(const std::string_view name, const string& value) {
@@ -948,6 +833,12 @@ namespace Config {
 		else if (name == "update_ms" and i_value > ONE_DAY_MILLIS)
 			validError = fmt::format("Config value update_ms set too high (>{}).", ONE_DAY_MILLIS);
 
+		else if (name.ends_with("_update_ms") and i_value != 0 and (i_value < 100 or i_value > ONE_DAY_MILLIS))
+			validError = fmt::format("Config value {} out of range (0 or 100-{}).", name, ONE_DAY_MILLIS);
+
+		else if (name == "proc_collect_threads" and (i_value < 0 or i_value > PROC_COLLECT_THREADS_MAX))
+			validError = fmt::format("Config value proc_collect_threads out of range (0-{}).", PROC_COLLECT_THREADS_MAX);
+
 		else
 			return true;
 
@@ -1080,24 +971,12 @@ namespace Config {
 		return "";
 	}
 
-	void flip(const std::string_view name) {
-		//? First find the key in bools to get a stable string_view (pointing to static storage)
-		auto it = bools.find(name);
-		if (it == bools.end()) return;  // Key not found, do nothing
-
-		const auto& stable_key = it->first;  // Use the stable key from bools map
-
-		if (_locked(name)) {
-			if (boolsTmp.contains(stable_key)) boolsTmp.at(stable_key) = not boolsTmp.at(stable_key);
-			else boolsTmp.insert_or_assign(stable_key, (not it->second));
-		}
-		else it->second = not it->second;
+	void flip(bool_key key) {
+		set(key, not getB(key));
 	}
 
-	void unlock() {
-		if (not locked) return;
+	void merge() {
 		atomic_wait(Runner::active);
-		atomic_lock lck(writelock, true);
 		try {
 			if (Proc::shown) {
 				ints.at("selected_pid") = Proc::selected_pid;
@@ -1108,27 +987,56 @@ namespace Config {
 				ints.at("selected_depth") = Proc::selected_depth;
 			}
 
-			for (auto& item : stringsTmp) {
-				strings.at(item.first) = item.second;
-			}
-			stringsTmp.clear();
-
-			for (auto& item : intsTmp) {
-				ints.at(item.first) = item.second;
-			}
-			intsTmp.clear();
-
-			for (auto& item : boolsTmp) {
-				bools.at(item.first) = item.second;
+			if (has_pending.exchange(false)) {
+				std::lock_guard lock(pending_mtx);
+				const auto apply = [](auto& live, auto& queued) {
+					for (size_t id = 0; id < queued.size(); ++id) {
+						if (not queued[id]) continue;
+						live[id] = std::move(*queued[id]);
+						queued[id].reset();
+					}
+				};
+				apply(strings, pending.strings);
+				apply(bools, pending.bools);
+				apply(ints, pending.ints);
 			}
-			boolsTmp.clear();
 		}
 		catch (const std::exception& e) {
-			Global::exit_error_msg = "Exception during Config::unlock() : " + string{e.what()};
+			Global::exit_error_msg = "Exception during Config::merge() : " + string{e.what()};
 			clean_quit(1);
 		}
+	}
 
-		locked = false;
+	void publish() {
+		merge();
+		auto& next = snapshots[back];
+		for (size_t id = 0; id < strings.size(); ++id) next.strings[id] = strings[id];
+		for (size_t id = 0; id < bools.size(); ++id) next.bools[id] = bools[id];
+		for (size_t id = 0; id < ints.size(); ++id) next.ints[id] = ints[id];
+		back = middle.exchange(back | fresh, std::memory_order_acq_rel) & ~fresh;
+	}
+
+	Snapshot* acquire() {
+		//? Nothing published yet, read the live values
+		static bool acquired{};
+		if (middle.load(std::memory_order_relaxed) & fresh) {
+			front = middle.exchange(front, std::memory_order_acq_rel) & ~fresh;
+			acquired = true;
+		}
+		return acquired ? &snapshots[front] : nullptr;
+	}
+
+	void sync_view() {
+		if (view == nullptr or not has_pending) return;
+		std::lock_guard lock(pending_mtx);
+		const auto copy = [](auto& cycle_values, const auto& queued) {
+			for (size_t id = 0; id < queued.size(); ++id) {
+				if (queued[id]) cycle_values[id] = *queued[id];
+			}
+		};
+		copy(view->strings, pending.strings);
+		copy(view->bools, pending.bools);
+		copy(view->ints, pending.ints);
 	}
 
 	bool set_boxes(const string& boxes) {
@@ -1577,6 +1485,7 @@ namespace Config {
 								}
 							}
 						}
+						++process_configs_changes;
 					}
 				}
 			}
@@ -1711,6 +1620,7 @@ namespace Config {
 			mbtop_cfg.tagged = true;
 			mbtop_cfg.tag_color = "log_debug_plus";  //? Green
 			logging.processes.push_back(std::move(mbtop_cfg));
+			++process_configs_changes;
 		}
 	}
 
@@ -1754,43 +1664,6 @@ namespace Config {
 		return pattern.find('*') != string::npos;
 	}
 
-	//? Helper: Match command against pattern with wildcard support
-	//? Wildcards: * matches any sequence of characters
-	bool wildcard_match(const string& pattern, const string& text) {
-		if (pattern.empty()) return false;
-		if (!has_wildcard(pattern)) return pattern == text;
-
-		// Convert wildcard pattern to regex: escape special chars, replace * with .*
-		string regex_str;
-		regex_str.reserve(pattern.size() * 2);
-		for (char c : pattern) {
-			switch (c) {
-				case '*': regex_str += ".*"; break;
-				case '.': regex_str += "\\."; break;
-				case '?': regex_str += "\\?"; break;
-				case '+': regex_str += "\\+"; break;
-				case '[': regex_str += "\\["; break;
-				case ']': regex_str += "\\]"; break;
-				case '(': regex_str += "\\("; break;
-				case ')': regex_str += "\\)"; break;
-				case '{': regex_str += "\\{"; break;
-				case '}': regex_str += "\\}"; break;
-				case '^': regex_str += "\\^"; break;
-				case '$': regex_str += "\\$"; break;
-				case '|': regex_str += "\\|"; break;
-				case '\\': regex_str += "\\\\"; break;
-				default: regex_str += c; break;
-			}
-		}
-
-		try {
-			std::regex re(regex_str, std::regex::ECMAScript);
-			return std::regex_match(text, re);
-		} catch (const std::regex_error&) {
-			return false;
-		}
-	}
-
 	//? Helper: Calculate pattern specificity (higher = more specific)
 	//? Exact match = INT_MAX, wildcard = length of non-wildcard chars
 	int pattern_specificity(const string& pattern, bool is_exact) {
@@ -1803,60 +1676,153 @@ namespace Config {
 		return count;
 	}
 
-	std::optional<ProcessLogConfig> find_process_config(const string& name, const string& cmdline) {
-		//? Collect all matching configs with their specificity
-		std::vector<std::pair<int, const ProcessLogConfig*>> matches;
-
-		for (const auto& cfg : logging.processes) {
-			if (cfg.name != name) continue;
-			if (cfg.command.empty()) continue;
-
-			//? Check if this config matches
-			bool matched = false;
-			bool is_exact = false;
-
-			// Priority 1: If there's a command pattern (regex), use it
-			if (cfg.compiled_pattern.has_value()) {
-				if (std::regex_search(cmdline, *cfg.compiled_pattern)) {
-					matched = true;
-					// Regex patterns use pattern length as specificity
+	uint64_t process_configs_version() noexcept {
+		return process_configs_changes.load(std::memory_order_relaxed);
+	}
+
+	namespace {
+		//* Command with * wildcards matching any sequence of characters, split once into the literal parts between them
+		//* Matches the same commands as the regex the pattern used to be converted to, where .* stops at line breaks
+		class wildcard_pattern {
+			vector<string> parts;
+			std::optional<std::regex> fallback;	//? Only for the odd pattern with a line break in it
+		public:
+			explicit wildcard_pattern(const string& pattern) {
+				if (pattern.find_first_of("\n\r") != string::npos) {
+					string regex_str;
+					for (char c : pattern) {
+						if (c == '*') regex_str += ".*";
+						else if (string_view{".?+[](){}^$|\\"}.contains(c)) regex_str += {'\\', c};
+						else regex_str += c;
+					}
+					try { fallback = std::regex(regex_str, std::regex::ECMAScript); }
+					catch (const std::regex_error&) { fallback = std::regex("$^"); }
+					return;
 				}
+				for (const auto part : std::views::split(string_view{pattern}, '*'))
+					parts.emplace_back(part.begin(), part.end());
 			}
-			// Priority 2: Command with wildcard or exact matching
-			else if (has_wildcard(cfg.command)) {
-				if (wildcard_match(cfg.command, cmdline)) {
-					matched = true;
+
+			bool matches(string_view text) const {
+				if (fallback) return std::regex_match(text.begin(), text.end(), *fallback);
+				if (text.find_first_of("\n\r") != string_view::npos) return false;
+				const string& first = parts.front();
+				const string& last = parts.back();
+				if (text.size() < first.size() + last.size() or not text.starts_with(first) or not text.ends_with(last)) return false;
+				//? Leftmost match of each part in between leaves the most room for the rest
+				text = text.substr(first.size(), text.size() - first.size() - last.size());
+				for (size_t i = 1; i + 1 < parts.size(); ++i) {
+					const auto pos = text.find(parts[i]);
+					if (pos == string_view::npos) return false;
+					text.remove_prefix(pos + parts[i].size());
 				}
-			} else {
-				// Exact match
-				if (cfg.command == cmdline) {
-					matched = true;
-					is_exact = true;
+				return true;
+			}
+		};
+
+		//* logging.processes grouped by name, with wildcards split and rules ordered by specificity once per change of the configs
+		//* Holds copies of the configs so a resolved config stays valid for whoever holds the index
+		struct process_config_index {
+			struct rule {
+				int specificity;
+				size_t config;
+				std::optional<wildcard_pattern> wildcard;	//? Regex pattern otherwise
+			};
+			struct by_name {
+				std::unordered_map<string, size_t> exact;	//? Most specific, the first config for a command wins
+				vector<rule> rules;							//? Most specific first, then in config order
+				std::optional<size_t> application;
+			};
+
+			uint64_t version{};
+			vector<ProcessLogConfig> configs;
+			std::unordered_map<string, by_name> names;
+
+			explicit process_config_index(uint64_t version) : version(version) {
+				for (const auto& cfg : logging.processes) {
+					if (cfg.command.empty()) continue;
+					auto& entry = names[cfg.name];
+					if (cfg.compiled_pattern.has_value())
+						entry.rules.push_back({pattern_specificity(cfg.command, false), configs.size(), std::nullopt});
+					else if (has_wildcard(cfg.command))
+						entry.rules.push_back({pattern_specificity(cfg.command, false), configs.size(), wildcard_pattern(cfg.command)});
+					else
+						entry.exact.try_emplace(cfg.command, configs.size());
+					configs.push_back(cfg);
+				}
+				for (auto& [name, entry] : names)
+					rng::stable_sort(entry.rules, std::greater{}, &rule::specificity);
+				for (const auto& [name, path] : logging.applications) {
+					names[name].application = configs.size();
+					ProcessLogConfig cfg;
+					cfg.name = name;
+					cfg.log_path = path;
+					configs.push_back(std::move(cfg));
 				}
 			}
 
-			if (matched) {
-				int specificity = pattern_specificity(cfg.command, is_exact);
-				matches.emplace_back(specificity, &cfg);
+			const ProcessLogConfig* find(const string& name, const string& cmdline) const {
+				const auto it = names.find(name);
+				if (it == names.end()) return nullptr;
+				const auto& entry = it->second;
+				if (const auto exact = entry.exact.find(cmdline); exact != entry.exact.end()) return &configs[exact->second];
+				for (const auto& r : entry.rules) {
+					if (r.wildcard ? r.wildcard->matches(cmdline) : std::regex_search(cmdline, *configs[r.config].compiled_pattern))
+						return &configs[r.config];
+				}
+				if (entry.application) return &configs[*entry.application];
+				return nullptr;
 			}
+		};
+
+		std::mutex process_index_mtx;
+		std::shared_ptr<const process_config_index> process_index;
+
+		//* Index for the current process configs, rebuilt by the first caller after a change
+		std::shared_ptr<const process_config_index> current_process_index() {
+			const uint64_t version = process_configs_version();
+			std::lock_guard lock(process_index_mtx);
+			if (process_index == nullptr or process_index->version != version)
+				process_index = std::make_shared<const process_config_index>(version);
+			return process_index;
 		}
 
-		//? Return most specific match (highest specificity)
-		if (!matches.empty()) {
-			auto best = std::max_element(matches.begin(), matches.end(),
-				[](const auto& a, const auto& b) { return a.first < b.first; });
-			return *best->second;
-		}
+		//* Config resolved per process, for the runner thread
+		struct {
+			struct entry {
+				uint64_t starttime{};
+				size_t name_size{}, cmd_size{};		//? Cheap check for a process that changed without the collector telling
+				const ProcessLogConfig* config{};
+			};
+			std::shared_ptr<const process_config_index> index;
+			std::unordered_map<size_t, entry> by_pid;
+		} process_resolutions;
+	}
+
+	std::optional<ProcessLogConfig> find_process_config(const string& name, const string& cmdline) {
+		if (const auto* cfg = current_process_index()->find(name, cmdline)) return *cfg;
+		return std::nullopt;
+	}
 
-		// Check simple applications mapping (name -> path)
-		if (auto it = logging.applications.find(name); it != logging.applications.end()) {
-			ProcessLogConfig cfg;
-			cfg.name = name;
-			cfg.log_path = it->second;
-			return cfg;
+	const ProcessLogConfig* find_process_config(size_t pid, uint64_t starttime, const string& name, const string& cmdline) {
+		auto& cache = process_resolutions;
+		if (cache.index == nullptr or cache.index->version != process_configs_version()) {
+			cache.index = current_process_index();
+			cache.by_pid.clear();
 		}
+		auto [it, inserted] = cache.by_pid.try_emplace(pid);
+		auto& entry = it->second;
+		if (inserted or entry.starttime != starttime or entry.name_size != name.size() or entry.cmd_size != cmdline.size())
+			entry = {starttime, name.size(), cmdline.size(), cache.index->find(name, cmdline)};
+		return entry.config;
+	}
 
-		return std::nullopt;
+	void forget_process_config(size_t pid) {
+		process_resolutions.by_pid.erase(pid);
+	}
+
+	void retain_process_configs(const std::function<bool(size_t)>& keep) {
+		std::erase_if(process_resolutions.by_pid, [&](const auto& item) { return not keep(item.first); });
 	}
 
 	void save_process_config(const ProcessLogConfig& config) {
@@ -1881,6 +1847,7 @@ namespace Config {
 				} else {
 					cfg.compiled_pattern = std::nullopt;
 				}
+				++process_configs_changes;
 				skip_filter_sync_on_reload = true;  //? Don't sync filter when tagging via UI
 				write_toml(true);  //? Force write - process configs always persist
 				return;
@@ -1897,6 +1864,7 @@ namespace Config {
 			}
 		}
 		logging.processes.push_back(std::move(new_cfg));
+		++process_configs_changes;
 		skip_filter_sync_on_reload = true;  //? Don't sync filter when tagging via UI
 		write_toml(true);  //? Force write - process configs always persist
 	}
@@ -1909,6 +1877,7 @@ namespace Config {
 			});
 		if (it != logging.processes.end()) {
 			logging.processes.erase(it);
+			++process_configs_changes;
 			skip_filter_sync_on_reload = true;  //? Don't sync filter when untagging via UI
 			write_toml(true);  //? Force write - process configs always persist
 		}
@@ -2008,5 +1977,6 @@ namespace Config {
 		} catch (const std::exception& e) {
 			Logger::warning("Failed to reload config: {}", e.what());
 		}
+		++process_configs_changes;
 	}
 }
@@ -18,10 +18,18 @@ tab-size = 4
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <concepts>
 #include <filesystem>
+#include <functional>
 #include <optional>
 #include <regex>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <unordered_map>
@@ -75,12 +83,331 @@ namespace Config {
 	// Main typed config (coexists with flat maps during transition)
 	extern LoggingConfig logging;
 
-	extern std::unordered_map<std::string_view, string> strings;
-	extern std::unordered_map<std::string_view, string> stringsTmp;
-	extern std::unordered_map<std::string_view, bool> bools;
-	extern std::unordered_map<std::string_view, bool> boolsTmp;
-	extern std::unordered_map<std::string_view, int> ints;
-	extern std::unordered_map<std::string_view, int> intsTmp;
+	//* Config option <name> and its default <value>
+	template <typename T>
+	struct option {
+		std::string_view name;
+		T value;
+	};
+
+	//? Registry of all options by type, the position of an option is its id
+	inline constexpr auto string_options = std::to_array<option<std::string_view>>({
+		{"color_theme", "Default"},
+		{"shown_boxes", "cpu pwr mem net proc"},
+		{"graph_symbol", "braille"},
+		{"presets", "cpu:1:default,pwr:0:default cpu:0:default,pwr:0:default,mem:0:default,net:0:default cpu:0:braille,mem:0:braille,net:0:braille"},
+		{"graph_symbol_cpu", "default"},
+		{"graph_symbol_gpu", "default"},
+		{"graph_symbol_pwr", "default"},
+		{"graph_symbol_mem", "default"},
+		{"graph_symbol_net", "default"},
+		{"graph_symbol_proc", "default"},
+		{"proc_sorting", "cpu lazy"},
+		{"proc_tag_mode", "name"},
+		{"cpu_graph_upper", "Auto"},
+		{"cpu_graph_lower", "Auto"},
+		{"cpu_sensor", "Auto"},
+		{"selected_battery", "Auto"},
+		{"cpu_core_map", ""},
+		{"temp_scale", "celsius"},
+	#ifdef __linux__
+		{"freq_mode", "first"},
+	#endif
+		{"clock_format", "%X"},
+		{"preset_names", "Standard LLM Processes Power CPU/MEM"},
+		{"preset_0", ""},
+		{"custom_cpu_name", ""},
+		{"disks_filter", ""},
+		{"io_graph_speeds", ""},
+		{"net_iface", ""},
+		{"net_iface_filter", ""},
+		{"base_10_bitrate", "Auto"},
+		{"log_level", "WARNING"},
+		{"log_export_path", ""},
+		{"log_default_source", "system"},
+		{"proc_filter", ""},
+		{"selected_name", ""},
+		{"selected_cmd", ""},
+	#ifdef GPU_SUPPORT
+		{"custom_gpu_name0", ""},
+		{"custom_gpu_name1", ""},
+		{"custom_gpu_name2", ""},
+		{"custom_gpu_name3", ""},
+		{"custom_gpu_name4", ""},
+		{"custom_gpu_name5", ""},
+		{"show_gpu_info", "Auto"},
+	#if defined(__APPLE__)
+		{"shown_gpus", "apple"}  //? Default to Apple on macOS (Apple Silicon)
+	#else
+		{"shown_gpus", "nvidia amd intel"}
+	#endif
+	#endif
+	});
+
+	inline constexpr auto bool_options = std::to_array<option<bool>>({
+		{"theme_background", true},
+		{"truecolor", true},
+		{"rounded_corners", true},
+		{"proc_reversed", false},
+		{"proc_tree", false},
+		{"proc_filter_tagged", false},
+		{"proc_colors", true},
+		{"proc_gradient", true},
+		{"proc_per_core", false},
+		{"proc_gpu", true},
+		{"proc_mem_bytes", true},
+		{"proc_cpu_graphs", true},
+		{"proc_gpu_graphs", true},
+		{"proc_show_cmd", true},
+		{"proc_show_threads", true},
+		{"proc_show_user", true},
+		{"proc_show_memory", true},
+		{"proc_show_cpu", true},
+		{"proc_show_io", true},
+		{"proc_show_io_read", true},
+		{"proc_show_io_write", true},
+		{"proc_show_state", true},
+		{"proc_show_priority", true},
+		{"proc_show_nice", true},
+		{"proc_show_ports", true},
+		{"proc_show_virt", true},
+		{"proc_show_runtime", true},
+		{"proc_show_cputime", true},
+		{"proc_show_gputime", true},
+		{"proc_info_smaps", false},
+		{"proc_left", false},
+		{"proc_filter_kernel", false},
+		{"proc_events", false},
+		{"cpu_invert_lower", true},
+		{"cpu_single_graph", false},
+		{"cpu_bottom", false},
+		{"gpu_bottom", false},
+		{"pwr_bottom", false},
+		{"show_uptime", true},
+		{"show_cpu_watts", true},
+		{"check_temp", true},
+		{"show_coretemp", true},
+		{"show_cpu_freq", true},
+		{"clock_12h", false},
+		{"show_hostname", true},
+		{"show_uptime_header", false},
+		{"show_username_header", false},
+		{"background_update", true},
+		{"mem_graphs", true},
+		{"mem_bar_mode", true},
+		{"mem_below_net", false},
+		{"net_beside_mem", true},
+		{"proc_full_width", false},
+		{"logs_below_proc", false},
+		{"log_color_full_line", false},
+		{"stacked_layout", false},
+		{"zfs_arc_cached", true},
+		{"show_swap", true},
+		{"swap_disk", true},
+		{"show_disks", false},
+		{"mem_horizontal", true},
+		{"mem_show_used", true},
+		{"mem_show_available", true},
+		{"mem_show_cached", true},
+		{"mem_show_free", true},
+		{"swap_show_used", true},
+		{"swap_show_free", true},
+		{"vram_show_used", true},
+		{"vram_show_free", true},
+		{"only_physical", true},
+		{"show_network_drives", false},
+		{"use_fstab", true},
+		{"zfs_hide_datasets", false},
+		{"show_io_stat", true},
+		{"io_mode", false},
+		{"swap_upload_download", false},
+		{"base_10_sizes", false},
+		{"io_graph_combined", false},
+		{"net_auto", true},
+		{"net_sync", true},
+		{"show_battery", true},
+		{"show_battery_watts", true},
+		{"vim_keys", false},
+		{"tty_mode", false},
+		{"disk_free_priv", false},
+		{"force_tty", false},
+		{"lowcolor", false},
+		{"show_detailed", false},
+		{"proc_filtering", false},
+		{"proc_aggregate", false},
+		{"pause_proc_list", false},
+		{"keep_dead_proc_usage", false},
+		{"proc_banner_shown", false},
+		{"proc_follow_detailed", true},
+		{"follow_process", false},
+		{"update_following", false},
+		{"should_selection_return_to_followed", false},
+	#ifdef GPU_SUPPORT
+		{"nvml_measure_pcie_speeds", true},
+		{"rsmi_measure_pcie_speeds", true},
+		{"gpu_mirror_graph", true},
+	#endif
+		{"terminal_sync", true},
+		{"diff_output", true},
+		{"minimize_output", true},
+		{"io_uring", false},
+		{"concurrent_collect", true},
+		{"save_config_on_exit", true},
+		{"prevent_autosave", true},
+		{"show_instance_indicator", true},
+		{"preview_unicode", true},
+		{"disable_mouse", false},
+	});
+
+	inline constexpr auto int_options = std::to_array<option<int>>({
+		{"update_ms", 2000},
+		{"cpu_update_ms", 0},
+		{"mem_update_ms", 0},
+		{"net_update_ms", 0},
+		{"proc_update_ms", 0},
+		{"net_download", 100},
+		{"net_upload", 100},
+		{"net_graph_direction", 0},
+		{"detailed_pid", 0},
+		{"restore_detailed_pid", 0},
+		{"selected_pid", 0},
+		{"followed_pid", 0},
+		{"selected_depth", 0},
+		{"proc_start", 0},
+		{"proc_selected", 0},
+		{"proc_last_selected", 0},
+		{"proc_followed", 0},
+		{"disk_selected", 0},
+		{"disk_start", 0},
+		{"mem_vram_mode", 0},
+		{"mem_toggle_mode", 0},
+		{"swap_toggle_mode", 0},
+		{"vram_toggle_mode", 0},
+		{"mem_start", 0},
+		{"mem_selected", 0},
+		{"proc_collect_threads", 0},
+		{"log_buffer_size", 500}
+	});
+
+	//* Id of option <name> in <options>, options.size() if there is no such option
+	template <typename T, size_t N>
+	constexpr size_t id_of(const std::array<option<T>, N>& options, std::string_view name) {
+		for (size_t id = 0; id < N; ++id) if (options[id].name == name) return id;
+		return N;
+	}
+
+	//? An option name can only be used once, across all types
+	consteval bool unique_names() {
+		std::array<std::string_view, string_options.size() + bool_options.size() + int_options.size()> names{};
+		size_t count = 0;
+		for (const auto& opt : string_options) names[count++] = opt.name;
+		for (const auto& opt : bool_options) names[count++] = opt.name;
+		for (const auto& opt : int_options) names[count++] = opt.name;
+		for (size_t i = 0; i < count; ++i)
+			for (size_t j = i + 1; j < count; ++j)
+				if (names[i] == names[j]) return false;
+		return true;
+	}
+	static_assert(unique_names(), "Config option names must be unique");
+
+	//* Id of an option in <Options>, string literals are resolved at compile time
+	//* and names of options that don't exist or are of another type don't compile
+	template <const auto& Options>
+	struct key {
+		size_t id;
+		consteval key(const char* name) : id(id_of(Options, name)) {
+			if (id == Options.size()) throw "Unknown config option";
+		}
+		constexpr explicit key(size_t id) : id(id) {}
+	};
+	using string_key = key<string_options>;
+	using bool_key = key<bool_options>;
+	using int_key = key<int_options>;
+
+	//* Values of the options in <Options> indexed by id, each kept beside its name so the table can also be used like a map from names to values
+	template <typename T, const auto& Options>
+	class Table {
+	public:
+		using value_type = std::pair<const std::string_view, T>;
+		using iterator = typename std::array<value_type, Options.size()>::iterator;
+		using const_iterator = typename std::array<value_type, Options.size()>::const_iterator;
+
+		Table() : items(defaults(std::make_index_sequence<Options.size()>())) {
+			ids.reserve(Options.size());
+			for (size_t id = 0; id < Options.size(); ++id) ids.emplace(Options[id].name, id);
+		}
+
+		static constexpr size_t size() noexcept { return Options.size(); }
+
+		T& operator[](size_t id) { return items[id].second; }
+		const T& operator[](size_t id) const { return items[id].second; }
+
+		//* Id of option <name>, throws std::out_of_range for unknown names
+		key<Options> key_of(std::string_view name) const {
+			const auto it = ids.find(name);
+			if (it == ids.end()) throw std::out_of_range("Unknown config option: " + string(name));
+			return key<Options>(it->second);
+		}
+
+		T& at(std::string_view name) { return items[key_of(name).id].second; }
+		const T& at(std::string_view name) const { return items[key_of(name).id].second; }
+		T& operator[](std::string_view name) { return at(name); }
+
+		bool contains(std::string_view name) const { return ids.contains(name); }
+		iterator find(std::string_view name) {
+			const auto it = ids.find(name);
+			return it == ids.end() ? end() : begin() + it->second;
+		}
+
+		iterator begin() noexcept { return items.begin(); }
+		iterator end() noexcept { return items.end(); }
+		const_iterator begin() const noexcept { return items.begin(); }
+		const_iterator end() const noexcept { return items.end(); }
+	private:
+		std::array<value_type, Options.size()> items;
+		std::unordered_map<std::string_view, size_t> ids;
+
+		template <size_t... Id>
+		static auto defaults(std::index_sequence<Id...>) {
+			return std::array<value_type, sizeof...(Id)>{value_type{Options[Id].name, T(Options[Id].value)}...};
+		}
+	};
+
+	//? Live option values, only written by the main thread
+	extern Table<string, string_options> strings;
+	extern Table<bool, bool_options> bools;
+	extern Table<int, int_options> ints;
+
+	//* Copy of all option values, published by the main thread for each runner cycle
+	struct Snapshot {
+		std::array<string, string_options.size()> strings;
+		std::array<bool, bool_options.size()> bools;
+		std::array<int, int_options.size()> ints;
+	};
+
+	//? Snapshot this thread reads options from, only set on the runner thread and its collectors during a cycle
+	extern thread_local Snapshot* view;
+	//? Set on collector threads reading the runner's snapshot, their changes are only queued and never written to it
+	extern thread_local bool shared_view;
+
+	//* Reads options from <snapshot> on this thread while in scope, <shared> when the runner thread reads it at the same time
+	class cycle_view {
+		Snapshot* previous;
+		bool previous_shared;
+	public:
+		explicit cycle_view(Snapshot* snapshot, bool shared = false) noexcept
+			: previous(std::exchange(view, snapshot)), previous_shared(std::exchange(shared_view, shared)) {}
+		~cycle_view() {
+			view = previous;
+			shared_view = previous_shared;
+		}
+		cycle_view(const cycle_view& other) = delete;
+		cycle_view& operator=(const cycle_view& other) = delete;
+	};
+
+	//* Option names known only at runtime, string literals go to the overloads taking a key
+	template <typename S>
+	concept dynamic_name = std::convertible_to<const S&, std::string_view> and not std::is_array_v<S>;
 
 	const vector<string> valid_graph_symbols = { "braille", "block", "tty" };
 	const vector<string> valid_graph_symbols_def = { "default", "braille", "block", "tty" };
@@ -104,9 +431,10 @@ namespace Config {
 	extern vector<string> available_batteries;
 	extern int current_preset;
 
-	extern bool write_new;
+	extern std::atomic<bool> write_new;
 
 	constexpr int ONE_DAY_MILLIS = 1000 * 60 * 60 * 24;
+	constexpr int PROC_COLLECT_THREADS_MAX = 64;
 
 	[[nodiscard]] std::optional<std::filesystem::path> get_config_dir() noexcept;
 
@@ -124,16 +452,23 @@ namespace Config {
 	//* Apply selected preset
 	bool apply_preset(const string& preset);
 
-	bool _locked(const std::string_view name);
+	//* Return bool for config key <key>
+	inline bool getB(bool_key key) { return view ? view->bools[key.id] : bools[key.id]; }
+
+	//* Return integer for config key <key>
+	inline const int& getI(int_key key) { return view ? view->ints[key.id] : ints[key.id]; }
 
-	//* Return bool for config key <name>
-	inline bool getB(const std::string_view name) { return bools.at(name); }
+	//* Return string for config key <key>
+	inline const string& getS(string_key key) { return view ? view->strings[key.id] : strings[key.id]; }
 
-	//* Return integer for config key <name>
-	inline const int& getI(const std::string_view name) { return ints.at(name); }
+	template <dynamic_name S>
+	inline bool getB(const S& name) { return getB(bools.key_of(name)); }
 
-	//* Return string for config key <name>
-	inline const string& getS(const std::string_view name) { return strings.at(name); }
+	template <dynamic_name S>
+	inline const int& getI(const S& name) { return getI(ints.key_of(name)); }
+
+	template <dynamic_name S>
+	inline const string& getS(const S& name) { return getS(strings.key_of(name)); }
 
 	string getAsString(const std::string_view name);
 
@@ -142,32 +477,43 @@ namespace Config {
 	bool intValid(const std::string_view name, const string& value);
 	bool stringValid(const std::string_view name, const string& value);
 
-	//* Set config key <name> to bool <value>
-	inline void set(const std::string_view name, bool value) {
-		if (_locked(name)) boolsTmp.insert_or_assign(name, value);
-		else bools.at(name) = value;
-	}
+	//* Set config key <key> to bool <value>, changes made during a runner cycle are seen by the rest
+	//* of the cycle right away and by the main thread after the next publish()
+	void set(bool_key key, bool value);
 
-	//* Set config key <name> to int <value>
-	inline void set(const std::string_view name, const int value) {
-		if (_locked(name)) intsTmp.insert_or_assign(name, value);
-		else ints.at(name) = value;
-	}
+	//* Set config key <key> to int <value>
+	void set(int_key key, const int value);
 
-	//* Set config key <name> to string <value>
-	inline void set(const std::string_view name, const string& value) {
-		if (_locked(name)) stringsTmp.insert_or_assign(name, value);
-		else strings.at(name) = value;
-	}
+	//* Set config key <key> to string <value>
+	void set(string_key key, const string& value);
+
+	template <dynamic_name S>
+	inline void set(const S& name, bool value) { set(bools.key_of(name), value); }
+
+	template <dynamic_name S>
+	inline void set(const S& name, const int value) { set(ints.key_of(name), value); }
+
+	template <dynamic_name S>
+	inline void set(const S& name, const string& value) { set(strings.key_of(name), value); }
 
-	//* Flip config key bool <name>
-	void flip(const std::string_view name);
+	//* Flip config key bool <key>
+	void flip(bool_key key);
 
-	//* Lock config and cache changes until unlocked
-	void lock();
+	//* Flip config key bool <name>, does nothing if there is no such option
+	template <dynamic_name S>
+	inline void flip(const S& name) { if (bools.contains(name)) flip(bools.key_of(name)); }
 
-	//* Unlock config and write any cached values to config
-	void unlock();
+	//* Write changes made during runner cycles and the process list selection to the live values
+	void merge();
+
+	//* Merge and make a snapshot of the live values for the next runner cycle
+	void publish();
+
+	//* Latest published snapshot, called by the runner thread at the start of each cycle
+	Snapshot* acquire();
+
+	//* Copy changes queued by collector threads into this thread's snapshot, called by the runner once they're done
+	void sync_view();
 
 	//* Load the config file from disk
 	void load(const std::filesystem::path& conf_file, vector<string>& load_warnings);
@@ -212,6 +558,20 @@ namespace Config {
 		const string& cmdline
 	);
 
+	// Same as above for the process <pid> started at <starttime>, remembered per process until the process configs change
+	// Returns nullptr if no match, the config stays valid until the configs change. For the runner thread only
+	const ProcessLogConfig* find_process_config(size_t pid, uint64_t starttime, const string& name, const string& cmdline);
+
+	// Forget what find_process_config remembered for <pid>, for when its name or command changed
+	void forget_process_config(size_t pid);
+
+	// Forget what find_process_config remembered for pids where <keep>(pid) is false
+	void retain_process_configs(const std::function<bool(size_t)>& keep);
+
+	// Counter that changes whenever the process configs are loaded, saved, removed or reloaded
+	// Lets callers cache find_process_config results until the next change
+	uint64_t process_configs_version() noexcept;
+
 	// Save a process log config (add or update)
 	void save_process_config(const ProcessLogConfig& config);
 
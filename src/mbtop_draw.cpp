@@ -19,6 +19,7 @@ tab-size = 4
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <filesystem>
 #include <iterator>
 #include <ranges>
@@ -182,9 +183,9 @@ namespace Draw {
 			const int x = std::max(1, Term::width / 2 - box_width / 2);
 			const int y = Term::height / 2;
 
-			out += Mv::to(y - 1, x) + Theme::c("title") + Fx::b + "┌" + Symbols::h_line * (box_width - 2) + "┐";
-			out += Mv::to(y, x) + "│ " + Theme::c("hi_fg") + full_msg + Theme::c("title") + " │";
-			out += Mv::to(y + 1, x) + "└" + Symbols::h_line * (box_width - 2) + "┘" + Fx::ub;
+			append(out, Mv::to(y - 1, x), Theme::c("title"), Fx::b, "┌", Symbols::h_line * (box_width - 2), "┐");
+			append(out, Mv::to(y, x), "│ ", Theme::c("hi_fg"), full_msg, Theme::c("title"), " │");
+			append(out, Mv::to(y + 1, x), "└", Symbols::h_line * (box_width - 2), "┘", Fx::ub);
 		}
 		else {
 			//? Two-line layout - check if lines fit, otherwise truncate
@@ -216,10 +217,10 @@ namespace Draw {
 			const int line1_pad = (actual_content_width - display_line1_len) / 2;
 			const int line2_pad = (actual_content_width - display_line2_len) / 2;
 
-			out += Mv::to(y - 1, x) + Theme::c("title") + Fx::b + "┌" + Symbols::h_line * (box_width - 2) + "┐";
-			out += Mv::to(y, x) + "│ " + string(line1_pad, ' ') + Theme::c("hi_fg") + line1 + string(actual_content_width - display_line1_len - line1_pad, ' ') + Theme::c("title") + " │";
-			out += Mv::to(y + 1, x) + "│ " + string(line2_pad, ' ') + Theme::c("hi_fg") + line2 + string(actual_content_width - display_line2_len - line2_pad, ' ') + Theme::c("title") + " │";
-			out += Mv::to(y + 2, x) + "└" + Symbols::h_line * (box_width - 2) + "┘" + Fx::ub;
+			append(out, Mv::to(y - 1, x), Theme::c("title"), Fx::b, "┌", Symbols::h_line * (box_width - 2), "┐");
+			append(out, Mv::to(y, x), "│ ", string(line1_pad, ' '), Theme::c("hi_fg"), line1, string(actual_content_width - display_line1_len - line1_pad, ' '), Theme::c("title"), " │");
+			append(out, Mv::to(y + 1, x), "│ ", string(line2_pad, ' '), Theme::c("hi_fg"), line2, string(actual_content_width - display_line2_len - line2_pad, ' '), Theme::c("title"), " │");
+			append(out, Mv::to(y + 2, x), "└", Symbols::h_line * (box_width - 2), "┘", Fx::ub);
 		}
 
 		return out;
@@ -357,21 +358,21 @@ namespace Draw {
 
 		//? Draw horizontal lines
 		for (const int& hpos : {y, y + height - 1}) {
-			out += Mv::to(hpos, x) + Symbols::h_line * (width - 1);
+			append(out, Mv::to(hpos, x), Symbols::h_line * (width - 1));
 		}
 
 		//? Draw vertical lines and fill if enabled
 		for (const int& hpos : iota(y + 1, y + height - 1)) {
-			out += Mv::to(hpos, x) + Symbols::v_line
-				+  ((fill) ? string(width - 2, ' ') : Mv::r(width - 2))
-				+  Symbols::v_line;
+			append(out, Mv::to(hpos, x), Symbols::v_line,
+				((fill) ? string(width - 2, ' ') : Mv::r(width - 2)),
+				Symbols::v_line);
 		}
 
 		//? Draw corners
-		out += 	Mv::to(y, x) + left_up
-			+	Mv::to(y, x + width - 1) + right_up
-			+	Mv::to(y + height - 1, x) +left_down
-			+	Mv::to(y + height - 1, x + width - 1) + right_down;
+		append(out, Mv::to(y, x), left_up,
+			Mv::to(y, x + width - 1), right_up,
+			Mv::to(y + height - 1, x), left_down,
+			Mv::to(y + height - 1, x + width - 1), right_down);
 
 		//? Check if instance indicator is shown AND this is the top panel (y == 1)
 		const bool show_indicator = Config::getB("show_instance_indicator");
@@ -383,19 +384,19 @@ namespace Draw {
 		if (draw_indicator) {
 			const string indicator_str = Config::another_instance_running ? "S" : "P";
 			const string& indicator_color = Config::another_instance_running ? nord_green : nord_orange;
-			out += Mv::to(y, x + 1) + line_color + Symbols::h_line + Symbols::div_left
-				+ indicator_color + Fx::b + indicator_str
-				+ line_color + Fx::ub + Symbols::div_right;
+			append(out, Mv::to(y, x + 1), line_color, Symbols::h_line, Symbols::div_left,
+				indicator_color, Fx::b, indicator_str,
+				line_color, Fx::ub, Symbols::div_right);
 		}
 
 		//? Draw titles if defined
 		if (not title.empty()) {
-			out += Mv::to(y, x + title_offset) + line_color + Symbols::title_left + Fx::b + numbering 
-				+ Theme::c("title") + string(title) + Fx::ub + line_color + Symbols::title_right;
+			append(out, Mv::to(y, x + title_offset), line_color, Symbols::title_left, Fx::b, numbering, 
+				Theme::c("title"), string(title), Fx::ub, line_color, Symbols::title_right);
 		}
 		if (not title2.empty()) {
-			out += Mv::to(y + height - 1, x + 2) + line_color + Symbols::title_left_down + Fx::b + numbering 
-				+ Theme::c("title") + string(title2) + Fx::ub + line_color + Symbols::title_right_down;
+			append(out, Mv::to(y + height - 1, x + 2), line_color, Symbols::title_left_down, Fx::b, numbering, 
+				Theme::c("title"), string(title2), Fx::ub, line_color, Symbols::title_right_down);
 		}
 
 		return out + Fx::reset + Mv::to(y + 1, x + 1);
@@ -454,9 +455,9 @@ namespace Draw {
 		// Render clock - positioned left of update interval
 		clock_str = uresize(clock_str, std::max(8, update_pos - x - 30));
 		const int clock_pos = update_pos - clock_str.size() - 4;
-		out += Mv::to(y, clock_pos) + Fx::ub + Theme::c("cpu_box") + title_left;
-		out += Theme::c("title") + Fx::b + clock_str;
-		out += Theme::c("cpu_box") + Fx::ub + title_right;
+		append(out, Mv::to(y, clock_pos), Fx::ub, Theme::c("cpu_box"), title_left);
+		append(out, Theme::c("title"), Fx::b, clock_str);
+		append(out, Theme::c("cpu_box"), Fx::ub, title_right);
 
 		return true;
 	}
@@ -496,8 +497,8 @@ namespace Draw {
 		}
 
 		// Position hostname at CENTER
-		out += Mv::to(y, x + (width / 2) - (hostname_len / 2)) + Fx::ub + Theme::c("cpu_box") + title_left
-			+ Theme::c("title") + Fx::b + display_host + Theme::c("cpu_box") + Fx::ub + title_right;
+		append(out, Mv::to(y, x + (width / 2) - (hostname_len / 2)), Fx::ub, Theme::c("cpu_box"), title_left,
+			Theme::c("title"), Fx::b, display_host, Theme::c("cpu_box"), Fx::ub, title_right);
 
 		return true;
 	}
@@ -544,8 +545,8 @@ namespace Draw {
 	//* Meter class ------------------------------------------------------------------------------------------------------------>
 	Meter::Meter() {}
 
-	Meter::Meter(const int width, string color_gradient, bool invert)
-		: width(width), color_gradient(std::move(color_gradient)), invert(invert) {}
+	Meter::Meter(const int width, const string& color_gradient, bool invert)
+		: width(width), gradient(color_gradient), invert(invert) {}
 
 	string Meter::operator()(int value) {
 		if (width < 1) return "";
@@ -555,9 +556,9 @@ namespace Draw {
 		for (const int& i : iota(1, width + 1)) {
 			int y = round((double)i * 100.0 / width);
 			if (value >= y)
-				out += Theme::g(color_gradient).at(invert ? 100 - y : y) + Symbols::meter;
+				append(out, Theme::g(gradient).at(invert ? 100 - y : y), Symbols::meter);
 			else {
-				out += Theme::c("meter_bg") + Symbols::meter * (width + 1 - i);
+				append(out, Theme::c("meter_bg"), Symbols::meter * (width + 1 - i));
 				break;
 			}
 		}
@@ -567,68 +568,126 @@ namespace Draw {
 
 	//* Graph class ------------------------------------------------------------------------------------------------------------>
 
-	//? Helper to reverse a graph line string for LTR direction
-	//? Handles: Mv::r(1) = 4 bytes, [color][braille] = variable+3, pure braille = 3 bytes, space = 1 byte
-	string reverse_graph_line(const string& line) {
-		if (line.empty()) return line;
+	void Graph::_drop(Ring& ring) {
+		if (ring.size == 0) return;
+		for (int row = 0; auto& r : ring.rows) {
+			const auto len = ring.lens[(size_t)row++ * width + ring.head];
+			if (direction == 0) r.begin += len;
+			else r.end -= len;
+		}
+		ring.head = (ring.head + 1) % width;
+		ring.size--;
+	}
 
-		vector<string> units;
-		size_t pos = 0;
+	int Graph::_claim(Ring& ring) {
+		if (ring.size == width) _drop(ring);
+		return (ring.head + ring.size++) % width;
+	}
 
-		while (pos < line.size()) {
-			if (line[pos] == '\033') {
-				//? Escape sequence - check if cursor move or color
-				if (pos + 3 < line.size() and line[pos + 1] == '[' and line[pos + 3] == 'C') {
-					//? Mv::r(1) = "\033[1C" (4 bytes)
-					units.push_back(line.substr(pos, 4));
-					pos += 4;
-				}
-				else {
-					//? Color code ending in 'm', followed by 3-byte braille
-					size_t m_pos = line.find('m', pos);
-					if (m_pos != string::npos and m_pos + 3 <= line.size()) {
-						units.push_back(line.substr(pos, (m_pos - pos) + 1 + 3));
-						pos = m_pos + 4;
-					}
-					else {
-						//? Malformed - just take rest
-						units.push_back(line.substr(pos));
-						break;
-					}
-				}
-			}
-			else if (line[pos] == ' ') {
-				//? Space padding (1 byte)
-				units.push_back(" ");
-				pos += 1;
-			}
-			else if ((unsigned char)line[pos] >= 0xE2) {
-				//? Pure braille character (3 bytes UTF-8)
-				if (pos + 3 <= line.size()) {
-					units.push_back(line.substr(pos, 3));
-					pos += 3;
-				}
-				else {
-					units.push_back(line.substr(pos));
-					break;
-				}
+	void Graph::_put(Ring& ring, int row, int slot, std::string_view cell) {
+		auto& r = ring.rows[row];
+		const size_t len = cell.size(), live = r.end - r.begin;
+		ring.lens[(size_t)row * width + slot] = (uint8_t)len;
+
+		//? Out of room on the growing side, move the window to the other end of a buffer at least twice its size
+		//? so this happens at most once every few ticks
+		if (direction == 0 ? r.end + len > r.buf.size() : r.begin < len) {
+			if (r.buf.size() < (live + len) * 2) {
+				string grown((live + len) * 2, ' ');
+				const size_t to = (direction == 0) ? 0 : grown.size() - live;
+				std::copy_n(r.buf.data() + r.begin, live, grown.data() + to);
+				r.buf.swap(grown);
+				r.begin = to;
 			}
 			else {
-				//? Unknown - take single byte
-				units.push_back(line.substr(pos, 1));
-				pos += 1;
+				const size_t to = (direction == 0) ? 0 : r.buf.size() - live;
+				std::memmove(r.buf.data() + to, r.buf.data() + r.begin, live);
+				r.begin = to;
 			}
+			r.end = r.begin + live;
+		}
+		if (direction == 0) {
+			std::copy_n(cell.data(), len, r.buf.data() + r.end);
+			r.end += len;
 		}
+		else {
+			r.begin -= len;
+			std::copy_n(cell.data(), len, r.buf.data() + r.begin);
+		}
+	}
+
+	Graph::Bar Graph::_bar(long long value) const {
+		//? Column thresholds grow from the starting edge, so the filled columns are a prefix
+		Bar bar{value, 0, 0};
+		while (bar.full < width and value >= (bar.full + 1) * 100 / width) bar.full++;
+		bar.half = bar.full;
+		while (bar.half < width and value >= (bar.half * 2 + 1) * 50 / width) bar.half++;
+		return bar;
+	}
 
-		//? Reverse and rebuild
-		string result;
-		for (auto it = units.rbegin(); it != units.rend(); ++it) {
-			result += *it;
+	void Graph::_create_bars(const deque<long long>& data, int data_offset) {
+		const int count = (int)bars.size();
+		for (int i = max(data_offset, (int)data.size() - count); i < (int)data.size(); ++i) {
+			long long value = data.at(i);
+			if (max_value > 0) value = clamp((value + offset) * 100 / max_value, 0ll, 100ll);
+			bars_head = (bars_head + count - 1) % count;
+			bars[bars_head] = _bar(value);
+		}
+		//? Values that dropped out of <data> are drawn as 0
+		const int shown = min(count, (int)data.size());
+		const Bar empty = _bar(0);
+		out.clear();
+
+		//? TTB: start at top, move DOWN (Mv::d), newest at top
+		//? BTT: start at bottom, move UP (Mv::u), newest at bottom (exact reverse of TTB)
+		const bool bottom_to_top = (direction == 3);
+		//? Braille dots for both, the left and the right dot of each dot row, top row first
+		static constexpr array<int, 4> both_dots = {0x09, 0x12, 0x24, 0xC0};
+		static constexpr array<int, 4> left_dots = {0x01, 0x02, 0x04, 0x40};
+		static constexpr array<int, 4> right_dots = {0x08, 0x10, 0x20, 0x80};
+		const auto& half_dots = invert ? right_dots : left_dots;
+
+		for (int row = 0; row < height; ++row) {
+			if (row > 0) out += (bottom_to_top ? Mv::u(1) : Mv::d(1)) + Mv::l(width);
+
+			//? The 4 values of this row - row 0 = newest (at cursor start position)
+			//? TTB: sub 0→top dots, sub 3→bottom dots, BTT: sub 0→bottom dots, sub 3→top dots
+			array<const Bar*, 4> row_bars;
+			bool row_has_data = false;
+			for (int sub = 0; sub < 4; ++sub) {
+				const int age = row * 4 + sub;
+				const auto* bar = (age < shown) ? &bars[(bars_head + age) % count] : &empty;
+				row_bars[bottom_to_top ? 3 - sub : sub] = bar;
+				if (bar->value > 0) row_has_data = true;
+			}
+
+			//? Horizontal bar: each character = 2 horizontal dots (left, right)
+			//? invert=false: fill left→right, invert=true: fill right→left (mirrored)
+			for (int col = 0; col < width; ++col) {
+				const int threshold_col = invert ? (width - 1 - col) : col;
+				int dots = 0;
+
+				//? First column minimum: if row has any data, fill all 4 dots on starting edge
+				if (threshold_col == 0 and row_has_data) dots |= invert ? 0xB8 : 0x47;
+
+				for (int dot_pos = 0; dot_pos < 4; ++dot_pos) {
+					if (threshold_col < row_bars[dot_pos]->full) dots |= both_dots[dot_pos];
+					else if (threshold_col < row_bars[dot_pos]->half) dots |= half_dots[dot_pos];
+				}
+
+				if (not bar_colors.empty()) out += bar_colors[col];
+
+				//? Always output braille character (even empty ⠀ U+2800 when value is 0)
+				//? UTF-8 for U+2800-U+28FF: E2 [A0-A3] [80-BF]
+				const char utf8[3] = { '\xE2', (char)(0xA0 + (dots >> 6)), (char)(0x80 + (dots & 0x3F)) };
+				out.append(utf8, 3);
+			}
 		}
-		return result;
+		if (not color_gradient.empty()) out += Fx::reset;
 	}
 
 	void Graph::_create(const deque<long long>& data, int data_offset) {
+		if (direction >= 2) return _create_bars(data, data_offset);
 		bool mult = (data.size() - data_offset > 1);
 		const auto& graph_symbol = Symbols::graph_symbols.at(symbol + '_' + (invert ? "down" : "up"));
 		array<int, 2> result;
@@ -645,9 +704,12 @@ namespace Draw {
 		}
 
 		//? Horizontal iteration over values in <data>
+		string cell;
 		for (const int& i : indices) {
 			// if (tty_mode and mult and i % 2 != 0) continue;
 			if (not tty_mode and mult) current = not current;
+			auto& ring = rings[current];
+			const int slot = _claim(ring);
 			if (i < 0) {
 				data_value = 0;
 				last = 0;
@@ -664,8 +726,9 @@ namespace Draw {
 				//? Calculate previous + current value to fit two values in 1 braille character
 				//? RTL: left=last, right=current (newest on right)
 				//? LTR: left=current, right=last (newest on left)
-				const auto value_order = (direction == 0) ? std::initializer_list<long long>{last, data_value}
-				                                          : std::initializer_list<long long>{data_value, last};
+				//? Held in an array, the backing array of an initializer_list picked by ?: would not outlive the statement
+				const auto value_order = (direction == 0) ? array<long long, 2>{last, data_value}
+				                                          : array<long long, 2>{data_value, last};
 				for (int ai = 0; const auto& value : value_order) {
 					const int clamp_min = (no_zero and horizon == height - 1 and not (mult and i == data_offset and ai == 0)) ? 1 : 0;
 					if (value >= cur_high)
@@ -680,138 +743,40 @@ namespace Draw {
 				//? RTL: append (newest at end), LTR: prepend (newest at start)
 				if (height == 1) {
 					if (result.at(0) + result.at(1) == 0 and not no_zero) {
-						if (direction == 0)
-							graphs.at(current).at(horizon) += Mv::r(1);
-						else
-							graphs.at(current).at(horizon) = Mv::r(1) + graphs.at(current).at(horizon);
+						cell = Mv::r(1);
 					}
 					else {
 						if (no_zero and result.at(0) + result.at(1) == 0) result[1] = 1;
-						if (direction == 0) {
-							if (not color_gradient.empty()) graphs.at(current).at(horizon) += Theme::g(color_gradient).at(clamp(max(last, data_value), 0ll, 100ll));
-							graphs.at(current).at(horizon) += graph_symbol.at((result.at(0) * 5 + result.at(1)));
-						} else {
-							string new_char;
-							if (not color_gradient.empty()) new_char = Theme::g(color_gradient).at(clamp(max(last, data_value), 0ll, 100ll));
-							new_char += graph_symbol.at((result.at(0) * 5 + result.at(1)));
-							graphs.at(current).at(horizon) = new_char + graphs.at(current).at(horizon);
-						}
+						cell.clear();
+						if (not color_gradient.empty()) cell += Theme::g(gradient).at(clamp(max(last, data_value), 0ll, 100ll));
+						cell += graph_symbol.at((result.at(0) * 5 + result.at(1)));
 					}
 				}
 				else {
-					if (direction == 0)
-						graphs.at(current).at(horizon) += graph_symbol.at((result.at(0) * 5 + result.at(1)));
-					else
-						graphs.at(current).at(horizon) = graph_symbol.at((result.at(0) * 5 + result.at(1))) + graphs.at(current).at(horizon);
+					cell = graph_symbol.at((result.at(0) * 5 + result.at(1)));
 				}
+				_put(ring, horizon, slot, cell);
 			}
 			if (mult and i >= 0) last = data_value;
 		}
 		last = data_value;
 		out.clear();
 
-		//? Vertical graphs (direction 2=TTB, 3=BTT): build horizontal bars from raw data
-		if (direction >= 2) {
-			//? TTB: start at top, move DOWN (Mv::d), newest at top
-			//? BTT: start at bottom, move UP (Mv::u), newest at bottom (exact reverse of TTB)
-			const bool bottom_to_top = (direction == 3);
-			for (int row = 0; row < height; ++row) {
-				if (row > 0) out += (bottom_to_top ? Mv::u(1) : Mv::d(1)) + Mv::l(width);
-
-				//? Get 4 data points for this row - row 0 = newest (at cursor start position)
-				array<long long, 4> row_values = {0, 0, 0, 0};
-				for (int sub = 0; sub < 4; ++sub) {
-					int data_idx = (int)data.size() - 1 - (row * 4 + sub);
-					if (data_idx >= 0 and data_idx < (int)data.size()) {
-						long long val = data.at(data_idx);
-						if (max_value > 0) val = clamp((val + offset) * 100 / max_value, 0ll, 100ll);
-						row_values[sub] = val;
-					}
-				}
-
-				//? Build horizontal bar: each character = 2 horizontal dots (left, right)
-				//? invert=false: fill left→right, invert=true: fill right→left (mirrored)
-				//? Minimum visual: if ANY data in row, first braille char shows all 4 left dots
-				const bool row_has_data = (row_values[0] > 0 or row_values[1] > 0 or
-				                           row_values[2] > 0 or row_values[3] > 0);
-				for (int col = 0; col < width; ++col) {
-					//? For inverted, calculate thresholds from right side
-					int threshold_col = invert ? (width - 1 - col) : col;
-					const int col_mid = (threshold_col * 2 + 1) * 50 / width;
-					const int col_high = (threshold_col + 1) * 100 / width;
-
-					//? Calculate braille pattern: 4 rows, each with 0/1/2 horizontal fill
-					//? Braille dots: 1=0x01, 2=0x02, 3=0x04, 4=0x08, 5=0x10, 6=0x20, 7=0x40, 8=0x80
-					//? TTB: sub 0→top dots, sub 3→bottom dots (normal order)
-					//? BTT: sub 0→bottom dots, sub 3→top dots (reversed order)
-					int pattern = 0x2800;  //? Braille base
-
-					//? First column minimum: if row has any data, fill all 4 dots on starting edge
-					if (threshold_col == 0 and row_has_data) {
-						if (invert)
-							pattern |= 0xB8;  //? dots 4,5,6,8 (right column of braille) for inverted
-						else
-							pattern |= 0x47;  //? dots 1,2,3,7 (left column of braille) for normal
-					}
-
-					for (int sub = 0; sub < 4; ++sub) {
-						const int val = (int)row_values[sub];
-						//? For BTT, reverse dot position: sub 0→3, 1→2, 2→1, 3→0
-						const int dot_pos = bottom_to_top ? (3 - sub) : sub;
-						if (val >= col_high) {
-							//? Full: both dots (left + right)
-							if (dot_pos == 0) pattern |= 0x09;       //? dots 1,4
-							else if (dot_pos == 1) pattern |= 0x12;  //? dots 2,5
-							else if (dot_pos == 2) pattern |= 0x24;  //? dots 3,6
-							else pattern |= 0xC0;                    //? dots 7,8
-						} else if (val >= col_mid) {
-							//? Half: for normal fill left dot, for inverted fill right dot
-							if (not invert) {
-								if (dot_pos == 0) pattern |= 0x01;       //? dot 1
-								else if (dot_pos == 1) pattern |= 0x02;  //? dot 2
-								else if (dot_pos == 2) pattern |= 0x04;  //? dot 3
-								else pattern |= 0x40;                    //? dot 7
-							} else {
-								if (dot_pos == 0) pattern |= 0x08;       //? dot 4
-								else if (dot_pos == 1) pattern |= 0x10;  //? dot 5
-								else if (dot_pos == 2) pattern |= 0x20;  //? dot 6
-								else pattern |= 0x80;                    //? dot 8
-							}
-						}
-					}
-
-					//? Add color gradient based on amplitude (inverted uses opposite direction)
-					if (not color_gradient.empty()) {
-						int grad_val = invert ? ((width - col) * 100 / width) : ((col + 1) * 100 / width);
-						out += Theme::g(color_gradient).at(clamp(grad_val, 0, 100));
-					}
-
-					//? Always output braille character (even empty ⠀ U+2800 when value is 0)
-					//? UTF-8 for U+2800-U+28FF: E2 [A0-A3] [80-BF]
-					const int dots = pattern & 0xFF;  //? Extract dot pattern (0-255)
-					char utf8[4];
-					utf8[0] = 0xE2;
-					utf8[1] = 0xA0 + (dots >> 6);     //? A0 for 0-63, A1 for 64-127, A2 for 128-191, A3 for 192-255
-					utf8[2] = 0x80 + (dots & 0x3F);   //? Lower 6 bits
-					utf8[3] = 0;
-					out += utf8;
-				}
-			}
-			if (not color_gradient.empty()) out += Fx::reset;
-		}
-		//? Horizontal graphs (direction 0=RTL, 1=LTR): use buffer strings
-		else if (height == 1) {
-			out += graphs.at(current).at(0);
+		//? Rows are kept in output order for both directions
+		if (height == 1) {
+			const auto& row = rings[current].rows.at(0);
+			out.append(row.buf, row.begin, row.end - row.begin);
 		}
 		else {
 			for (const int& i : iota(1, height + 1)) {
 				if (i > 1) out += Mv::d(1) + Mv::l(width);
 				if (not color_gradient.empty())
-					out += (invert) ? Theme::g(color_gradient).at(i * 100 / height) : Theme::g(color_gradient).at(100 - ((i - 1) * 100 / height));
-				out += (invert) ? graphs.at(current).at(height - i) : graphs.at(current).at(i-1);
+					out += (invert) ? Theme::g(gradient).at(i * 100 / height) : Theme::g(gradient).at(100 - ((i - 1) * 100 / height));
+				const auto& row = rings[current].rows.at((invert) ? height - i : i - 1);
+				out.append(row.buf, row.begin, row.end - row.begin);
 			}
 		}
-		if (direction < 2 and not color_gradient.empty()) out += Fx::reset;
+		if (not color_gradient.empty()) out += Fx::reset;
 	}
 
 	Graph::Graph() {}
@@ -822,6 +787,7 @@ namespace Draw {
 				 int direction)
 	: width(width), height(height), color_gradient(color_gradient),
 	  invert(invert), no_zero(no_zero), direction(direction), offset(offset) {
+		if (not color_gradient.empty()) gradient = Theme::gradient_key(color_gradient);
 		if (Config::getB("tty_mode") or symbol == "tty") this->symbol = "tty";
 		else if (symbol != "default") this->symbol = symbol;
 		else this->symbol = Config::getS("graph_symbol");
@@ -837,11 +803,29 @@ namespace Draw {
 			data_offset--;
 		}
 
-		//? Populate graph vectors and fill empty space if data size < width
-		//? Both directions use double buffer - same logic, different output position
-		for (const int& i : iota(0, height * 2)) {
-			if (tty_mode and i % 2 != current) continue;
-			graphs[(i % 2 != 0)].push_back((value_width < width) ? ((height == 1) ? Mv::r(1) : " "s) * (width - value_width) : "");
+		if (width < 1 or height < 1) return;
+
+		//? Vertical graphs (direction 2=TTB, 3=BTT) draw each of the last height * 4 values as a horizontal bar
+		if (direction >= 2) {
+			bars.assign(height * 4, _bar(0));
+			if (not color_gradient.empty()) {
+				for (const int& col : iota(0, width)) {
+					const int grad_val = invert ? ((width - col) * 100 / width) : ((col + 1) * 100 / width);
+					bar_colors.push_back(Theme::g(gradient).at(clamp(grad_val, 0, 100)));
+				}
+			}
+			if (data.size() > 0) _create_bars(data, 0);
+			return;
+		}
+
+		//? Size the rings and fill empty space if data size < width, padding counts as the oldest columns
+		for (const bool buffer : {false, true}) {
+			if (tty_mode and buffer != current) continue;
+			const string pad = (height == 1) ? Mv::r(1) : " "s;
+			auto& ring = rings[buffer];
+			ring.size = max(0, width - value_width);
+			ring.lens.assign((size_t)height * width, (uint8_t)pad.size());
+			ring.rows.assign(height, {pad * ring.size, 0, pad.size() * ring.size});
 		}
 		if (data.size() == 0) return;
 		this->_create(data, data_offset);
@@ -851,31 +835,13 @@ namespace Draw {
 		if (data_same) return out;
 
 		//? Safety check: return empty if Graph wasn't properly initialized
-		if (graphs.empty() or height == 0 or width == 0) return out;
+		if (height < 1 or width < 1) return out;
 
 		//? Toggle buffers for smooth animation
 		if (not tty_mode) current = not current;
 
-		//? Make room for new characters on graph
-		//? RTL: remove from start (oldest on left), LTR: remove from end (oldest on right)
-		for (const int& i : iota(0, height)) {
-			auto& graph_line = graphs.at(current).at(i);
-			if (direction == 1) {
-				//? LTR: reverse, apply RTL removal, reverse back
-				graph_line = reverse_graph_line(graph_line);
-			}
-			//? RTL removal logic (also used for reversed LTR)
-			if (height == 1 and graph_line.at(1) == '[') {
-				if (graph_line.at(3) == 'C') graph_line = graph_line.substr(4);
-				else graph_line = graph_line.substr(graph_line.find_first_of('m') + 4);
-			}
-			else if (graph_line.at(0) == ' ') graph_line = graph_line.substr(1);
-			else graph_line = graph_line.substr(3);
-			if (direction == 1) {
-				//? LTR: reverse back
-				graph_line = reverse_graph_line(graph_line);
-			}
-		}
+		//? Make room for the new column by dropping the oldest
+		_drop(rings[current]);
 		this->_create(data, (int)data.size() - 1);
 		return out;
 	}
@@ -912,10 +878,10 @@ namespace Cpu {
 	vector<Draw::Graph> gpu_temp_graphs;
 	vector<Draw::Graph> gpu_mem_graphs;
 
-    string draw(const cpu_info& cpu, const vector<Gpu::gpu_info>& gpus, bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+    void draw(string& out, const cpu_info& cpu, const vector<Gpu::gpu_info>& gpus, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 		//? Defensive check: skip drawing if dimensions are invalid (terminal too small or resizing)
-		if (Cpu::width < 10 or Cpu::height < 5) return "";
+		if (Cpu::width < 10 or Cpu::height < 5) return;
 		if (force_redraw) redraw = true;
 
 		//? Force redraw if dimensions have changed since last draw (prevents scrambled text)
@@ -960,12 +926,10 @@ namespace Cpu {
 		static int bat_pos = 0, bat_len = 0;
 		if (safeVal(cpu.cpu_percent, "total"s).empty()
 			or safeVal(cpu.core_percent, 0).empty()
-			or (show_temps and safeVal(cpu.temp, 0).empty())) return "";
+			or (show_temps and safeVal(cpu.temp, 0).empty())) return;
 		if (safeVal(cpu.cpu_percent, "total"s).empty()
 			or safeVal(cpu.core_percent, 0).empty()
-			or (show_temps and safeVal(cpu.temp, 0).empty())) return "";
-		string out;
-		out.reserve(width * height);
+			or (show_temps and safeVal(cpu.temp, 0).empty())) return;
 
 		//* Redraw elements not needed to be updated every cycle
 		if (redraw) {
@@ -981,7 +945,7 @@ namespace Cpu {
 			const int ind_offset = (Config::getB("show_instance_indicator") and is_top_panel and not cpu_bottom) ? 4 : 0;
 
 			//? Buttons on title
-			out += Mv::to(button_y, x + 10 + ind_offset) + title_left + Theme::c("hi_fg") + Fx::b + 'm' + Theme::c("title") + "enu" + Fx::ub + title_right;
+			append(out, Mv::to(button_y, x + 10 + ind_offset), title_left, Theme::c("hi_fg"), Fx::b, 'm', Theme::c("title"), "enu", Fx::ub, title_right);
 			Input::mouse_mappings["m"] = {button_y, x + 11 + ind_offset, 1, 4};
 
 			//? Preset button with name
@@ -1001,8 +965,8 @@ namespace Cpu {
 				}
 			}
 			const int preset_btn_len = 7 + preset_display.size();  // "preset " + display
-			out += Mv::to(button_y, x + 16 + ind_offset) + title_left + Theme::c("hi_fg") + Fx::b + 'p' + Theme::c("title") + "reset "
-				+ preset_display + Fx::ub + title_right;
+			append(out, Mv::to(button_y, x + 16 + ind_offset), title_left, Theme::c("hi_fg"), Fx::b, 'p', Theme::c("title"), "reset ",
+				preset_display, Fx::ub, title_right);
 			Input::mouse_mappings["p"] = {button_y, x + 17 + ind_offset, 1, (int)preset_btn_len};
 
 			//? Optional header elements: uptime and username
@@ -1011,7 +975,7 @@ namespace Cpu {
 			// Draw container engine name if present
 			if (Cpu::container_engine.has_value()) {
 				const auto& container = Cpu::container_engine.value();
-				out += Mv::to(button_y, next_header_pos) + title_left + Theme::c("title") + container + title_right;
+				append(out, Mv::to(button_y, next_header_pos), title_left, Theme::c("title"), container, title_right);
 				next_header_pos += container.size() + 4;
 			}
 
@@ -1019,7 +983,7 @@ namespace Cpu {
 			if (Config::getB("show_uptime_header")) {
 				string upstr = sec_to_dhms(system_uptime());
 				if (upstr.size() > 8) upstr.resize(upstr.size() - 3);
-				out += Mv::to(button_y, next_header_pos) + title_left + Theme::c("title") + "up:" + upstr + title_right;
+				append(out, Mv::to(button_y, next_header_pos), title_left, Theme::c("title"), "up:", upstr, title_right);
 				next_header_pos += upstr.size() + 7;  // "up:" + upstr + borders
 			}
 
@@ -1027,14 +991,14 @@ namespace Cpu {
 			if (Config::getB("show_username_header")) {
 				string user = Tools::username();
 				if (not user.empty()) {
-					out += Mv::to(button_y, next_header_pos) + title_left + Theme::c("title") + user + title_right;
+					append(out, Mv::to(button_y, next_header_pos), title_left, Theme::c("title"), user, title_right);
 					next_header_pos += user.size() + 4;
 				}
 			}
 
 			const string update = to_string(Config::getI("update_ms")) + "ms";
-			out += Mv::to(button_y, x + width - update.size() - 8) + title_left + Fx::b + Theme::c("hi_fg") + "- " + Theme::c("title") + update
-				+ Theme::c("hi_fg") + " +" + Fx::ub + title_right;
+			append(out, Mv::to(button_y, x + width - update.size() - 8), title_left, Fx::b, Theme::c("hi_fg"), "- ", Theme::c("title"), update,
+				Theme::c("hi_fg"), " +", Fx::ub, title_right);
 			Input::mouse_mappings["-"] = {button_y, x + width - (int)update.size() - 7, 1, 2};
 			Input::mouse_mappings["+"] = {button_y, x + width - 5, 1, 2};
 
@@ -1161,10 +1125,10 @@ namespace Cpu {
 			cpu_meter = Draw::Meter{cpu_meter_width, "cpu"};
 
 			if (mid_line) {
-				out += Mv::to(y + graph_up_height + 1, x) + Fx::ub + Theme::c("cpu_box") + Symbols::div_left + Theme::c("div_line")
-					+ Symbols::h_line * (width - b_width - 2) + Symbols::div_right
-					+ Mv::to(y + graph_up_height + 1, x + ((width - b_width) / 2) - ((graph_up_field.size() + graph_lo_field.size()) / 2) - 4)
-					+ Theme::c("main_fg") + graph_up_field + Mv::r(1) + "▲▼" + Mv::r(1) + graph_lo_field;
+				append(out, Mv::to(y + graph_up_height + 1, x), Fx::ub, Theme::c("cpu_box"), Symbols::div_left, Theme::c("div_line"),
+					Symbols::h_line * (width - b_width - 2), Symbols::div_right,
+					Mv::to(y + graph_up_height + 1, x + ((width - b_width) / 2) - ((graph_up_field.size() + graph_lo_field.size()) / 2) - 4),
+					Theme::c("main_fg"), graph_up_field, Mv::r(1), "▲▼", Mv::r(1), graph_lo_field);
 			}
 
 			if (b_column_size > 0 or extra_width > 0) {
@@ -1215,23 +1179,23 @@ namespace Cpu {
 				const int current_pos = Term::width - current_len - 17;
 
 				if ((bat_pos != current_pos or bat_len != current_len) and bat_pos > 0 and not redraw)
-					out += Mv::to(y, bat_pos) + Fx::ub + Theme::c("cpu_box") + Symbols::h_line * (bat_len + 4);
+					append(out, Mv::to(y, bat_pos), Fx::ub, Theme::c("cpu_box"), Symbols::h_line * (bat_len + 4));
 				bat_pos = current_pos;
 				bat_len = current_len;
 
-				out += Mv::to(y, bat_pos) + title_left + Theme::c("title") + Fx::b + "BAT" + bat_symbol + ' ' + str_percent
-					+ (Term::width >= 100 ? Fx::ub + ' ' + bat_meter(percent) + Fx::b : "")
-					+ (not str_time.empty() ? ' ' + Theme::c("title") + str_time : "") + (not str_watts.empty() ? " " + Theme::c("title") + Fx::b + str_watts : "") + Fx::ub + title_right;
+				append(out, Mv::to(y, bat_pos), title_left, Theme::c("title"), Fx::b, "BAT", bat_symbol, ' ', str_percent,
+					(Term::width >= 100 ? Fx::ub + ' ' + bat_meter(percent) + Fx::b : ""),
+					(not str_time.empty() ? ' ' + Theme::c("title") + str_time : ""), (not str_watts.empty() ? " " + Theme::c("title") + Fx::b + str_watts : ""), Fx::ub, title_right);
 			}
 		}
 		else if (bat_pos > 0) {
-			out += Mv::to(y, bat_pos) + Fx::ub + Theme::c("cpu_box") + Symbols::h_line * (bat_len + 4);
+			append(out, Mv::to(y, bat_pos), Fx::ub, Theme::c("cpu_box"), Symbols::h_line * (bat_len + 4));
 			bat_pos = bat_len = 0;
 		}
 
 		try {
 			//? Cpu/Gpu graphs
-			out += Fx::ub + Mv::to(y + 1, x + 1);
+			append(out, Fx::ub, Mv::to(y + 1, x + 1));
 			auto draw_graphs = [&](vector<Draw::Graph>& graphs, const int graph_height, const int graph_width, const string& graph_field) {
 			#ifdef GPU_SUPPORT
 				if (graph_field.starts_with("gpu"))
@@ -1249,12 +1213,12 @@ namespace Cpu {
 							}
 							if (Gpu::count - (gpu_auto ? Gpu::shown : 0) > 1) {
 								auto i_str = to_string(i);
-								out += Mv::l(graph_width-1) + Mv::u(graph_height/2) + (graph_width > 5 ? "GPU" : "") + i_str
-									+ Mv::d(graph_height/2) + Mv::r(graph_width - 1 - (graph_width > 5)*3 - i_str.size());
+								append(out, Mv::l(graph_width-1), Mv::u(graph_height/2), (graph_width > 5 ? "GPU" : ""), i_str,
+									Mv::d(graph_height/2), Mv::r(graph_width - 1 - (graph_width > 5)*3 - i_str.size()));
 							}
 
 							if (++gpu_drawn < Gpu::count - (gpu_auto ? Gpu::shown : 0))
-								out += Theme::c("div_line") + (Symbols::v_line + Mv::l(1) + Mv::u(1))*graph_height + Mv::r(1) + Mv::d(1);
+								append(out, Theme::c("div_line"), (Symbols::v_line + Mv::l(1) + Mv::u(1))*graph_height, Mv::r(1), Mv::d(1));
 						}
 					}
 					else
@@ -1280,8 +1244,8 @@ namespace Cpu {
 					upstr.resize(upstr.size() - 3);
 					upstr = trans(upstr);
 				}
-				out += Mv::to(y + (single_graph or not Config::getB("cpu_invert_lower") ? 1 : height - 2), x + 2)
-					+ Theme::c("graph_text") + "up" + Mv::r(1) + upstr;
+				append(out, Mv::to(y + (single_graph or not Config::getB("cpu_invert_lower") ? 1 : height - 2), x + 2),
+					Theme::c("graph_text"), "up", Mv::r(1), upstr);
 			}
 
 		#ifdef __linux__
@@ -1292,25 +1256,25 @@ namespace Cpu {
 
 			//? Cpu clock and cpu meter
 			if (Config::getB("show_cpu_freq") and not cpuHz.empty())
-				out += Mv::to(b_y, b_x + b_width - (freq_range ? 20 : 10)) + Fx::ub + Theme::c("div_line")
-					+ Symbols::h_line * ((freq_range ? 17 : 7) - cpuHz.size())
-					+ Symbols::title_left + Fx::b + Theme::c("title") + cpuHz + Fx::ub + Theme::c("div_line") + Symbols::title_right;
+				append(out, Mv::to(b_y, b_x + b_width - (freq_range ? 20 : 10)), Fx::ub, Theme::c("div_line"),
+					Symbols::h_line * ((freq_range ? 17 : 7) - cpuHz.size()),
+					Symbols::title_left, Fx::b, Theme::c("title"), cpuHz, Fx::ub, Theme::c("div_line"), Symbols::title_right);
 
 		//? CPU line format matches GPU panel: " CPU " + meter + 5-digit % + 6-char temp graph + temp
-		out += Mv::to(b_y + 1, b_x + 1) + Theme::c("main_fg") + Fx::b + " CPU " + cpu_meter(safeVal(cpu.cpu_percent, "total"s).back());
+		append(out, Mv::to(b_y + 1, b_x + 1), Theme::c("main_fg"), Fx::b, " CPU ", cpu_meter(safeVal(cpu.cpu_percent, "total"s).back()));
 		if (show_temps and Pwr::shown) {
 			//? Right-align percentage when temp hidden - position at where temp section would end
 			out += Mv::to(b_y + 1, b_x + b_width - 7);  //? Position for "  100%|"
 		}
-		out += Theme::g("cpu").at(clamp(safeVal(cpu.cpu_percent, "total"s).back(), 0ll, 100ll)) + rjust(to_string(safeVal(cpu.cpu_percent, "total"s).back()), 5) + Theme::c("main_fg") + '%';
+		append(out, Theme::g("cpu").at(clamp(safeVal(cpu.cpu_percent, "total"s).back(), 0ll, 100ll)), rjust(to_string(safeVal(cpu.cpu_percent, "total"s).back()), 5), Theme::c("main_fg"), '%');
 		if (show_temps and not Pwr::shown) {
 			const auto [temp, unit] = celsius_to(safeVal(cpu.temp, 0).back(), temp_scale);
 			const auto temp_color = Theme::g("temp").at(clamp(safeVal(cpu.temp, 0).back(), 0ll, 100ll));  //? 100°C = max red
 			//? Always show temp graph (matching GPU panel behavior)
 			if (temp_graphs.size() >= 1ll)
-				out += ' ' + Theme::c("inactive_fg") + graph_bg * 6 + Mv::l(6) + temp_color
-					+ temp_graphs.at(0)(safeVal(cpu.temp, 0), data_same or redraw);
-			out += temp_color + rjust(to_string(temp), 4) + Theme::c("main_fg") + unit;  //? Apply temp color to value
+				append(out, ' ', Theme::c("inactive_fg"), graph_bg * 6, Mv::l(6), temp_color,
+					temp_graphs.at(0)(safeVal(cpu.temp, 0), data_same or redraw));
+			append(out, temp_color, rjust(to_string(temp), 4), Theme::c("main_fg"), unit);  //? Apply temp color to value
 		}
 
 		if (show_watts) {
@@ -1318,10 +1282,10 @@ namespace Cpu {
 			string cwatts_post = "W";
 
 			max_observed_pwr = max(max_observed_pwr, cpu.usage_watts);
-			out += Theme::g("cached").at(clamp(cpu.usage_watts / max_observed_pwr * 100.0f, 0.0f, 100.0f)) + cwatts + Theme::c("main_fg") + cwatts_post; 
+			append(out, Theme::g("cached").at(clamp(cpu.usage_watts / max_observed_pwr * 100.0f, 0.0f, 100.0f)), cwatts, Theme::c("main_fg"), cwatts_post); 
 		}
 
-			out += Theme::c("div_line") + Symbols::v_line;
+			append(out, Theme::c("div_line"), Symbols::v_line);
 		} catch (const std::exception& e) {
 			throw std::runtime_error("graphs, clock, meter : " + string{e.what()});
 		}
@@ -1360,25 +1324,25 @@ namespace Cpu {
 					display_num = n - Shared::eCoreCount;  //? P0, P1, P2, ... (relative to P-core start)
 				}
 			}
-			out += Mv::to(b_y + cy + 1, b_x + cx + 1) + Theme::c(enabled ? "main_fg" : "inactive_fg") + (Shared::coreCount < 100 ? Fx::b + core_prefix + Fx::ub : "")
-				+ ljust(to_string(display_num), core_width);
+			append(out, Mv::to(b_y + cy + 1, b_x + cx + 1), (enabled ? Theme::c("main_fg") : Theme::c("inactive_fg")), (Shared::coreCount < 100 ? Fx::b + core_prefix + Fx::ub : ""),
+				ljust(to_string(display_num), core_width));
 			if ((b_column_size > 0 or extra_width > 0) and cmp_less(n, core_graphs.size()))
-				out += Theme::c("inactive_fg") + graph_bg * (5 * b_column_size + extra_width) + Mv::l(5 * b_column_size + extra_width)
-					+ core_graphs.at(n)(safeVal(cpu.core_percent, n), data_same or redraw);
+				append(out, Theme::c("inactive_fg"), graph_bg * (5 * b_column_size + extra_width), Mv::l(5 * b_column_size + extra_width),
+					core_graphs.at(n)(safeVal(cpu.core_percent, n), data_same or redraw));
 
 			out += enabled ? Theme::g("cpu").at(clamp(safeVal(cpu.core_percent, n).back(), 0ll, 100ll)) : Theme::c("inactive_fg");
-			out += rjust(to_string(safeVal(cpu.core_percent, n).back()), (b_column_size < 2 ? 3 : 4)) + Theme::c(enabled ? "main_fg" : "inactive_fg") + '%';
+			append(out, rjust(to_string(safeVal(cpu.core_percent, n).back()), (b_column_size < 2 ? 3 : 4)), (enabled ? Theme::c("main_fg") : Theme::c("inactive_fg")), '%');
 
 			if (show_temps and not hide_cores) {
 				const auto [temp, unit] = celsius_to(safeVal(cpu.temp, n+1).back(), temp_scale);
 				const auto temp_color = enabled ? Theme::g("temp").at(clamp(safeVal(cpu.temp, n+1).back(), 0ll, 100ll)) : Theme::c("inactive_fg");  //? 100°C = max red
 				if (b_column_size > 1 and std::cmp_greater_equal(temp_graphs.size(), n))
-					out += ' ' + Theme::c("inactive_fg") + graph_bg * 5 + Mv::l(5)
-						+ temp_graphs.at(n+1)(safeVal(cpu.temp, n+1), data_same or redraw);
-				out += temp_color + rjust(to_string(temp), 4) + Theme::c(enabled ? "main_fg" : "inactive_fg") + unit;
+					append(out, ' ', Theme::c("inactive_fg"), graph_bg * 5, Mv::l(5),
+						temp_graphs.at(n+1)(safeVal(cpu.temp, n+1), data_same or redraw));
+				append(out, temp_color, rjust(to_string(temp), 4), (enabled ? Theme::c("main_fg") : Theme::c("inactive_fg")), unit);
 			}
 
-			out += Theme::c("div_line") + Symbols::v_line;
+			append(out, Theme::c("div_line"), Symbols::v_line);
 
 			if ((++cy > ceil((double)Shared::coreCount / b_columns) or cy == max_row) and n != Shared::coreCount - 1) {
 				if (++cc >= b_columns) break;
@@ -1399,7 +1363,7 @@ namespace Cpu {
 			}
 
 			int len = load_avg_pre.size() + load_avg.size();
-			out += Mv::to(b_y + cy, b_x + 1) + string(max(b_width - len - 2, 0), ' ') + Theme::c("main_fg") + Fx::b + load_avg_pre + Fx::ub + load_avg;
+			append(out, Mv::to(b_y + cy, b_x + 1), string(max(b_width - len - 2, 0), ' '), Theme::c("main_fg"), Fx::b, load_avg_pre, Fx::ub, load_avg);
 		}
 
 	#ifdef GPU_SUPPORT
@@ -1408,7 +1372,7 @@ namespace Cpu {
 			for (unsigned long i = 0; i < gpus.size(); ++i) {
 				if (gpu_auto and v_contains(Gpu::shown_panels, i))
 					continue;
-				out += Mv::to(b_y + ++cy, b_x + 1) + Theme::c("main_fg") + Fx::b + " GPU";
+				append(out, Mv::to(b_y + ++cy, b_x + 1), Theme::c("main_fg"), Fx::b, " GPU");
 				if (gpus.size() > 1) out += rjust(to_string(i), 1 + (gpus.size() > 9));
 				if (gpus[i].supported_functions.gpu_utilization) {
 					out += ' ';
@@ -1418,28 +1382,28 @@ namespace Cpu {
 
 					if (Pwr::shown) {
 						//? PWR visible: percentage right-aligned at edge
-						out += Mv::to(b_y + cy, b_x + b_width - 6)
-							+ Theme::g("cpu").at(clamp(safeVal(gpus[i].gpu_percent, "gpu-totals"s).back(), 0ll, 100ll))
-							+ rjust(to_string(safeVal(gpus[i].gpu_percent, "gpu-totals"s).back()), 3) + Theme::c("main_fg") + '%';
+						append(out, Mv::to(b_y + cy, b_x + b_width - 6),
+							Theme::g("cpu").at(clamp(safeVal(gpus[i].gpu_percent, "gpu-totals"s).back(), 0ll, 100ll)),
+							rjust(to_string(safeVal(gpus[i].gpu_percent, "gpu-totals"s).back()), 3), Theme::c("main_fg"), '%');
 					} else {
 						//? PWR hidden: XX% + X.XW + space + temp_graph(6) + XX°C
-						out += Mv::to(b_y + cy, b_x + b_width - 23)
-							+ Theme::g("cpu").at(clamp(safeVal(gpus[i].gpu_percent, "gpu-totals"s).back(), 0ll, 100ll))
-							+ rjust(to_string(safeVal(gpus[i].gpu_percent, "gpu-totals"s).back()), 3) + Theme::c("main_fg") + '%';
+						append(out, Mv::to(b_y + cy, b_x + b_width - 23),
+							Theme::g("cpu").at(clamp(safeVal(gpus[i].gpu_percent, "gpu-totals"s).back(), 0ll, 100ll)),
+							rjust(to_string(safeVal(gpus[i].gpu_percent, "gpu-totals"s).back()), 3), Theme::c("main_fg"), '%');
 
 						//? Power directly after percentage (no space)
 						if (gpus[i].supported_functions.pwr_usage) {
-							out += Theme::g("cached").at(clamp(safeVal(gpus[i].gpu_percent, "gpu-pwr-totals"s).back(), 0ll, 100ll))
-								+ fmt::format("{:>4.1f}", gpus[i].pwr_usage / 1000.0) + Theme::c("main_fg") + 'W';
+							append(out, Theme::g("cached").at(clamp(safeVal(gpus[i].gpu_percent, "gpu-pwr-totals"s).back(), 0ll, 100ll)),
+								fmt::format("{:>4.1f}", gpus[i].pwr_usage / 1000.0), Theme::c("main_fg"), 'W');
 						}
 
 						//? Temperature graph + temperature (right-aligned at edge)
 						if (show_temps and gpus[i].supported_functions.temp_info and not gpus[i].temp.empty()) {
 							const auto [temp, unit] = celsius_to(gpus[i].temp.back(), temp_scale);
-							out += ' ' + gpu_temp_graphs[i](gpus[i].temp, data_same)
-								+ Mv::to(b_y + cy, b_x + b_width - 6)
-								+ Theme::g("temp").at(clamp(gpus[i].temp.back(), 0ll, 100ll))
-								+ rjust(to_string(temp), 3) + Theme::c("main_fg") + unit;
+							append(out, ' ', gpu_temp_graphs[i](gpus[i].temp, data_same),
+								Mv::to(b_y + cy, b_x + b_width - 6),
+								Theme::g("temp").at(clamp(gpus[i].temp.back(), 0ll, 100ll)),
+								rjust(to_string(temp), 3), Theme::c("main_fg"), unit);
 						}
 					}
 				}
@@ -1450,7 +1414,7 @@ namespace Cpu {
 
 		//? ANE (Neural Engine) brief info for Apple Silicon
 		if (show_gpu and Shared::aneCoreCount > 0 and cy < b_height - 1) {
-			out += Mv::to(b_y + ++cy, b_x + 1) + Theme::c("main_fg") + Fx::b + " ANE";
+			append(out, Mv::to(b_y + ++cy, b_x + 1), Theme::c("main_fg"), Fx::b, " ANE");
 
 			//? Format ANE activity
 			string ane_activity_str;
@@ -1474,15 +1438,15 @@ namespace Cpu {
 
 			//? Activity right-aligned (move to right edge when PWR panel visible)
 			int ane_offset = Pwr::shown ? 8 : 14;
-			out += Mv::to(b_y + cy, b_x + b_width - ane_offset)
-				+ Theme::g("cpu").at(clamp(ane_percent, 0ll, 100ll))
-				+ rjust(ane_activity_str, 3) + Theme::c("main_fg") + " C/s";
+			append(out, Mv::to(b_y + cy, b_x + b_width - ane_offset),
+				Theme::g("cpu").at(clamp(ane_percent, 0ll, 100ll)),
+				rjust(ane_activity_str, 3), Theme::c("main_fg"), " C/s");
 
 			//? Power right-aligned at end (only when PWR panel is hidden)
 			if (not Pwr::shown) {
-				out += Mv::to(b_y + cy, b_x + b_width - 6)
-					+ Theme::g("cpu").at(clamp(static_cast<long long>(Shared::anePower * 10), 0ll, 100ll))
-					+ fmt::format("{:>4.1f}", Shared::anePower) + Theme::c("main_fg") + 'W';
+				append(out, Mv::to(b_y + cy, b_x + b_width - 6),
+					Theme::g("cpu").at(clamp(static_cast<long long>(Shared::anePower * 10), 0ll, 100ll)),
+					fmt::format("{:>4.1f}", Shared::anePower), Theme::c("main_fg"), 'W');
 			}
 		}
 
@@ -1490,7 +1454,7 @@ namespace Cpu {
 		long long gpu_mem_total = Shared::gpuMemTotal.load(std::memory_order_acquire);
 		long long gpu_mem_used = Shared::gpuMemUsed.load(std::memory_order_acquire);
 		if (show_gpu and gpu_mem_total > 0 and cy < b_height - 1) {
-			out += Mv::to(b_y + ++cy, b_x + 1) + Theme::c("main_fg") + Fx::b + "VRAM";
+			append(out, Mv::to(b_y + ++cy, b_x + 1), Theme::c("main_fg"), Fx::b, "VRAM");
 
 			//? Calculate percentage
 			long long vram_percent = (gpu_mem_total > 0) ? (gpu_mem_used * 100 / gpu_mem_total) : 0;
@@ -1504,14 +1468,14 @@ namespace Cpu {
 			//? Format: "XX% YY.Y GB Max" - offset 17 to avoid overlap with bar
 			//? Use theme temp gradient for hot colors (Aurora: green → yellow → red)
 			double total_gb = static_cast<double>(gpu_mem_total) / 1024.0 / 1024.0 / 1024.0;
-			out += Mv::to(b_y + cy, b_x + b_width - 17)
-				+ Theme::g("temp").at(clamp(vram_percent, 0ll, 100ll)) + rjust(to_string(vram_percent), 3) + Theme::c("main_fg") + "% "
-				+ fmt::format("{:.1f}", total_gb) + " GB Max";
+			append(out, Mv::to(b_y + cy, b_x + b_width - 17),
+				Theme::g("temp").at(clamp(vram_percent, 0ll, 100ll)), rjust(to_string(vram_percent), 3), Theme::c("main_fg"), "% ",
+				fmt::format("{:.1f}", total_gb), " GB Max");
 		}
 	#endif
 
 		redraw = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 
 }
@@ -1541,13 +1505,13 @@ namespace Gpu {
 	vector<Draw::Meter> ane_meter_vec = {};
 	vector<string> box = {};
 
-    string draw(const gpu_info& gpu, unsigned long index, bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+    void draw(string& out, const gpu_info& gpu, unsigned long index, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 		//? Defensive check: skip drawing if dimensions are invalid (terminal too small or resizing)
-		if (Gpu::width < 10) return "";
+		if (Gpu::width < 10) return;
 
 		//? Bounds check for vector access
-		if (index >= ane_graph_vec.size() or index >= graph_upper_vec.size()) return "";
+		if (index >= ane_graph_vec.size() or index >= graph_upper_vec.size()) return;
 
 		auto& b_x = b_x_vec[index];
 		auto& b_y = b_y_vec[index];
@@ -1573,9 +1537,7 @@ namespace Gpu {
 		auto& graph_symbol = (tty_mode ? "tty" : Config::getS("graph_symbol_gpu"));
 		auto& graph_bg = Symbols::graph_symbols.at((graph_symbol == "default" ? Config::getS("graph_symbol") + "_up" : graph_symbol + "_up")).at(6);
         auto single_graph = !Config::getB("gpu_mirror_graph");
-		string out;
 		int height = gpu_b_height_offsets[index] + 4;
-		out.reserve(width * height);
 
 		//* Redraw elements not needed to be updated every cycle
 		if (redraw[index]) {
@@ -1660,48 +1622,48 @@ namespace Gpu {
 		int rows_used = 1;
 		//? Gpu graph, meter & clock speed
 		if (gpu.supported_functions.gpu_utilization) {
-			out += Fx::ub + Mv::to(y + rows_used, x + 1) + graph_upper(safeVal(gpu.gpu_percent, "gpu-totals"s), (data_same or redraw[index]));
+			append(out, Fx::ub, Mv::to(y + rows_used, x + 1), graph_upper(safeVal(gpu.gpu_percent, "gpu-totals"s), (data_same or redraw[index])));
 
 			//? Lower graph: ANE (when ane_split, key "6") or mirrored GPU (when gpu_mirror_graph)
 			if (ane_split and Shared::aneCoreCount > 0) {
 				auto& ane_data = Gpu::shared_gpu_percent.at("ane-activity");
 				if (not ane_data.empty()) {
-					out += Mv::to(y + rows_used + graph_up_height, x + 1) + ane_graph(ane_data, (data_same or redraw[index]));
+					append(out, Mv::to(y + rows_used + graph_up_height, x + 1), ane_graph(ane_data, (data_same or redraw[index])));
 				}
 				//? Draw mid-line with "gpu ▲▼ ane" label AFTER graphs (so it's not overwritten)
-				out += Mv::to(y + graph_up_height + 1, x) + Fx::ub + Theme::c("cpu_box") + Symbols::div_left + Theme::c("div_line")
-					+ Symbols::h_line * (width - b_width - 2) + Symbols::div_right
-					+ Mv::to(y + graph_up_height + 1, x + ((width - b_width) / 2) - 5)
-					+ Theme::c("main_fg") + "gpu" + Mv::r(1) + "▲▼" + Mv::r(1) + "ane";
+				append(out, Mv::to(y + graph_up_height + 1, x), Fx::ub, Theme::c("cpu_box"), Symbols::div_left, Theme::c("div_line"),
+					Symbols::h_line * (width - b_width - 2), Symbols::div_right,
+					Mv::to(y + graph_up_height + 1, x + ((width - b_width) / 2) - 5),
+					Theme::c("main_fg"), "gpu", Mv::r(1), "▲▼", Mv::r(1), "ane");
 			} else if (not single_graph) {
-				out += Mv::to(y + rows_used + graph_up_height, x + 1) + graph_lower(safeVal(gpu.gpu_percent, "gpu-totals"s), (data_same or redraw[index]));
+				append(out, Mv::to(y + rows_used + graph_up_height, x + 1), graph_lower(safeVal(gpu.gpu_percent, "gpu-totals"s), (data_same or redraw[index])));
 			}
 
 			//? "  GPU " = 6 chars to align with " ⁶ANE " (also 6 chars visually)
-			out += Mv::to(b_y + rows_used, b_x + 1) + Theme::c("main_fg") + Fx::b + "  GPU " + gpu_meter(safeVal(gpu.gpu_percent, "gpu-totals"s).back());
+			append(out, Mv::to(b_y + rows_used, b_x + 1), Theme::c("main_fg"), Fx::b, "  GPU ", gpu_meter(safeVal(gpu.gpu_percent, "gpu-totals"s).back()));
 			if (show_temps and Pwr::shown) {
 				//? Right-align percentage when temp hidden - position at where temp section would end
 				out += Mv::to(b_y + rows_used, b_x + b_width - 7);  //? Position for "  100%|"
 			}
-			out += Theme::g("cpu").at(clamp(safeVal(gpu.gpu_percent, "gpu-totals"s).back(), 0ll, 100ll)) + rjust(to_string(safeVal(gpu.gpu_percent, "gpu-totals"s).back()), 5) + Theme::c("main_fg") + '%';
+			append(out, Theme::g("cpu").at(clamp(safeVal(gpu.gpu_percent, "gpu-totals"s).back(), 0ll, 100ll)), rjust(to_string(safeVal(gpu.gpu_percent, "gpu-totals"s).back()), 5), Theme::c("main_fg"), '%');
 
 			//? Temperature graph, I assume the device supports utilization if it supports temperature
 			//? Check gpu.temp is non-empty to prevent UB on .back() call
 			if (show_temps and not Pwr::shown and not gpu.temp.empty()) {
 				const auto [temp, unit] = celsius_to(gpu.temp.back(), temp_scale);
 				const auto temp_color = Theme::g("temp").at(clamp(gpu.temp.back(), 0ll, 100ll));  //? 100°C = max red
-				out += ' ' + Theme::c("inactive_fg") + graph_bg * 6 + Mv::l(6) + temp_color
-					+ temp_graph(gpu.temp, data_same or redraw[index]);
-				out += temp_color + rjust(to_string(temp), 4) + Theme::c("main_fg") + unit;  //? Apply temp color to value
+				append(out, ' ', Theme::c("inactive_fg"), graph_bg * 6, Mv::l(6), temp_color,
+					temp_graph(gpu.temp, data_same or redraw[index]));
+				append(out, temp_color, rjust(to_string(temp), 4), Theme::c("main_fg"), unit);  //? Apply temp color to value
 			}
-			out += Theme::c("div_line") + Symbols::v_line;
+			append(out, Theme::c("div_line"), Symbols::v_line);
 			rows_used++;
 		}
 
 		if (gpu.supported_functions.gpu_clock) {
 			string clock_speed_string = to_string(gpu.gpu_clock_speed);
-			out += Mv::to(b_y, b_x + b_width - 12) + Theme::c("div_line") + Symbols::h_line*(5-clock_speed_string.size())
-				+ Symbols::title_left + Fx::b + Theme::c("title") + clock_speed_string + " MHz" + Fx::ub + Theme::c("div_line") + Symbols::title_right;
+			append(out, Mv::to(b_y, b_x + b_width - 12), Theme::c("div_line"), Symbols::h_line*(5-clock_speed_string.size()),
+				Symbols::title_left, Fx::b, Theme::c("title"), clock_speed_string, " MHz", Fx::ub, Theme::c("div_line"), Symbols::title_right);
 		}
 
 		//? Power usage with braille graph (auto-scales based on observed max) - hide when PWR panel visible
@@ -1709,23 +1671,23 @@ namespace Gpu {
 			int pwr_graph_width = b_width - 14;  //? -1 for extra space in "  PWR "
 			long long pwr_pct = gpu.pwr_max_usage > 0 ? clamp(gpu.pwr_usage * 100 / gpu.pwr_max_usage, 0ll, 100ll) : 0;
 			//? "  PWR " = 6 chars to align with " ⁶ANE "
-			out += Mv::to(b_y + rows_used, b_x + 1) + Theme::c("main_fg") + Fx::b + "  PWR "
-				+ Theme::c("inactive_fg") + string(pwr_graph_width, ' ') + Mv::l(pwr_graph_width)
-				+ Theme::g("cached").at(clamp(pwr_pct, 0ll, 100ll))
-				+ pwr_graph(gpu.pwr, data_same or redraw[index])
-				+ fmt::format("{:>5.{}f}", gpu.pwr_usage / 1000.0, gpu.pwr_usage < 10'000 ? 2 : gpu.pwr_usage < 100'000 ? 1 : 0) + Theme::c("main_fg") + 'W';
+			append(out, Mv::to(b_y + rows_used, b_x + 1), Theme::c("main_fg"), Fx::b, "  PWR ",
+				Theme::c("inactive_fg"), string(pwr_graph_width, ' '), Mv::l(pwr_graph_width),
+				Theme::g("cached").at(clamp(pwr_pct, 0ll, 100ll)),
+				pwr_graph(gpu.pwr, data_same or redraw[index]),
+				fmt::format("{:>5.{}f}", gpu.pwr_usage / 1000.0, gpu.pwr_usage < 10'000 ? 2 : gpu.pwr_usage < 100'000 ? 1 : 0), Theme::c("main_fg"), 'W');
 			if (gpu.supported_functions.pwr_state and gpu.pwr_state != 32) // NVML_PSTATE_UNKNOWN; unsupported or non-nvidia card
-				out += std::string(" P-state: ") + (gpu.pwr_state > 9 ? "" : " ") + 'P' + Theme::g("cached").at(clamp(gpu.pwr_state, 0ll, 100ll)) + to_string(gpu.pwr_state);
+				append(out, std::string(" P-state: "), (gpu.pwr_state > 9 ? "" : " "), 'P', Theme::g("cached").at(clamp(gpu.pwr_state, 0ll, 100ll)), to_string(gpu.pwr_state));
 			rows_used++;
 		}
 
 		//? Encode and Decode meters
 		bool drawnEncDec = gpu.supported_functions.encoder_utilization and gpu.supported_functions.decoder_utilization;
 		if (drawnEncDec) {
-			out += Mv::to(b_y + rows_used, b_x +1) + Theme::c("main_fg") + Fx::b + "ENC " + enc_meter(gpu.encoder_utilization)
-				+ Theme::g("cpu").at(clamp(gpu.encoder_utilization, 0ll, 100ll)) + rjust(to_string(gpu.encoder_utilization), 4) + Theme::c("main_fg") + '%'
-				+ Theme::c("div_line") + Symbols::v_line + Theme::c("main_fg") + Fx::b + "DEC " + enc_meter(gpu.decoder_utilization)
-				+ Theme::g("cpu").at(clamp(gpu.decoder_utilization, 0ll, 100ll)) + rjust(to_string(gpu.decoder_utilization), 4) + Theme::c("main_fg") + '%';
+			append(out, Mv::to(b_y + rows_used, b_x +1), Theme::c("main_fg"), Fx::b, "ENC ", enc_meter(gpu.encoder_utilization),
+				Theme::g("cpu").at(clamp(gpu.encoder_utilization, 0ll, 100ll)), rjust(to_string(gpu.encoder_utilization), 4), Theme::c("main_fg"), '%',
+				Theme::c("div_line"), Symbols::v_line, Theme::c("main_fg"), Fx::b, "DEC ", enc_meter(gpu.decoder_utilization),
+				Theme::g("cpu").at(clamp(gpu.decoder_utilization, 0ll, 100ll)), rjust(to_string(gpu.decoder_utilization), 4), Theme::c("main_fg"), '%');
 			rows_used++;
 		}
 
@@ -1755,12 +1717,12 @@ namespace Gpu {
 				ane_label += " ";  //? Extra space when no superscript to match "  GPU "
 			}
 			ane_label += "ANE ";
-			out += Mv::to(b_y + rows_used, b_x + 1) + Theme::c("main_fg") + Fx::b + ane_label + ane_meter(ane_percent);
+			append(out, Mv::to(b_y + rows_used, b_x + 1), Theme::c("main_fg"), Fx::b, ane_label, ane_meter(ane_percent));
 
 			//? Position activity value (right-justified) - text is ~10 chars, offset 11 for 1-char padding
 			int ane_activity_offset = 11;
-			out += Mv::to(b_y + rows_used, b_x + b_width - ane_activity_offset)
-				+ Theme::g("cpu").at(clamp(ane_percent, 0ll, 100ll)) + ane_activity_str + Theme::c("main_fg") + " C/s";
+			append(out, Mv::to(b_y + rows_used, b_x + b_width - ane_activity_offset),
+				Theme::g("cpu").at(clamp(ane_percent, 0ll, 100ll)), ane_activity_str, Theme::c("main_fg"), " C/s");
 
 			//? ANE power with braille graph (only when PWR panel is hidden)
 			if (not Pwr::shown) {
@@ -1770,11 +1732,11 @@ namespace Gpu {
 				auto ane_max_val = Pwr::get_ane_pwr_max();
 				double ane_power = Shared::anePower.load(std::memory_order_acquire);
 				long long ane_pwr_pct = ane_max_val > 0 ? clamp(static_cast<long long>(ane_power * 1000) * 100 / ane_max_val, 0ll, 100ll) : 0;
-				out += Mv::to(b_y + rows_used + 1, b_x + 1) + Theme::c("main_fg") + Fx::b + "  PWR "
-					+ Theme::c("inactive_fg") + string(ane_pwr_graph_width, ' ') + Mv::l(ane_pwr_graph_width)
-					+ Theme::g("cached").at(clamp(ane_pwr_pct, 0ll, 100ll))
-					+ ane_pwr_graph(ane_hist, data_same or redraw[index])
-					+ fmt::format("{:>5.2f}", ane_power) + Theme::c("main_fg") + 'W';
+				append(out, Mv::to(b_y + rows_used + 1, b_x + 1), Theme::c("main_fg"), Fx::b, "  PWR ",
+					Theme::c("inactive_fg"), string(ane_pwr_graph_width, ' '), Mv::l(ane_pwr_graph_width),
+					Theme::g("cached").at(clamp(ane_pwr_pct, 0ll, 100ll)),
+					ane_pwr_graph(ane_hist, data_same or redraw[index]),
+					fmt::format("{:>5.2f}", ane_power), Theme::c("main_fg"), 'W');
 				rows_used++;
 			}
 			rows_used++;
@@ -1789,13 +1751,13 @@ namespace Gpu {
 					* (1 + 2*(gpu.supported_functions.mem_total and gpu.supported_functions.mem_used) + 2*gpu.supported_functions.mem_utilization);
 
 				//? Used graph, memory section header, total vram
-				out += Theme::c("div_line") + Symbols::div_left + Symbols::h_line + Symbols::title_left + Fx::b + Theme::c("title") + "vram" + Theme::c("div_line") + Fx::ub + Symbols::title_right
-					+  Symbols::h_line*(b_width/2-8) + Symbols::div_up + Mv::d(offset)+Mv::l(1) + Symbols::div_down + Mv::l(1)+Mv::u(1) + (Symbols::v_line + Mv::l(1)+Mv::u(1))*(offset-1) + Symbols::div_up
-					+  Symbols::h_line + Theme::c("title") + "Used:" + Theme::c("div_line")
-					+  Symbols::h_line*(b_width/2+b_width%2-9-used_memory_string.size()) + Theme::c("title") + used_memory_string + Theme::c("div_line") + Symbols::h_line + Symbols::div_right
-					+  Mv::d(1) + Mv::l(b_width/2-1) + mem_used_graph(safeVal(gpu.gpu_percent, "gpu-vram-totals"s), (data_same or redraw[index]))
-					+  Mv::l(b_width-3) + Mv::u(1+2*gpu.supported_functions.mem_utilization) + Theme::c("main_fg") + Fx::b + "Total:" + rjust(floating_humanizer(gpu.mem_total), b_width/2-9) + Fx::ub
-					+  Mv::r(3) + rjust(to_string(safeVal(gpu.gpu_percent, "gpu-vram-totals"s).back()), 3) + '%';
+				append(out, Theme::c("div_line"), Symbols::div_left, Symbols::h_line, Symbols::title_left, Fx::b, Theme::c("title"), "vram", Theme::c("div_line"), Fx::ub, Symbols::title_right,
+					Symbols::h_line*(b_width/2-8), Symbols::div_up, Mv::d(offset), Mv::l(1), Symbols::div_down, Mv::l(1), Mv::u(1), (Symbols::v_line + Mv::l(1)+Mv::u(1))*(offset-1), Symbols::div_up,
+					Symbols::h_line, Theme::c("title"), "Used:", Theme::c("div_line"),
+					Symbols::h_line*(b_width/2+b_width%2-9-used_memory_string.size()), Theme::c("title"), used_memory_string, Theme::c("div_line"), Symbols::h_line, Symbols::div_right,
+					Mv::d(1), Mv::l(b_width/2-1), mem_used_graph(safeVal(gpu.gpu_percent, "gpu-vram-totals"s), (data_same or redraw[index])),
+					Mv::l(b_width-3), Mv::u(1+2*gpu.supported_functions.mem_utilization), Theme::c("main_fg"), Fx::b, "Total:", rjust(floating_humanizer(gpu.mem_total), b_width/2-9), Fx::ub,
+					Mv::r(3), rjust(to_string(safeVal(gpu.gpu_percent, "gpu-vram-totals"s).back()), 3), '%');
 
 			#if defined(__APPLE__) && defined(GPU_SUPPORT)
 				//? Apple Silicon: Show VRAM allocation option with clickable 'A' key
@@ -1803,31 +1765,31 @@ namespace Gpu {
 					//? Center "Allocate: [A]" (13 chars) in left half of vram section
 					int alloc_row = b_y + rows_used + 2;
 					int alloc_col = b_x + (b_width/2 - 13) / 2;  //? Centered in left half
-					out += Mv::to(alloc_row, alloc_col) + Theme::c("main_fg") + "Allocate: " + Theme::c("hi_fg") + Fx::b + "[A]" + Fx::ub;
+					append(out, Mv::to(alloc_row, alloc_col), Theme::c("main_fg"), "Allocate: ", Theme::c("hi_fg"), Fx::b, "[A]", Fx::ub);
 					Input::mouse_mappings["A"] = {alloc_row, alloc_col + 10, 1, 3};  //? "[A]" after "Allocate: "
 				}
 			#endif
 
 				//? Memory utilization
 				if (gpu.supported_functions.mem_utilization)
-					out += Mv::l(b_width/2+6) + Mv::d(1) + Theme::c("div_line") + Symbols::div_left+Symbols::h_line + Theme::c("title") + "Utilization:" + Theme::c("div_line") + Symbols::h_line*(b_width/2-14) + Symbols::div_right
-						+  Mv::l(b_width/2)   + Mv::d(1) + mem_util_graph(gpu.mem_utilization_percent, (data_same or redraw[index]))
-						+  Mv::l(b_width/2-1) + Mv::u(1) + rjust(to_string(gpu.mem_utilization_percent.back()), 3) + '%';
+					append(out, Mv::l(b_width/2+6), Mv::d(1), Theme::c("div_line"), Symbols::div_left, Symbols::h_line, Theme::c("title"), "Utilization:", Theme::c("div_line"), Symbols::h_line*(b_width/2-14), Symbols::div_right,
+						Mv::l(b_width/2), Mv::d(1), mem_util_graph(gpu.mem_utilization_percent, (data_same or redraw[index])),
+						Mv::l(b_width/2-1), Mv::u(1), rjust(to_string(gpu.mem_utilization_percent.back()), 3), '%');
 
 				//? Memory clock speed
 				if (gpu.supported_functions.mem_clock) {
 					string clock_speed_string = to_string(gpu.mem_clock_speed);
-					out += Mv::to(b_y + rows_used, b_x + b_width/2 - 11) + Theme::c("div_line") + Symbols::h_line*(5-clock_speed_string.size())
-						+ Symbols::title_left + Fx::b + Theme::c("title") + clock_speed_string + " MHz" + Fx::ub + Theme::c("div_line") + Symbols::title_right;
+					append(out, Mv::to(b_y + rows_used, b_x + b_width/2 - 11), Theme::c("div_line"), Symbols::h_line*(5-clock_speed_string.size()),
+						Symbols::title_left, Fx::b, Theme::c("title"), clock_speed_string, " MHz", Fx::ub, Theme::c("div_line"), Symbols::title_right);
 				}
 			} else {
-				out += Theme::c("main_fg") + Mv::r(1);
+				append(out, Theme::c("main_fg"), Mv::r(1));
 				if (gpu.supported_functions.mem_total)
-					out += "VRAM total:" + rjust(floating_humanizer(gpu.mem_total), b_width/(1 + gpu.supported_functions.mem_clock)-14);
+					append(out, "VRAM total:", rjust(floating_humanizer(gpu.mem_total), b_width/(1 + gpu.supported_functions.mem_clock)-14));
 				else out += "VRAM usage:" + rjust(floating_humanizer(gpu.mem_used), b_width/(1 + gpu.supported_functions.mem_clock)-14);
 
 				if (gpu.supported_functions.mem_clock)
-					out += "   VRAM clock:" + rjust(to_string(gpu.mem_clock_speed) + " MHz", b_width/2-13);
+					append(out, "   VRAM clock:", rjust(to_string(gpu.mem_clock_speed) + " MHz", b_width/2-13));
 			}
 		}
 
@@ -1839,15 +1801,15 @@ namespace Gpu {
 		if (gpu.supported_functions.pcie_txrx and Config::getB("nvml_measure_pcie_speeds")) {
 			string tx_string = floating_humanizer(gpu.pcie_tx, 0, 1, 0, 1);
 			string rx_string = floating_humanizer(gpu.pcie_rx, 0, 1, 0, 1);
-			out += Mv::to(b_y + b_height_vec[index] - 1, b_x+2) + Theme::c("div_line")
-				+ Symbols::title_left_down + Theme::c("title") + Fx::b + "TX:" + Fx::ub + Theme::c("div_line") + Symbols::title_right_down + Symbols::h_line*(b_width/2-9-tx_string.size())
-				+ Symbols::title_left_down + Theme::c("title") + Fx::b + tx_string + Fx::ub + Theme::c("div_line") + Symbols::title_right_down + (gpu.supported_functions.mem_total and gpu.supported_functions.mem_used ? Symbols::div_down : Symbols::h_line)
-				+ Symbols::title_left_down + Theme::c("title") + Fx::b + "RX:" + Fx::ub + Theme::c("div_line") + Symbols::title_right_down + Symbols::h_line*(b_width/2+b_width%2-9-rx_string.size())
-				+ Symbols::title_left_down + Theme::c("title") + Fx::b + rx_string + Fx::ub + Theme::c("div_line") + Symbols::title_right_down + Symbols::round_right_down;
+			append(out, Mv::to(b_y + b_height_vec[index] - 1, b_x+2), Theme::c("div_line"),
+				Symbols::title_left_down, Theme::c("title"), Fx::b, "TX:", Fx::ub, Theme::c("div_line"), Symbols::title_right_down, Symbols::h_line*(b_width/2-9-tx_string.size()),
+				Symbols::title_left_down, Theme::c("title"), Fx::b, tx_string, Fx::ub, Theme::c("div_line"), Symbols::title_right_down, (gpu.supported_functions.mem_total and gpu.supported_functions.mem_used ? Symbols::div_down : Symbols::h_line),
+				Symbols::title_left_down, Theme::c("title"), Fx::b, "RX:", Fx::ub, Theme::c("div_line"), Symbols::title_right_down, Symbols::h_line*(b_width/2+b_width%2-9-rx_string.size()),
+				Symbols::title_left_down, Theme::c("title"), Fx::b, rx_string, Fx::ub, Theme::c("div_line"), Symbols::title_right_down, Symbols::round_right_down);
 		}
 
 		redraw[index] = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 
 }
@@ -1866,18 +1828,16 @@ namespace Pwr {
 	//? Track last max values for auto-scaling - recreate graphs when max changes significantly
 	long long last_cpu_max = 0, last_gpu_max = 0, last_ane_max = 0;
 
-	string draw(bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
-		if (not shown) return "";
+	void draw(string& out, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
+		if (not shown) return;
 		//? Defensive check: skip drawing if dimensions are invalid (terminal too small or resizing)
-		if (Pwr::width < 10 or Pwr::height < 3) return "";
+		if (Pwr::width < 10 or Pwr::height < 3) return;
 
 		if (force_redraw) redraw = true;
 
 		auto tty_mode = Config::getB("tty_mode");
 		auto& graph_symbol = (tty_mode ? "tty" : Config::getS("graph_symbol_pwr"));
-		string out;
-		out.reserve(width * height);
 
 		//? Calculate subpanel width (3 equal columns)
 		sub_width = (width - 4) / 3;
@@ -1955,27 +1915,27 @@ namespace Pwr {
 		int fan_count = Shared::fanCount.load(std::memory_order_acquire);
 
 		//? Clear header line before drawing (prevents leftover characters from previous longer values)
-		out += Mv::to(y + 1, x + 2) + string(width - 4, ' ');
-		out += Mv::to(y + 1, x + 2)
-			+ Theme::c("title") + Fx::b
-			+ fmt::format("Power: {:.2f}W", total_pwr)
-			+ Theme::c("main_fg") + Fx::ub
-			+ fmt::format(" (avg {:.2f}W, max {:.2f}W)",
+		append(out, Mv::to(y + 1, x + 2), string(width - 4, ' '));
+		append(out, Mv::to(y + 1, x + 2),
+			Theme::c("title"), Fx::b,
+			fmt::format("Power: {:.2f}W", total_pwr),
+			Theme::c("main_fg"), Fx::ub,
+			fmt::format(" (avg {:.2f}W, max {:.2f}W)",
 				cpu_avg + gpu_avg + ane_avg,
-				cpu_peak + gpu_peak + ane_peak);
+				cpu_peak + gpu_peak + ane_peak));
 
 		//? Add fan RPM if fans detected
 		if (fan_count > 0 and fan_rpm > 0) {
-			out += Theme::c("title") + Fx::b + "  Fan: "
-				+ Theme::c("main_fg") + Fx::ub + fmt::format("{}rpm", fan_rpm);
+			append(out, Theme::c("title"), Fx::b, "  Fan: ",
+				Theme::c("main_fg"), Fx::ub, fmt::format("{}rpm", fan_rpm));
 		}
 
 		//? Draw vertical dividers between subpanels
 		int div1_x = x + sub_width + 1;
 		int div2_x = x + sub_width * 2 + 2;
 		for (int r = 2; r < height - 1; r++) {
-			out += Mv::to(y + r, div1_x) + Theme::c("div_line") + Symbols::v_line;
-			out += Mv::to(y + r, div2_x) + Theme::c("div_line") + Symbols::v_line;
+			append(out, Mv::to(y + r, div1_x), Theme::c("div_line"), Symbols::v_line);
+			append(out, Mv::to(y + r, div2_x), Theme::c("div_line"), Symbols::v_line);
 		}
 
 		//? CPU Subpanel (left) - Compact layout: label + graph + temp on same lines
@@ -1985,19 +1945,19 @@ namespace Pwr {
 		int temp_x = graph_x + graph_width + 1;
 
 		//? Row 2: "CPU " + graph_line_1 + " 45°C"
-		out += Mv::to(y + row, col1_x) + Theme::c("main_fg") + Fx::b + "CPU " + Fx::ub;
-		out += Mv::to(y + row, graph_x) + cpu_pwr_graph(cpu_history, data_same or recreate_graphs);
+		append(out, Mv::to(y + row, col1_x), Theme::c("main_fg"), Fx::b, "CPU ", Fx::ub);
+		append(out, Mv::to(y + row, graph_x), cpu_pwr_graph(cpu_history, data_same or recreate_graphs));
 		//? CPU temperature with color gradient (100°C = max red) - on first graph line
 		{
 			long long temp_pct = cpu_temp > 0 ? clamp(cpu_temp, 0ll, 100ll) : 0;
-			out += Mv::to(y + row, temp_x) + Theme::g("temp").at(temp_pct) + fmt::format("{:>3}°C", cpu_temp);
+			append(out, Mv::to(y + row, temp_x), Theme::g("temp").at(temp_pct), fmt::format("{:>3}°C", cpu_temp));
 		}
 
 		row += graph_height;
 		//? Clear value line before drawing (prevents leftover characters)
-		out += Mv::to(y + row, col1_x) + string(sub_width - 2, ' ');
-		out += Mv::to(y + row, col1_x) + Theme::c("main_fg")
-			+ fmt::format("{:.2f}W avg {:.2f}W", cpu_pwr, cpu_avg);
+		append(out, Mv::to(y + row, col1_x), string(sub_width - 2, ' '));
+		append(out, Mv::to(y + row, col1_x), Theme::c("main_fg"),
+			fmt::format("{:.2f}W avg {:.2f}W", cpu_pwr, cpu_avg));
 
 		//? GPU Subpanel (middle) - Compact layout: label + graph + temp on same lines
 		int col2_x = div1_x + 2;
@@ -2006,19 +1966,19 @@ namespace Pwr {
 		temp_x = graph_x + graph_width + 1;
 
 		//? Row 2: "GPU " + graph_line_1 + " 45°C"
-		out += Mv::to(y + row, col2_x) + Theme::c("main_fg") + Fx::b + "GPU " + Fx::ub;
-		out += Mv::to(y + row, graph_x) + gpu_pwr_graph(gpu_history, data_same or recreate_graphs);
+		append(out, Mv::to(y + row, col2_x), Theme::c("main_fg"), Fx::b, "GPU ", Fx::ub);
+		append(out, Mv::to(y + row, graph_x), gpu_pwr_graph(gpu_history, data_same or recreate_graphs));
 		//? GPU temperature with color gradient (100°C = max red) - on first graph line
 		if (gpu_temp > 0) {
 			long long temp_pct = clamp(gpu_temp, 0ll, 100ll);
-			out += Mv::to(y + row, temp_x) + Theme::g("temp").at(temp_pct) + fmt::format("{:>3}°C", gpu_temp);
+			append(out, Mv::to(y + row, temp_x), Theme::g("temp").at(temp_pct), fmt::format("{:>3}°C", gpu_temp));
 		}
 
 		row += graph_height;
 		//? Clear value line before drawing (prevents leftover characters)
-		out += Mv::to(y + row, col2_x) + string(sub_width - 2, ' ');
-		out += Mv::to(y + row, col2_x) + Theme::c("main_fg")
-			+ fmt::format("{:.2f}W avg {:.2f}W", gpu_pwr, gpu_avg);
+		append(out, Mv::to(y + row, col2_x), string(sub_width - 2, ' '));
+		append(out, Mv::to(y + row, col2_x), Theme::c("main_fg"),
+			fmt::format("{:.2f}W avg {:.2f}W", gpu_pwr, gpu_avg));
 
 		//? ANE Subpanel (right) - Compact layout: label + graph (no temp for ANE)
 		int col3_x = div2_x + 2;
@@ -2026,17 +1986,17 @@ namespace Pwr {
 		graph_x = col3_x + label_width;
 
 		//? Row 2: "ANE " + graph_line_1 (ANE has no temperature sensor)
-		out += Mv::to(y + row, col3_x) + Theme::c("main_fg") + Fx::b + "ANE " + Fx::ub;
-		out += Mv::to(y + row, graph_x) + ane_pwr_graph(ane_history, data_same or recreate_graphs);
+		append(out, Mv::to(y + row, col3_x), Theme::c("main_fg"), Fx::b, "ANE ", Fx::ub);
+		append(out, Mv::to(y + row, graph_x), ane_pwr_graph(ane_history, data_same or recreate_graphs));
 
 		row += graph_height;
 		//? Clear value line before drawing (prevents leftover characters)
-		out += Mv::to(y + row, col3_x) + string(sub_width - 2, ' ');
-		out += Mv::to(y + row, col3_x) + Theme::c("main_fg")
-			+ fmt::format("{:.2f}W avg {:.2f}W", ane_pwr, ane_avg);
+		append(out, Mv::to(y + row, col3_x), string(sub_width - 2, ' '));
+		append(out, Mv::to(y + row, col3_x), Theme::c("main_fg"),
+			fmt::format("{:.2f}W avg {:.2f}W", ane_pwr, ane_avg));
 
 		redraw = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 }
 #endif
@@ -2180,10 +2140,10 @@ namespace Mem {
 		return (not changed ? -1 : selected);
 	}
 
-	string draw(const mem_info& mem, bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+	void draw(string& out, const mem_info& mem, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 		//? Defensive check: skip drawing if dimensions are invalid (terminal too small or resizing)
-		if (Mem::width < 10 or Mem::height < 5) return "";
+		if (Mem::width < 10 or Mem::height < 5) return;
 		if (force_redraw) redraw = true;
 
 		//? Force redraw if dimensions have changed since last draw (prevents scrambled text)
@@ -2272,8 +2232,6 @@ namespace Mem {
 		//? For backwards compatibility, create dynamic_mem_names (memory items only, no VRAM)
 		vector<string> dynamic_mem_names = visible_mem_names;
 
-		string out;
-		out.reserve(height * width);
 
 		//* Redraw elements not needed to be updated every cycle
 		if (redraw) {
@@ -2419,8 +2377,8 @@ namespace Mem {
 					disk_meters_free[name] = Draw::Meter{disk_meter, "disk_free"};
 				}
 
-				out += Mv::to(y, x + width - 6) + Fx::ub + Theme::c("mem_box") + Symbols::title_left + (io_mode ? Fx::b : "") + Theme::c("hi_fg")
-				+ 'i' + Theme::c("title") + 'o' + Fx::ub + Theme::c("mem_box") + Symbols::title_right;
+				append(out, Mv::to(y, x + width - 6), Fx::ub, Theme::c("mem_box"), Symbols::title_left, (io_mode ? Fx::b : ""), Theme::c("hi_fg"),
+				'i', Theme::c("title"), 'o', Fx::ub, Theme::c("mem_box"), Symbols::title_right);
 				Input::mouse_mappings["i"] = {y, x + width - 5, 1, 2};
 			}
 
@@ -2472,44 +2430,44 @@ namespace Mem {
 					if (bytes >= 1024ULL * 1024) return to_string(bytes / (1024ULL * 1024)) + "M";
 					return to_string(bytes / 1024ULL) + "K";
 				};
-				out += Mv::to(y + 1, title_col) + Theme::c("hi_fg") + Fx::b + "T" + Theme::c("title") + ":"
-					+ compact_size(totalMem);
+				append(out, Mv::to(y + 1, title_col), Theme::c("hi_fg"), Fx::b, "T", Theme::c("title"), ":",
+					compact_size(totalMem));
 				Input::mouse_mappings["T"] = {y + 1, title_col, 1, 1};
 				title_col += 6;
 
 				if (not visible_swap_names.empty()) {
-					out += " " + Theme::c("hi_fg") + "S" + Theme::c("title") + ":"
-						+ compact_size(safeVal(mem.stats, "swap_total"s));
+					append(out, " ", Theme::c("hi_fg"), "S", Theme::c("title"), ":",
+						compact_size(safeVal(mem.stats, "swap_total"s)));
 					Input::mouse_mappings["S"] = {y + 1, title_col + 1, 1, 1};
 					title_col += 6;
 				}
 				if (not visible_vram_names.empty()) {
 					uint64_t vram_total = Shared::gpuMemTotal.load(std::memory_order_acquire);
-					out += " " + Theme::c("hi_fg") + "V" + Theme::c("title") + ":"
-						+ compact_size(vram_total);
+					append(out, " ", Theme::c("hi_fg"), "V", Theme::c("title"), ":",
+						compact_size(vram_total));
 					Input::mouse_mappings["V"] = {y + 1, title_col + 1, 1, 1};
 				}
 			} else {
 				//? Full title format
-				out += Mv::to(y + 1, title_col) + Theme::c("hi_fg") + Fx::b + "T" + Theme::c("title") + "otal:"
-					+ rjust(floating_humanizer(totalMem), 9);
+				append(out, Mv::to(y + 1, title_col), Theme::c("hi_fg"), Fx::b, "T", Theme::c("title"), "otal:",
+					rjust(floating_humanizer(totalMem), 9));
 				Input::mouse_mappings["T"] = {y + 1, title_col, 1, 1};
 				title_col += 16;  //? "Total:" + 9 digits + spacing
 
 				if (not visible_swap_names.empty()) {
-					out += "  " + Theme::c("hi_fg") + "S" + Theme::c("title") + "wap:"
-						+ rjust(floating_humanizer(safeVal(mem.stats, "swap_total"s)), 8);
+					append(out, "  ", Theme::c("hi_fg"), "S", Theme::c("title"), "wap:",
+						rjust(floating_humanizer(safeVal(mem.stats, "swap_total"s)), 8));
 					Input::mouse_mappings["S"] = {y + 1, title_col + 2, 1, 1};
 					title_col += 15;  //? "  Swap:" + 8 digits
 				}
 				if (not visible_vram_names.empty()) {
 					uint64_t vram_total = Shared::gpuMemTotal.load(std::memory_order_acquire);
-					out += "  " + Theme::c("hi_fg") + "V" + Theme::c("title") + "ram:"
-						+ rjust(floating_humanizer(vram_total), 8);
+					append(out, "  ", Theme::c("hi_fg"), "V", Theme::c("title"), "ram:",
+						rjust(floating_humanizer(vram_total), 8));
 					Input::mouse_mappings["V"] = {y + 1, title_col + 2, 1, 1};
 				}
 			}
-			out += Fx::ub + Theme::c("main_fg");
+			append(out, Fx::ub, Theme::c("main_fg"));
 			cy = 2;  //? Start content on line 2 (after title)
 
 			//? Recalculate widths to match graph creation (ensures consistency if item count changed)
@@ -2568,14 +2526,14 @@ namespace Mem {
 				const string display_title = Theme::c("title") + title;
 
 				//? Line 1: Title (full name)
-				out += Mv::to(y+cy, x+cx) + display_title + Theme::c("main_fg");
+				append(out, Mv::to(y+cy, x+cx), display_title, Theme::c("main_fg"));
 
 				//? Line 2: Value and percentage (with hot theme gradient coloring)
-				out += Mv::to(y+cy+1, x+cx) + humanized + " " + Theme::g("cpu").at(clamp(percent_value, 0ll, 100ll)) + pct_str + Theme::c("main_fg");
+				append(out, Mv::to(y+cy+1, x+cx), humanized, " ", Theme::g("cpu").at(clamp(percent_value, 0ll, 100ll)), pct_str, Theme::c("main_fg"));
 
 				//? Line 3+: Graph/meter - graph handles multi-line rendering internally
 				if (graph_height > 0 and not graphics.empty()) {
-					out += Mv::to(y+cy+2, x+cx) + graphics;
+					append(out, Mv::to(y+cy+2, x+cx), graphics);
 				}
 
 				//? Draw vertical divider between items (except after last)
@@ -2583,7 +2541,7 @@ namespace Mem {
 				if (item_index < num_mem_items - 1) {
 					out += Theme::c("div_line");
 					for (int row = 0; row < graph_height + 2; row++) {
-						out += Mv::to(y+cy+row, x+cx+this_item_width-1) + Symbols::v_line;
+						append(out, Mv::to(y+cy+row, x+cx+this_item_width-1), Symbols::v_line);
 					}
 					out += Theme::c("main_fg");
 				}
@@ -2668,9 +2626,9 @@ namespace Mem {
 				//? Memory section header with highlighted 'T' for Shift+T toggle
 				if (show_mem_header) {
 					mem_header_shown = true;
-					out += Mv::to(y+1+cy, x+1+cx) + Theme::c("hi_fg") + Fx::b + "T" + Theme::c("title") + "otal:"
-						+ rjust(floating_humanizer(totalMem), mem_width - 9 - (int)mem_restore_letters.size())
-						+ Theme::c("hi_fg") + mem_restore_letters + Fx::ub + Theme::c("main_fg");
+					append(out, Mv::to(y+1+cy, x+1+cx), Theme::c("hi_fg"), Fx::b, "T", Theme::c("title"), "otal:",
+						rjust(floating_humanizer(totalMem), mem_width - 9 - (int)mem_restore_letters.size()),
+						Theme::c("hi_fg"), mem_restore_letters, Fx::ub, Theme::c("main_fg"));
 					Input::mouse_mappings["T"] = {y+1+cy, x+1+cx, 1, 1};
 					//? Add mouse mappings for restore letters
 					if (not mem_restore_mappings.empty()) {
@@ -2687,7 +2645,7 @@ namespace Mem {
 					swap_header_shown = true;
 					//? Only show divider if there's content above
 					if (graph_height > 0 and cy > 0) {
-						out += Mv::to(y+1+cy, x+1+cx) + h_divider;
+						append(out, Mv::to(y+1+cy, x+1+cx), h_divider);
 						cy += 1;
 					}
 					string swap_restore_letters = "";
@@ -2698,9 +2656,9 @@ namespace Mem {
 						if (not show_swap_free) { swap_restore_letters += "F"; swap_restore_mappings.emplace_back("swap_restore_free", pos++); }
 						if (not swap_restore_letters.empty()) swap_restore_letters = " [" + swap_restore_letters + "]";
 					}
-					out += Mv::to(y+1+cy, x+1+cx) + Theme::c("hi_fg") + Fx::b + "S" + Theme::c("title") + "wap:"
-						+ rjust(floating_humanizer(safeVal(mem.stats, "swap_total"s)), mem_width - 8 - (int)swap_restore_letters.size())
-						+ Theme::c("hi_fg") + swap_restore_letters + Theme::c("main_fg") + Fx::ub;
+					append(out, Mv::to(y+1+cy, x+1+cx), Theme::c("hi_fg"), Fx::b, "S", Theme::c("title"), "wap:",
+						rjust(floating_humanizer(safeVal(mem.stats, "swap_total"s)), mem_width - 8 - (int)swap_restore_letters.size()),
+						Theme::c("hi_fg"), swap_restore_letters, Theme::c("main_fg"), Fx::ub);
 					Input::mouse_mappings["S"] = {y+1+cy, x+1+cx, 1, 1};
 					//? Add mouse mappings for restore letters
 					if (not swap_restore_mappings.empty()) {
@@ -2721,7 +2679,7 @@ namespace Mem {
 					vram_header_shown = true;
 					//? Only show divider if there's content above
 					if (graph_height > 0 and cy > 0) {
-						out += Mv::to(y+1+cy, x+1+cx) + h_divider;
+						append(out, Mv::to(y+1+cy, x+1+cx), h_divider);
 						cy += 1;
 					}
 					string vram_restore_letters = "";
@@ -2732,9 +2690,9 @@ namespace Mem {
 						if (not show_vram_free) { vram_restore_letters += "F"; vram_restore_mappings.emplace_back("vram_restore_free", pos++); }
 						if (not vram_restore_letters.empty()) vram_restore_letters = " [" + vram_restore_letters + "]";
 					}
-					out += Mv::to(y+1+cy, x+1+cx) + Theme::c("hi_fg") + Fx::b + "V" + Theme::c("title") + "ram:"
-						+ rjust(floating_humanizer(safeVal(mem.stats, "vram_total"s)), mem_width - 8 - (int)vram_restore_letters.size())
-						+ Theme::c("hi_fg") + vram_restore_letters + Theme::c("main_fg") + Fx::ub;
+					append(out, Mv::to(y+1+cy, x+1+cx), Theme::c("hi_fg"), Fx::b, "V", Theme::c("title"), "ram:",
+						rjust(floating_humanizer(safeVal(mem.stats, "vram_total"s)), mem_width - 8 - (int)vram_restore_letters.size()),
+						Theme::c("hi_fg"), vram_restore_letters, Theme::c("main_fg"), Fx::ub);
 					Input::mouse_mappings["V"] = {y+1+cy, x+1+cx, 1, 1};
 					//? Add mouse mappings for restore letters
 					if (not vram_restore_mappings.empty()) {
@@ -2798,13 +2756,13 @@ namespace Mem {
 				//? Line 1: title + value (with optional [x] prefix in toggle mode 1)
 				//? Use highlight color if this item is selected
 				const string title_color = is_selected ? Theme::c("hi_fg") : Theme::c("title");
-				out += Mv::to(y+1+cy, x+1+cx) + h_divider;
+				append(out, Mv::to(y+1+cy, x+1+cx), h_divider);
 				if (item_toggle_mode == 1) {
-					out += Theme::c("hi_fg") + "[x]" + Theme::c("main_fg") + " ";
+					append(out, Theme::c("hi_fg"), "[x]", Theme::c("main_fg"), " ");
 					Input::mouse_mappings[hide_key] = {y+1+cy, x+1+cx, 1, 3};
 				}
-				out += (is_selected ? Fx::b : "") + title_color + display_title + ":" + Theme::c("main_fg") + Fx::ub
-					+ Mv::to(y+1+cy, x+cx + value_start) + (h_divider.empty() ? Mv::l(offset) + string(" ") * offset + humanized : trans(humanized));
+				append(out, (is_selected ? Fx::b : ""), title_color, display_title, ":", Theme::c("main_fg"), Fx::ub,
+					Mv::to(y+1+cy, x+cx + value_start), (h_divider.empty() ? Mv::l(offset) + string(" ") * offset + humanized : trans(humanized)));
 
 				//? Line 2+: graphics (meter or graph) + percentage
 				//? Height > min_height (13): multi-line braille with percentage at bottom row
@@ -2812,23 +2770,23 @@ namespace Mem {
 				const string pct_str = to_string(percent_value) + "%";
 				if (height > min_height and this_graph_height > 1) {
 					//? Multi-line graph mode: graph spans multiple rows, percentage at bottom
-					out += Mv::to(y+2+cy, x+1+cx) + graphics
-						+ Mv::to(y+1+cy+this_graph_height, x + mem_width - 5) + rjust(pct_str, 4);
+					append(out, Mv::to(y+2+cy, x+1+cx), graphics,
+						Mv::to(y+1+cy+this_graph_height, x + mem_width - 5), rjust(pct_str, 4));
 					cy += this_graph_height + 1;
 				} else {
 					//? Single-line mode: meter/braille + 2 spaces + percentage on same line
-					out += Mv::to(y+2+cy, x+1+cx) + graphics + "  " + rjust(pct_str, 4);
+					append(out, Mv::to(y+2+cy, x+1+cx), graphics, "  ", rjust(pct_str, 4));
 					cy += 2;
 				}
 			}
 			//? Add final divider if there's remaining space (closes off the last section)
 			if (graph_height > 0 and cy < height - 2)
-				out += Mv::to(y+1+cy, x+1+cx) + h_divider;
+				append(out, Mv::to(y+1+cy, x+1+cx), h_divider);
 
 			//? Clear remaining rows to prevent ghost content from previous renders
 			const string clear_line = string(mem_width - 1, ' ');
 			while (cy < height - 2) {
-				out += Mv::to(y+1+cy, x+1+cx) + clear_line;
+				append(out, Mv::to(y+1+cy, x+1+cx), clear_line);
 				cy++;
 			}
 
@@ -2840,9 +2798,9 @@ namespace Mem {
 				const string scroll_ind = Theme::c("hi_fg") + Fx::b;
 				const int scroll_x = x + mem_width - 2;  //? Right side of mem panel
 				if (has_more_above)
-					out += Mv::to(y + height - 1, scroll_x - 1) + scroll_ind + Symbols::up + Fx::ub;
+					append(out, Mv::to(y + height - 1, scroll_x - 1), scroll_ind, Symbols::up, Fx::ub);
 				if (has_more_below)
-					out += Mv::to(y + height - 1, scroll_x) + scroll_ind + Symbols::down + Fx::ub;
+					append(out, Mv::to(y + height - 1, scroll_x), scroll_ind, Symbols::down, Fx::ub);
 			}
 		}
 
@@ -2899,15 +2857,15 @@ namespace Mem {
 					//? Highlight selected disk
 					const bool is_selected = (disk_selected > 0 and visible_index == disk_selected);
 					const string title_color = is_selected ? Theme::c("hi_fg") : Theme::c("title");
-					out += Mv::to(y+1+cy, x+1+cx) + disk_divider + title_color + Fx::b + uresize(disk.name, disks_width - 8) + Mv::to(y+1+cy, x+cx + disks_width - total.size())
-						+ trans(total) + Fx::ub;
+					append(out, Mv::to(y+1+cy, x+1+cx), disk_divider, title_color, Fx::b, uresize(disk.name, disks_width - 8), Mv::to(y+1+cy, x+cx + disks_width - total.size()),
+						trans(total), Fx::ub);
 					if (big_disk) {
 						const string used_percent = to_string(disk.used_percent);
-						out += Mv::to(y+1+cy, x+1+cx + round((double)disks_width / 2) - round((double)used_percent.size() / 2) - 1) + hu_div + used_percent + '%' + hu_div;
+						append(out, Mv::to(y+1+cy, x+1+cx + round((double)disks_width / 2) - round((double)used_percent.size() / 2) - 1), hu_div, used_percent, '%', hu_div);
 					}
 					if (io_graphs.contains(mount + "_activity")) {
-					out += Mv::to(y+2+cy++, x+1+cx) + (big_disk ? " IO% " : " IO   " + Mv::l(2)) + Theme::c("inactive_fg") + graph_bg * (disks_width - 6)
-						+ Mv::l(disks_width - 6) + io_graphs.at(mount + "_activity")(disk.io_activity, redraw or data_same) + Theme::c("main_fg");
+					append(out, Mv::to(y+2+cy++, x+1+cx), (big_disk ? " IO% " : " IO   " + Mv::l(2)), Theme::c("inactive_fg"), graph_bg * (disks_width - 6),
+						Mv::l(disks_width - 6), io_graphs.at(mount + "_activity")(disk.io_activity, redraw or data_same), Theme::c("main_fg"));
 					}
 					cy++;  //? Advance to IO graph row (space already verified at loop start)
 					if (io_graph_combined) {
@@ -2916,8 +2874,8 @@ namespace Mem {
 						const string humanized = (disk.io_write.back() > 0 ? "▼"s : ""s) + (disk.io_read.back() > 0 ? "▲"s : ""s)
 												+ (comb_val > 0 ? Mv::r(1) + floating_humanizer(comb_val, true) : "RW");
 						if (disks_io_h == 1) out += Mv::to(y+1+cy, x+1+cx) + string(5, ' ');
-						out += Mv::to(y+1+cy, x+1+cx) + io_graphs.at(mount)({comb_val}, redraw or data_same)
-							+ Mv::to(y+1+cy, x+1+cx) + Theme::c("main_fg") + humanized;
+						append(out, Mv::to(y+1+cy, x+1+cx), io_graphs.at(mount)({comb_val}, redraw or data_same),
+							Mv::to(y+1+cy, x+1+cx), Theme::c("main_fg"), humanized);
 						cy += disks_io_h;
 					}
 					else {
@@ -2925,9 +2883,9 @@ namespace Mem {
 						const string human_read = (disk.io_read.back() > 0 ? "▲" + floating_humanizer(disk.io_read.back(), true) : "R");
 						const string human_write = (disk.io_write.back() > 0 ? "▼" + floating_humanizer(disk.io_write.back(), true) : "W");
 						if (disks_io_h <= 3) out += Mv::to(y+1+cy, x+1+cx) + string(5, ' ') + Mv::to(y+cy + disks_io_h, x+1+cx) + string(5, ' ');
-						out += Mv::to(y+1+cy, x+1+cx) + io_graphs.at(mount + "_read")(disk.io_read, redraw or data_same) + Mv::l(disks_width)
-							+ Mv::d(1) + io_graphs.at(mount + "_write")(disk.io_write, redraw or data_same)
-							+ Mv::to(y+1+cy, x+1+cx) + human_read + Mv::to(y+cy + disks_io_h, x+1+cx) + human_write;
+						append(out, Mv::to(y+1+cy, x+1+cx), io_graphs.at(mount + "_read")(disk.io_read, redraw or data_same), Mv::l(disks_width),
+							Mv::d(1), io_graphs.at(mount + "_write")(disk.io_write, redraw or data_same),
+							Mv::to(y+1+cy, x+1+cx), human_read, Mv::to(y+cy + disks_io_h, x+1+cx), human_write);
 						cy += disks_io_h;
 					}
 				}
@@ -2966,27 +2924,27 @@ namespace Mem {
 					//? Highlight selected disk
 					const bool is_selected = (disk_selected > 0 and visible_index == disk_selected);
 					const string title_color = is_selected ? Theme::c("hi_fg") : Theme::c("title");
-					out += Mv::to(y+1+cy, x+1+cx) + disk_divider + title_color + Fx::b + uresize(disk.name, disks_width - 8) + Mv::to(y+1+cy, x+cx + disks_width - human_total.size())
-						+ trans(human_total) + Fx::ub + Theme::c("main_fg");
+					append(out, Mv::to(y+1+cy, x+1+cx), disk_divider, title_color, Fx::b, uresize(disk.name, disks_width - 8), Mv::to(y+1+cy, x+cx + disks_width - human_total.size()),
+						trans(human_total), Fx::ub, Theme::c("main_fg"));
 					if (big_disk and not human_io.empty())
-						out += Mv::to(y+1+cy, x+1+cx + round((double)disks_width * 2 / 3) - round((double)human_io.size() / 2) - 1) + hu_div + human_io + hu_div;
+						append(out, Mv::to(y+1+cy, x+1+cx + round((double)disks_width * 2 / 3) - round((double)human_io.size() / 2) - 1), hu_div, human_io, hu_div);
 					cy++;
 
 					if (disk_has_io) {
-						out += Mv::to(y+1+cy, x+1+cx) + (big_disk ? " IO% " : " IO   " + Mv::l(2)) + Theme::c("inactive_fg") + graph_bg * (disks_width - 6) + Theme::g("available").at(clamp(disk.io_activity.back(), 50ll, 100ll))
-							+ Mv::l(disks_width - 6) + io_graphs.at(mount + "_activity")(disk.io_activity, redraw or data_same) + Theme::c("main_fg");
+						append(out, Mv::to(y+1+cy, x+1+cx), (big_disk ? " IO% " : " IO   " + Mv::l(2)), Theme::c("inactive_fg"), graph_bg * (disks_width - 6), Theme::g("available").at(clamp(disk.io_activity.back(), 50ll, 100ll)),
+							Mv::l(disks_width - 6), io_graphs.at(mount + "_activity")(disk.io_activity, redraw or data_same), Theme::c("main_fg"));
 						if (not big_disk) out += Mv::to(y+1+cy, x+cx+1) + Theme::c("main_fg") + human_io;
 						cy++;
 					}
 
-					out += Mv::to(y+1+cy, x+1+cx) + (big_disk ? " Used:" + rjust(to_string(disk.used_percent) + '%', 4) : "U") + ' '
-						+ disk_meters_used.at(mount)(disk.used_percent) + rjust(human_used, (big_disk ? 9 : 5));
+					append(out, Mv::to(y+1+cy, x+1+cx), (big_disk ? " Used:" + rjust(to_string(disk.used_percent) + '%', 4) : "U"), ' ',
+						disk_meters_used.at(mount)(disk.used_percent), rjust(human_used, (big_disk ? 9 : 5)));
 					cy++;
 
 					//? Always show Free row for visible disks
 					if (disk_meters_free.contains(mount)) {
-						out += Mv::to(y+1+cy, x+1+cx) + (big_disk ? " Free:" + rjust(to_string(disk.free_percent) + '%', 4) : "F") + ' '
-						+ disk_meters_free.at(mount)(disk.free_percent) + rjust(human_free, (big_disk ? 9 : 5));
+						append(out, Mv::to(y+1+cy, x+1+cx), (big_disk ? " Free:" + rjust(to_string(disk.free_percent) + '%', 4) : "F"), ' ',
+						disk_meters_free.at(mount)(disk.free_percent), rjust(human_free, (big_disk ? 9 : 5)));
 						cy++;
 					}
 
@@ -2998,7 +2956,7 @@ namespace Mem {
 			//? Clear remaining rows to prevent ghost content from previous renders
 			const string clear_line = string(disks_width, ' ');
 			while (cy < height - 2) {
-				out += Mv::to(y+1+cy, x+1+cx) + clear_line;
+				append(out, Mv::to(y+1+cy, x+1+cx), clear_line);
 				cy++;
 			}
 
@@ -3011,14 +2969,14 @@ namespace Mem {
 				const string scroll_ind = Theme::c("hi_fg") + Fx::b;
 				const int scroll_x = x + cx + disks_width - 2;  //? Right side of disk panel
 				if (has_more_above)
-					out += Mv::to(y + height - 1, scroll_x - 1) + scroll_ind + Symbols::up + Fx::ub;  //? ↑ next to ↓
+					append(out, Mv::to(y + height - 1, scroll_x - 1), scroll_ind, Symbols::up, Fx::ub);  //? ↑ next to ↓
 				if (has_more_below)
-					out += Mv::to(y + height - 1, scroll_x) + scroll_ind + Symbols::down + Fx::ub;
+					append(out, Mv::to(y + height - 1, scroll_x), scroll_ind, Symbols::down, Fx::ub);
 			}
 		}
 
 		redraw = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 
 }
@@ -3035,10 +2993,10 @@ namespace Net {
 	std::unordered_map<string, Draw::Graph> graphs;
 	string box;
 
-	string draw(const net_info& net, bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+	void draw(string& out, const net_info& net, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 		//? Defensive check: skip drawing if dimensions are invalid (terminal too small or resizing)
-		if (Net::width < 10 or Net::height < 5) return "";
+		if (Net::width < 10 or Net::height < 5) return;
 		if (force_redraw) redraw = true;
 
 		//? Force redraw if dimensions have changed since last draw (prevents scrambled text)
@@ -3059,8 +3017,6 @@ namespace Net {
 			old_ip = ip_addr;
 			redraw = true;
 		}
-		string out;
-		out.reserve(width * height);
 		const string title_left = Theme::c("net_box") + Fx::ub + Symbols::title_left;
 		const string title_right = Theme::c("net_box") + Fx::ub + Symbols::title_right;
 		const int i_size = min((int)selected_iface.size(), MAX_IFNAMSIZ);
@@ -3072,7 +3028,7 @@ namespace Net {
 			const bool vertical_mode = (net_graph_direction >= 2);
 
 			//? Regenerate main box
-			out = Draw::createBox(x, y, width, height, Theme::c("net_box"), true, "net", "", 3);
+			out += Draw::createBox(x, y, width, height, Theme::c("net_box"), true, "net", "", 3);
 
 			//? Vertical mode needs minimum height (box height 4 + graph space 4 + borders 2 = 10)
 			const int vertical_min_height = 10;
@@ -3104,12 +3060,12 @@ namespace Net {
 				//? Manually draw "upload" title on RIGHT side
 				const int upload_title_x = upload_box_x + actual_single_width - 10;
 				if (bottom_up) {
-					out += Mv::to(info_box_y + info_box_height - 1, upload_title_x) + Theme::c("net_box")
-						+ Symbols::title_left_down + Fx::b + Theme::c("title") + "upload" + Fx::ub
-						+ Theme::c("net_box") + Symbols::title_right_down;
+					append(out, Mv::to(info_box_y + info_box_height - 1, upload_title_x), Theme::c("net_box"),
+						Symbols::title_left_down, Fx::b, Theme::c("title"), "upload", Fx::ub,
+						Theme::c("net_box"), Symbols::title_right_down);
 				} else {
-					out += Mv::to(info_box_y, upload_title_x) + Theme::c("net_box") + Symbols::title_left + Fx::b
-						+ Theme::c("title") + "upload" + Fx::ub + Theme::c("net_box") + Symbols::title_right;
+					append(out, Mv::to(info_box_y, upload_title_x), Theme::c("net_box"), Symbols::title_left, Fx::b,
+						Theme::c("title"), "upload", Fx::ub, Theme::c("net_box"), Symbols::title_right);
 				}
 
 				//? Store for stats rendering
@@ -3133,8 +3089,10 @@ namespace Net {
 
 			//? Graphs
 			graphs.clear();
-			if (safeVal(net.bandwidth, "download"s).empty() or safeVal(net.bandwidth, "upload"s).empty())
-				return out + Fx::reset;
+			if (safeVal(net.bandwidth, "download"s).empty() or safeVal(net.bandwidth, "upload"s).empty()) {
+				out += Fx::reset;
+				return;
+			}
 
 			if (use_vertical) {
 				//? Vertical: full width graphs, side-by-side
@@ -3165,27 +3123,27 @@ namespace Net {
 
 			//? Interface selector and buttons
 
-			out += Mv::to(y, x+width - i_size - 9) + title_left + Fx::b + Theme::c("hi_fg") + Symbols::left + "b " + Theme::c("title")
-				+ uresize(selected_iface, MAX_IFNAMSIZ) + Theme::c("hi_fg") + " n" + Symbols::right + title_right
-				+ Mv::to(y, x+width - i_size - 15) + title_left + Theme::c("hi_fg") + (safeVal(net.stat, "download"s).offset + safeVal(net.stat, "upload"s).offset > 0 ? Fx::b : "") + 'z'
-				+ Theme::c("title") + "ero" + title_right;
+			append(out, Mv::to(y, x+width - i_size - 9), title_left, Fx::b, Theme::c("hi_fg"), Symbols::left, "b ", Theme::c("title"),
+				uresize(selected_iface, MAX_IFNAMSIZ), Theme::c("hi_fg"), " n", Symbols::right, title_right,
+				Mv::to(y, x+width - i_size - 15), title_left, Theme::c("hi_fg"), (safeVal(net.stat, "download"s).offset + safeVal(net.stat, "upload"s).offset > 0 ? Fx::b : ""), 'z',
+				Theme::c("title"), "ero", title_right);
 			Input::mouse_mappings["b"] = {y, x+width - i_size - 8, 1, 3};
 			Input::mouse_mappings["n"] = {y, x+width - 6, 1, 3};
 			Input::mouse_mappings["z"] = {y, x+width - i_size - 14, 1, 4};
 			if (width - i_size - 20 > 6) {
-				out += Mv::to(y, x+width - i_size - 21) + title_left + Theme::c("hi_fg") + (net_auto ? Fx::b : "") + 'a' + Theme::c("title") + "uto" + title_right;
+				append(out, Mv::to(y, x+width - i_size - 21), title_left, Theme::c("hi_fg"), (net_auto ? Fx::b : ""), 'a', Theme::c("title"), "uto", title_right);
 				Input::mouse_mappings["a"] = {y, x+width - i_size - 20, 1, 4};
 			}
 			if (width - i_size - 20 > 13) {
-				out += Mv::to(y, x+width - i_size - 27) + title_left + Theme::c("title") + (net_sync ? Fx::b : "") + 's' + Theme::c("hi_fg")
-					+ 'y' + Theme::c("title") + "nc" + title_right;
+				append(out, Mv::to(y, x+width - i_size - 27), title_left, Theme::c("title"), (net_sync ? Fx::b : ""), 's', Theme::c("hi_fg"),
+					'y', Theme::c("title"), "nc", title_right);
 				Input::mouse_mappings["y"] = {y, x+width - i_size - 26, 1, 4};
 			}
 			//? Graph direction indicator with #/Shift+3 to cycle (0=RTL ←, 1=LTR →, 2=TTB ↓, 3=BTT ↑)
 			if (width - i_size - 20 > 17) {
 				const string dir_arrows[] = {"←", "→", "↓", "↑"};
-				out += Mv::to(y, x+width - i_size - 31) + title_left + Theme::c("hi_fg") + Fx::b
-					+ dir_arrows[net_graph_direction % 4] + title_right;
+				append(out, Mv::to(y, x+width - i_size - 31), title_left, Theme::c("hi_fg"), Fx::b,
+					dir_arrows[net_graph_direction % 4], title_right);
 				Input::mouse_mappings["#"] = {y, x+width - i_size - 30, 1, 1};
 			}
 		}
@@ -3194,7 +3152,7 @@ namespace Net {
 		//? Indicator offset only when panel is at top (y==1)
 		const int ind_offset = (Config::getB("show_instance_indicator") and y == 1) ? 4 : 0;
 		if (not ip_addr.empty() and cmp_greater(width - i_size - 36, ip_addr.size())) {
-			out += Mv::to(y, x + 8 + ind_offset) + title_left + Theme::c("title") + Fx::b + ip_addr + title_right;
+			append(out, Mv::to(y, x + 8 + ind_offset), title_left, Theme::c("title"), Fx::b, ip_addr, title_right);
 		}
 
 		//? Graphs and stats
@@ -3222,8 +3180,8 @@ namespace Net {
 			//? Scale text at top of graph area (where newest data is for TTB, oldest for BTT)
 			const string down_text = floating_humanizer(down_max, true);
 			const string up_text = floating_humanizer(up_max, true);
-			out += Mv::to(graph_y, x + half_width - (int)down_text.size()) + Fx::ub + Theme::c("graph_text") + down_text;
-			out += Mv::to(graph_y, x + 1 + half_width) + Fx::ub + Theme::c("graph_text") + up_text;
+			append(out, Mv::to(graph_y, x + half_width - (int)down_text.size()), Fx::ub, Theme::c("graph_text"), down_text);
+			append(out, Mv::to(graph_y, x + 1 + half_width), Fx::ub, Theme::c("graph_text"), up_text);
 
 			//? Stats in two separate boxes: download (left box), upload (right box mirrored)
 			const int single_box_width = b_width / 2;
@@ -3233,8 +3191,8 @@ namespace Net {
 			const string up_total = floating_humanizer(safeVal(net.stat, "upload"s).total);
 
 			//? Download box (left): ▼ symbol on left, values after
-			out += Mv::to(b_y + 1, b_x + 1) + Fx::ub + Theme::c("main_fg") + "▼ " + down_speed;
-			out += Mv::to(b_y + 2, b_x + 1) + "▼ Total: " + down_total;
+			append(out, Mv::to(b_y + 1, b_x + 1), Fx::ub, Theme::c("main_fg"), "▼ ", down_speed);
+			append(out, Mv::to(b_y + 2, b_x + 1), "▼ Total: ", down_total);
 
 			//? Upload box (right, mirrored): values right-aligned, ▲ symbol at end
 			const int up_box_x = b_x + single_box_width;
@@ -3243,8 +3201,8 @@ namespace Net {
 			const string up_line2 = "Total: " + up_total + " ▲";
 			const int line1_pos = up_box_x + up_inner_width - (int)ulen(up_line1);
 			const int line2_pos = up_box_x + up_inner_width - (int)ulen(up_line2);
-			out += Mv::to(b_y + 1, line1_pos + 1) + Fx::ub + Theme::c("main_fg") + up_line1;
-			out += Mv::to(b_y + 2, line2_pos + 1) + up_line2;
+			append(out, Mv::to(b_y + 1, line1_pos + 1), Fx::ub, Theme::c("main_fg"), up_line1);
+			append(out, Mv::to(b_y + 2, line2_pos + 1), up_line2);
 		} else {
 			//? HORIZONTAL MODE: stacked graphs with side info box
 			//? If vertical direction (2,3) is set but can't be used, treat as RTL (0)
@@ -3265,7 +3223,7 @@ namespace Net {
 				const string max_text = floating_humanizer((dir == "upload" ? up_max : down_max), true);
 				const int text_y = y+1 + (((dir == "upload") == (!swap_upload_download)) * (height - 3));
 				const int text_x = (horiz_dir == 1) ? graph_x : (graph_x + graph_area_width - (int)max_text.size());
-				out += Mv::to(text_y, text_x) + Fx::ub + Theme::c("graph_text") + max_text;
+				append(out, Mv::to(text_y, text_x), Fx::ub, Theme::c("graph_text"), max_text);
 
 				//? Stats in info box
 				const string speed = floating_humanizer(safeVal(net.stat, dir).speed, false, 0, false, true);
@@ -3275,23 +3233,23 @@ namespace Net {
 				const string symbol = (dir == "upload" ? "▲" : "▼");
 
 				if ((swap_upload_download and dir == "upload") or (not swap_upload_download and dir == "download")) {
-					out += Mv::to(b_y+1, b_x+1) + Fx::ub + Theme::c("main_fg") + symbol + ' ' + ljust(speed, 10) + (b_width >= 20 ? rjust('(' + speed_bits + ')', 13) : "");
+					append(out, Mv::to(b_y+1, b_x+1), Fx::ub, Theme::c("main_fg"), symbol, ' ', ljust(speed, 10), (b_width >= 20 ? rjust('(' + speed_bits + ')', 13) : ""));
 					if (b_height >= 8)
-						out += Mv::to(b_y+2, b_x+1) + symbol + ' ' + "Top: " + rjust('(' + top, (b_width >= 20 ? 17 : 9)) + ')';
+						append(out, Mv::to(b_y+2, b_x+1), symbol, ' ', "Top: ", rjust('(' + top, (b_width >= 20 ? 17 : 9)), ')');
 					if (b_height >= 6)
-						out += Mv::to(b_y+2 + (b_height >= 8), b_x+1) + symbol + ' ' + "Total: " + rjust(total, (b_width >= 20 ? 16 : 8));
+						append(out, Mv::to(b_y+2 + (b_height >= 8), b_x+1), symbol, ' ', "Total: ", rjust(total, (b_width >= 20 ? 16 : 8)));
 				} else {
-					out += Mv::to(b_y + b_height - (b_height / 2), b_x + 1) + Fx::ub + Theme::c("main_fg") + symbol + ' ' + ljust(speed, 10) + (b_width >= 20 ? rjust('(' + speed_bits + ')', 13) : "");
+					append(out, Mv::to(b_y + b_height - (b_height / 2), b_x + 1), Fx::ub, Theme::c("main_fg"), symbol, ' ', ljust(speed, 10), (b_width >= 20 ? rjust('(' + speed_bits + ')', 13) : ""));
 					if (b_height >= 8)
-						out += Mv::to(b_y + b_height - (b_height / 2) + 1, b_x + 1) + symbol + ' ' + "Top: " + rjust('(' + top, (b_width >= 20 ? 17 : 9)) + ')';
+						append(out, Mv::to(b_y + b_height - (b_height / 2) + 1, b_x + 1), symbol, ' ', "Top: ", rjust('(' + top, (b_width >= 20 ? 17 : 9)), ')');
 					if (b_height >= 6)
-						out += Mv::to(b_y + b_height - (b_height / 2) + 1 + (b_height >= 8), b_x + 1) + symbol + ' ' + "Total: " + rjust(total, (b_width >= 20 ? 16 : 8));
+						append(out, Mv::to(b_y + b_height - (b_height / 2) + 1 + (b_height >= 8), b_x + 1), symbol, ' ', "Total: ", rjust(total, (b_width >= 20 ? 16 : 8)));
 				}
 			}
 		}
 
 		redraw = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 
 }
@@ -3314,6 +3272,13 @@ namespace Proc {
 	std::unordered_map<size_t, bool> p_wide_cmd;
 	std::unordered_map<size_t, int> p_counters;
 	std::unordered_map<size_t, int> p_gpu_counters;
+	//? Last drawn text of each process row and the digest of what it was drawn from
+	struct row_cache_entry {
+		uint64_t digest{};
+		string text;						//? Row without its graphs, they're drawn again every time the row is reused
+		size_t cpu_graph_at{}, gpu_graph_at{};	//? Where the graphs go in text
+	};
+	std::unordered_map<size_t, row_cache_entry> p_rows;
 	int counter = 0;
 	Draw::TextEdit filter;
 	Draw::Graph detailed_cpu_graph;
@@ -3412,10 +3377,24 @@ namespace Proc {
 		return (not changed ? -1 : selected);
 	}
 
-	string draw(const vector<proc_info>& plist, bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+	//* Digest of the values a process row is drawn from, rows with the same digest are drawn the same
+	class row_digest {
+		uint64_t hash{0x9e3779b97f4a7c15};
+		void mix(uint64_t value) { hash ^= value + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2); }
+	public:
+		template <typename... T>
+		explicit row_digest(const T&... values) { (add(values), ...); }
+
+		template <std::integral T>
+		void add(T value) { mix(static_cast<uint64_t>(value)); }
+		void add(std::string_view value) { mix(std::hash<std::string_view>{}(value)); }
+		uint64_t value() const noexcept { return hash; }
+	};
+
+	void draw(string& out, const vector<proc_info>& plist, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 		//? Defensive check: skip drawing if dimensions are invalid (terminal too small or resizing)
-		if (Proc::width < 10 or Proc::height < 5) return "";
+		if (Proc::width < 10 or Proc::height < 5) return;
 		auto proc_tree = Config::getB("proc_tree");
 		bool show_detailed = (Config::getB("show_detailed") and cmp_equal(Proc::detailed.last_pid, Config::getI("detailed_pid")));
 		bool proc_gradient = (Config::getB("proc_gradient") and not Config::getB("lowcolor") and Theme::gradients.contains("proc"));
@@ -3453,7 +3432,7 @@ namespace Proc {
 			Config::set("proc_last_selected", 0);
 			redraw = true;
 			//? Recalculate values without detailed view
-			return "";  //? Return empty to trigger a full redraw in the next cycle
+			return;  //? Return empty to trigger a full redraw in the next cycle
 		}
 
 		//? Ensure select_max is at least 1 to prevent division by zero and other issues
@@ -3470,8 +3449,6 @@ namespace Proc {
 			last_height = Proc::height;
 		}
 
-		string out;
-		out.reserve(width * height);
 
 		//? Move current selection/view to the selected process when a process should be followed
 		//? Restore view and selection to the detailed view process when detailed view is closed
@@ -3533,7 +3510,8 @@ namespace Proc {
 
 		//* Redraw elements not needed to be updated every cycle
 		if (redraw) {
-			out = box;
+			out += box;
+			p_rows.clear();
 			const string title_left = Theme::c("proc_box") + Symbols::title_left;
 			const string title_right = Theme::c("proc_box") + Symbols::title_right;
 			const string title_left_down = Theme::c("proc_box") + Symbols::title_left_down;
@@ -3836,26 +3814,26 @@ namespace Proc {
 				const string pid_str = to_string(detailed.entry.pid);
 				const bool show_detail_indicator = Config::getB("show_instance_indicator");
 				const int detail_ind_offset = show_detail_indicator ? 4 : 0;
-				out += Mv::to(y, x) + Theme::c("proc_box") + Symbols::div_left + Symbols::h_line + title_left + Theme::c("hi_fg") + Fx::b
-				+ (tty_mode ? "4" : Symbols::superscript.at(4)) + Theme::c("title") + "proc"
-					+ Fx::ub + title_right + Symbols::h_line * (width - 10) + Symbols::div_right;
+				append(out, Mv::to(y, x), Theme::c("proc_box"), Symbols::div_left, Symbols::h_line, title_left, Theme::c("hi_fg"), Fx::b,
+				(tty_mode ? "4" : Symbols::superscript.at(4)), Theme::c("title"), "proc",
+					Fx::ub, title_right, Symbols::h_line * (width - 10), Symbols::div_right);
 
 				//? Draw instance indicator on details panel header
 				if (show_detail_indicator) {
 					const string indicator_str = Config::another_instance_running ? "S" : "P";
 					const string& indicator_color = Config::another_instance_running ? Draw::nord_green : Draw::nord_orange;
-					out += Mv::to(d_y, dgraph_x + 1) + Theme::c("proc_box") + Symbols::h_line + Symbols::div_left
-						+ indicator_color + Fx::b + indicator_str
-						+ Theme::c("proc_box") + Fx::ub + Symbols::div_right;
+					append(out, Mv::to(d_y, dgraph_x + 1), Theme::c("proc_box"), Symbols::h_line, Symbols::div_left,
+						indicator_color, Fx::b, indicator_str,
+						Theme::c("proc_box"), Fx::ub, Symbols::div_right);
 				}
 
-				out += Mv::to(d_y, dgraph_x + 2 + detail_ind_offset) + title_left + Fx::b + Theme::c("hi_fg") + pid_str + Fx::ub + title_right
-					+ title_left + Fx::b + Theme::c("title") + uresize(detailed.entry.name, dgraph_width - pid_str.size() - 7 - detail_ind_offset, true) + Fx::ub + title_right;
+				append(out, Mv::to(d_y, dgraph_x + 2 + detail_ind_offset), title_left, Fx::b, Theme::c("hi_fg"), pid_str, Fx::ub, title_right,
+					title_left, Fx::b, Theme::c("title"), uresize(detailed.entry.name, dgraph_width - pid_str.size() - 7 - detail_ind_offset, true), Fx::ub, title_right);
 
 				//? Mouse mapping for clicking PID to copy to clipboard
 				Input::mouse_mappings["copy_pid"] = {d_y, dgraph_x + 3 + detail_ind_offset, 1, (int)pid_str.size() + 2};
 
-				out += Mv::to(d_y, d_x - 1) + Theme::c("proc_box") + Symbols::div_up + Mv::to(y, d_x - 1) + Symbols::div_down + Theme::c("div_line");
+				append(out, Mv::to(d_y, d_x - 1), Theme::c("proc_box"), Symbols::div_up, Mv::to(y, d_x - 1), Symbols::div_down, Theme::c("div_line"));
 				for (const int& i : iota(1, 8)) out += Mv::to(d_y + i, d_x - 1) + Symbols::v_line;
 
 				const string t_color = (not alive or selected > 0 ? Theme::c("inactive_fg") : Theme::c("title"));
@@ -3863,13 +3841,13 @@ namespace Proc {
 				int mouse_x = d_x + 2;
 				out += Mv::to(d_y, d_x + 1);
 				if (width > 55) {
-					out += Fx::ub + title_left + hi_color + Fx::b + 't' + t_color + "erminate" + Fx::ub + title_right;
+					append(out, Fx::ub, title_left, hi_color, Fx::b, 't', t_color, "erminate", Fx::ub, title_right);
 					if (alive and selected == 0) Input::mouse_mappings["t"] = {d_y, mouse_x, 1, 9};
 					mouse_x += 11;
 				}
-				out += title_left + hi_color + Fx::b + (vim_keys ? 'K' : 'k') + t_color + "ill" + Fx::ub + title_right
-					+ title_left + hi_color + Fx::b + 's' + t_color + "ignals" + Fx::ub + title_right
-					+ title_left + hi_color + Fx::b + 'N' + t_color + "ice" + Fx::ub + title_right;
+				append(out, title_left, hi_color, Fx::b, (vim_keys ? 'K' : 'k'), t_color, "ill", Fx::ub, title_right,
+					title_left, hi_color, Fx::b, 's', t_color, "ignals", Fx::ub, title_right,
+					title_left, hi_color, Fx::b, 'N', t_color, "ice", Fx::ub, title_right);
 				if (alive and selected == 0) {
 					Input::mouse_mappings[vim_keys ? "K" : "k"] = {d_y, mouse_x, 1, 4};
 					mouse_x += 6;
@@ -3892,10 +3870,10 @@ namespace Proc {
 				    auto log_cfg = Config::find_process_config(detailed.entry.name, detailed.entry.cmd);
 				    bool has_app_log = log_cfg.has_value() && log_cfg->has_logging();
 				    
-				    out += title_left + Fx::b + hi_color + 'L' + t_color + "og"
-				    	+ Theme::c("log_debug_plus") + "◉"  //? System always available (green)
-				    	+ (has_app_log ? Theme::c("log_fault") : Theme::c("inactive_fg")) + "◉"  //? App (red if available)
-				    	+ Fx::ub + title_right;
+				    append(out, title_left, Fx::b, hi_color, 'L', t_color, "og",
+				    	Theme::c("log_debug_plus"), "◉",  //? System always available (green)
+				    	(has_app_log ? Theme::c("log_fault") : Theme::c("inactive_fg")), "◉",  //? App (red if available)
+				    	Fx::ub, title_right);
 				    if (alive and selected == 0) {
 				        Input::mouse_mappings["L"] = {d_y, mouse_x, 1, 5};  //? "Log◉◉" = 5 chars
 				    }
@@ -3905,9 +3883,9 @@ namespace Proc {
 				//? Labels
 				const int item_fit = floor((double)(d_width - 2) / 10);
 				const int item_width = floor((double)(d_width - 2) / min(item_fit, 8));
-				out += Mv::to(d_y + 1, d_x + 1) + Fx::b + Theme::c("title")
-										+ cjust("Status:", item_width)
-										+ cjust("Elapsed:", item_width);
+				append(out, Mv::to(d_y + 1, d_x + 1), Fx::b, Theme::c("title"),
+										cjust("Status:", item_width),
+										cjust("Elapsed:", item_width));
 				if (item_fit >= 3) out += cjust("IO/R:", item_width);
 				if (item_fit >= 4) out += cjust("IO/W:", item_width);
 				if (item_fit >= 5) out += cjust("Parent:", item_width);
@@ -3918,14 +3896,14 @@ namespace Proc {
 
 				//? Command line (highlighted to indicate clickable)
 				for (int i = 0; const auto& l : {'C', 'M', 'D'})
-				out += Mv::to(d_y + 5 + i++, d_x + 1) + l;
+				append(out, Mv::to(d_y + 5 + i++, d_x + 1), l);
 
-				out += Theme::c("hi_fg") + Fx::ub;
+				append(out, Theme::c("hi_fg"), Fx::ub);
 				const auto san_cmd = replace_ascii_control(detailed.entry.cmd);
 				const int cmd_size = ulen(san_cmd, true);
 				for (int num_lines = min(3, (int)ceil((double)cmd_size / (d_width - 5))), i = 0; i < num_lines; i++) {
-					out += Mv::to(d_y + 5 + (num_lines == 1 ? 1 : i), d_x + 3)
-						+ cjust(luresize(san_cmd, cmd_size - (d_width - 5) * i, true), d_width - 5, true, true);
+					append(out, Mv::to(d_y + 5 + (num_lines == 1 ? 1 : i), d_x + 3),
+						cjust(luresize(san_cmd, cmd_size - (d_width - 5) * i, true), d_width - 5, true, true));
 				}
 
 				//? Mouse mapping for clicking CMD area to copy command to clipboard
@@ -3940,10 +3918,10 @@ namespace Proc {
 			//? Filter
 			auto filtering = Config::getB("proc_filtering"); // ? filter(20) : Config::getS("proc_filter"))
 			const auto filter_text = (filtering) ? filter(max(6, width - 66)) : uresize(Config::getS("proc_filter"), max(6, width - 66));
-			out += Mv::to(y, x + 9 + ind_offset) + title_left + (not filter_text.empty() ? Fx::b : "") + Theme::c("hi_fg") + 'f'
-				+ Theme::c("title") + (not filter_text.empty() ? ' ' + filter_text : "ilter")
-				+ (not filtering and not filter_text.empty() ? Theme::c("hi_fg") + " del" : "")
-				+ (filtering ? Theme::c("hi_fg") + ' ' + Symbols::enter : "") + Fx::ub + title_right;
+			append(out, Mv::to(y, x + 9 + ind_offset), title_left, (not filter_text.empty() ? Fx::b : ""), Theme::c("hi_fg"), 'f',
+				Theme::c("title"), (not filter_text.empty() ? ' ' + filter_text : "ilter"),
+				(not filtering and not filter_text.empty() ? Theme::c("hi_fg") + " del" : ""),
+				(filtering ? Theme::c("hi_fg") + ' ' + Symbols::enter : ""), Fx::ub, title_right);
 			
 			//? Calculate filter end position for tagged button
 			int filter_end_x = x + 10 + ind_offset;  //? Start after "┐f"
@@ -3968,8 +3946,8 @@ namespace Proc {
 			//? Show in red (log_fault) when filter is ON and list is empty - visual warning
 			const bool tagged_warning = filter_tagged and numpids == 0;
 			const string tagged_color = tagged_warning ? Theme::c("log_fault") : Theme::c("title");
-			out += Mv::to(y, filter_end_x) + title_left + (filter_tagged ? Fx::b : "") + tagged_color + "t"
-				+ Theme::c("hi_fg") + 'a' + tagged_color + "gged" + Fx::ub + title_right;
+			append(out, Mv::to(y, filter_end_x), title_left, (filter_tagged ? Fx::b : ""), tagged_color, "t",
+				Theme::c("hi_fg"), 'a', tagged_color, "gged", Fx::ub, title_right);
 			Input::mouse_mappings["a"] = {y, filter_end_x + 1, 1, 6};
 
 			//? pause, per-core, reverse, tree and sorting
@@ -3985,22 +3963,22 @@ namespace Proc {
 			    Input::mouse_mappings["u"] = {y, sort_pos - 31, 1, 5};
 			}
 			if (width > 55 + sort_len) {
-				out += Mv::to(y, sort_pos - 25) + title_left + (Config::getB("proc_per_core") ? Fx::b : "") + Theme::c("title")
-					+ "per-" + Theme::c("hi_fg") + 'c' + Theme::c("title") + "ore" + Fx::ub + title_right;
+				append(out, Mv::to(y, sort_pos - 25), title_left, (Config::getB("proc_per_core") ? Fx::b : ""), Theme::c("title"),
+					"per-", Theme::c("hi_fg"), 'c', Theme::c("title"), "ore", Fx::ub, title_right);
 				Input::mouse_mappings["c"] = {y, sort_pos - 24, 1, 8};
 			}
 			if (width > 52 + sort_len) {
-				out += Mv::to(y, sort_pos - 22) + title_left + (Config::getB("proc_reversed") ? Fx::b : "") + Theme::c("hi_fg")
-					+ 'r' + Theme::c("title") + "everse" + Fx::ub + title_right;
+				append(out, Mv::to(y, sort_pos - 22), title_left, (Config::getB("proc_reversed") ? Fx::b : ""), Theme::c("hi_fg"),
+					'r', Theme::c("title"), "everse", Fx::ub, title_right);
 				Input::mouse_mappings["r"] = {y, sort_pos - 21, 1, 7};
 			}
 			if (width > 35 + sort_len) {
-				out += Mv::to(y, sort_pos - 6) + title_left + (Config::getB("proc_tree") ? Fx::b : "") + Theme::c("title") + "tre"
-					+ Theme::c("hi_fg") + 'e' + Fx::ub + title_right;
+				append(out, Mv::to(y, sort_pos - 6), title_left, (Config::getB("proc_tree") ? Fx::b : ""), Theme::c("title"), "tre",
+					Theme::c("hi_fg"), 'e', Fx::ub, title_right);
 				Input::mouse_mappings["e"] = {y, sort_pos - 5, 1, 4};
 			}
-			out += Mv::to(y, sort_pos) + title_left + Fx::b + Theme::c("hi_fg") + Symbols::left + " " + Theme::c("title") + sorting + " " + Theme::c("hi_fg")
-				+ Symbols::right + Fx::ub + title_right;
+			append(out, Mv::to(y, sort_pos), title_left, Fx::b, Theme::c("hi_fg"), Symbols::left, " ", Theme::c("title"), sorting, " ", Theme::c("hi_fg"),
+				Symbols::right, Fx::ub, title_right);
 				Input::mouse_mappings["left"] = {y, sort_pos + 1, 1, 2};
 				Input::mouse_mappings["right"] = {y, sort_pos + sort_len + 3, 1, 2};
 
@@ -4011,24 +3989,24 @@ namespace Proc {
 			const string t_color = (selected == 0 ? Theme::c("inactive_fg") : Theme::c("title"));
 			const string hi_color = (selected == 0 ? Theme::c("inactive_fg") : Theme::c("hi_fg"));
 			int mouse_x = x + 14;
-			out += Mv::to(y + height - 1, x + 1) + title_left_down + Fx::b + hi_color + up_button + Theme::c("title") + " select " + down_button + Fx::ub + title_right_down
-				+ title_left_down + Fx::b + t_color + "info " + hi_color + Symbols::enter + Fx::ub + title_right_down;	
+			append(out, Mv::to(y + height - 1, x + 1), title_left_down, Fx::b, hi_color, up_button, Theme::c("title"), " select ", down_button, Fx::ub, title_right_down,
+				title_left_down, Fx::b, t_color, "info ", hi_color, Symbols::enter, Fx::ub, title_right_down);	
 				if (selected > 0) Input::mouse_mappings["info_enter"] = {y + height - 1, mouse_x, 1, 6};
 				mouse_x += 8;
 			if (width > 60) {
-				out += title_left_down + Fx::b + hi_color + 't' + t_color + "erminate" + Fx::ub + title_right_down;
+				append(out, title_left_down, Fx::b, hi_color, 't', t_color, "erminate", Fx::ub, title_right_down);
 				if (selected > 0) Input::mouse_mappings["t"] = {y + height - 1, mouse_x, 1, 9};
 				mouse_x += 11;
 			}
 			if (width > 55) {
-				out += title_left_down + Fx::b + hi_color + (vim_keys ? 'K' : 'k') + t_color + "ill" + Fx::ub + title_right_down;
+				append(out, title_left_down, Fx::b, hi_color, (vim_keys ? 'K' : 'k'), t_color, "ill", Fx::ub, title_right_down);
 				if (selected > 0) Input::mouse_mappings[vim_keys ? "K" : "k"] = {y + height - 1, mouse_x, 1, 4};
 				mouse_x += 6;
 			}
-			out += title_left_down + Fx::b + hi_color + 's' + t_color + "ignals" + Fx::ub + title_right_down;
+			append(out, title_left_down, Fx::b, hi_color, 's', t_color, "ignals", Fx::ub, title_right_down);
 			if (selected > 0) Input::mouse_mappings["s"] = {y + height - 1, mouse_x, 1, 7};
 		    mouse_x += 9;
-		    out += title_left_down + Fx::b + hi_color + 'N' + t_color + "ice" + Fx::ub + title_right_down;
+		    append(out, title_left_down, Fx::b, hi_color, 'N', t_color, "ice", Fx::ub, title_right_down);
 		    if (selected > 0) Input::mouse_mappings["N"] = {y + height -1, mouse_x, 1, 5};
 			mouse_x += 6;
 			if (width > 72) {
@@ -4041,14 +4019,14 @@ namespace Proc {
 			}
 			//? Toggle columns button (Shift+T)
 			if (width > 82) {
-			    out += title_left_down + Fx::b + Theme::c("hi_fg") + 'T' + Theme::c("title") + "oggle" + Fx::ub + title_right_down;
+			    append(out, title_left_down, Fx::b, Theme::c("hi_fg"), 'T', Theme::c("title"), "oggle", Fx::ub, title_right_down);
 			    Input::mouse_mappings["T"] = {y + height - 1, mouse_x, 1, 6};
 			    mouse_x += 8;
 			}
 			//? Logs panel button (key 8)
 			if (width > 92) {
-			    out += title_left_down + (Logs::shown ? Fx::b : "") + Theme::c("hi_fg") + '8'
-			        + Theme::c("title") + "Logs" + Fx::ub + title_right_down;
+			    append(out, title_left_down, (Logs::shown ? Fx::b : ""), Theme::c("hi_fg"), '8',
+			        Theme::c("title"), "Logs", Fx::ub, title_right_down);
 			    Input::mouse_mappings["8"] = {y + height - 1, mouse_x, 1, 5};
 			}
 
@@ -4063,7 +4041,7 @@ namespace Proc {
 					const string title = Theme::c("title");
 					int col_x = x + 1;  //? Track column position for mouse mappings
 
-					out += Mv::to(y+1, x+1) + title + Fx::b;
+					append(out, Mv::to(y+1, x+1), title, Fx::b);
 
 					//? Helper to add sortable column header with indicator
 					//? Always use fixed column width to prevent alignment shift
@@ -4071,9 +4049,9 @@ namespace Proc {
 						string header = right_just ? rjust(label, size) : ljust(label, size);
 						bool is_sorted = (sorting == sort_key);
 						if (is_sorted) {
-							out += hi + header + sort_indicator + title + " ";  //? indicator immediately after header, then trailing space
+							append(out, hi, header, sort_indicator, title, " ");  //? indicator immediately after header, then trailing space
 						} else {
-							out += header + "  ";  //? two spaces to match (indicator + trailing space)
+							append(out, header, "  ");  //? two spaces to match (indicator + trailing space)
 						}
 						Input::mouse_mappings["sort_" + sort_key] = {y+1, col_x, 1, size + 2};
 						col_x += size + 2;  //? Fixed width: header + indicator/space + trailing space
@@ -4118,40 +4096,40 @@ namespace Proc {
 					}
 					//? Command column (not sortable per user request, conditional)
 					if (cmd_size > 0) {
-						out += hi + "C" + title + "ommand";
+						append(out, hi, "C", title, "ommand");
 					}
 					out += Fx::ub;
 				}
 				else {
 					//? Side layout: original column order
 					//? Headers only shown if config enabled and size > 0
-					out += Mv::to(y+1, x+1) + Theme::c("title") + Fx::b
-						+ rjust("Pid:", 8) + ' '
-						+ ljust("Program:", prog_size) + ' ';
+					append(out, Mv::to(y+1, x+1), Theme::c("title"), Fx::b,
+						rjust("Pid:", 8), ' ',
+						ljust("Program:", prog_size), ' ');
 					//? Highlight 'C' in Command to indicate Shift+C toggle
 					if (cmd_size > 0) {
-						out += Theme::c("hi_fg") + "C" + Theme::c("title") + ljust("ommand:", cmd_size - 1) + ' ';
+						append(out, Theme::c("hi_fg"), "C", Theme::c("title"), ljust("ommand:", cmd_size - 1), ' ');
 						Input::mouse_mappings["C"] = {y+1, x+11+prog_size, 1, 1};
 					}
-					out += (thread_size > 0 ? Mv::l(4) + "Threads: " : "")
-						+ (user_size > 0 ? ljust("User:", user_size) + ' ' : "")
-						+ (show_memory_cfg ? rjust((mem_bytes ? "MemB" : "Mem%"), 5) + ' ' : "")
-						+ (io_size > 0 ? rjust("IO", io_size) + ' ' : "")
-						+ (show_cpu_cfg ? rjust("Cpu%", (show_graphs ? 10 : 5)) : "")
-						+ (show_gpu ? " " + rjust("Gpu%", gpu_size) : "") + Fx::ub;
+					append(out, (thread_size > 0 ? Mv::l(4) + "Threads: " : ""),
+						(user_size > 0 ? ljust("User:", user_size) + ' ' : ""),
+						(show_memory_cfg ? rjust((mem_bytes ? "MemB" : "Mem%"), 5) + ' ' : ""),
+						(io_size > 0 ? rjust("IO", io_size) + ' ' : ""),
+						(show_cpu_cfg ? rjust("Cpu%", (show_graphs ? 10 : 5)) : ""),
+						(show_gpu ? " " + rjust("Gpu%", gpu_size) : ""), Fx::ub);
 				}
 			}
 			else {
 				//? Tree view: same for both layouts
-				out += Mv::to(y+1, x+1) + Theme::c("title") + Fx::b
-					+ ljust("Tree:", tree_size) + ' ';
-				out += (thread_size > 0 ? Mv::l(4) + "Threads: " : "")
-					+ ljust("User:", user_size) + ' '
-					+ rjust((mem_bytes ? "MemB" : "Mem%"), 5) + ' '
-					+ (io_size > 0 ? rjust("IO", io_size) + ' ' : "")
-					+ (io_read_size > 0 ? rjust("IO/R", io_read_size) + ' ' + rjust("IO/W", io_write_size) + ' ' : "")
-					+ rjust("Cpu%", (show_graphs ? 10 : 5))
-					+ (show_gpu ? " " + rjust("Gpu%", gpu_size) : "") + Fx::ub;
+				append(out, Mv::to(y+1, x+1), Theme::c("title"), Fx::b,
+					ljust("Tree:", tree_size), ' ');
+				append(out, (thread_size > 0 ? Mv::l(4) + "Threads: " : ""),
+					ljust("User:", user_size), ' ',
+					rjust((mem_bytes ? "MemB" : "Mem%"), 5), ' ',
+					(io_size > 0 ? rjust("IO", io_size) + ' ' : ""),
+					(io_read_size > 0 ? rjust("IO/R", io_read_size) + ' ' + rjust("IO/W", io_write_size) + ' ' : ""),
+					rjust("Cpu%", (show_graphs ? 10 : 5)),
+					(show_gpu ? " " + rjust("Gpu%", gpu_size) : ""), Fx::ub);
 			}
 		}
 		//* End of redraw block
@@ -4191,8 +4169,8 @@ namespace Proc {
 			deque<long long> scaled_cpu_update;
 			for (const auto& val : detailed.cpu_percent)
 				scaled_cpu_update.push_back(scale_to_12_update(static_cast<double>(val)));
-			out += Mv::to(d_y + 1, dgraph_x + 1) + Fx::ub + detailed_cpu_graph(scaled_cpu_update, (redraw or data_same or not alive))
-				+ Mv::to(d_y + 1, dgraph_x + 1) + Theme::c("title") + Fx::b + "CPU " + rjust(cpu_str, 4) + "%";
+			append(out, Mv::to(d_y + 1, dgraph_x + 1), Fx::ub, detailed_cpu_graph(scaled_cpu_update, (redraw or data_same or not alive)),
+				Mv::to(d_y + 1, dgraph_x + 1), Theme::c("title"), Fx::b, "CPU ", rjust(cpu_str, 4), "%");
 
 			//? GPU Graph part of box (rows 5-7)
 			string gpu_str = (alive or pause_proc_list ? fmt::format("{:.1f}", detailed.entry.gpu_p) : "");
@@ -4203,14 +4181,14 @@ namespace Proc {
 			deque<long long> scaled_gpu_update;
 			for (const auto& val : detailed.gpu_percent)
 				scaled_gpu_update.push_back(scale_to_12_update(static_cast<double>(val)));
-			out += Mv::to(d_y + 5, dgraph_x + 1) + Fx::ub + detailed_gpu_graph(scaled_gpu_update, (redraw or data_same or not alive))
-				+ Mv::to(d_y + 5, dgraph_x + 1) + Theme::c("title") + Fx::b + "GPU " + rjust(gpu_str, 4) + "%";
+			append(out, Mv::to(d_y + 5, dgraph_x + 1), Fx::ub, detailed_gpu_graph(scaled_gpu_update, (redraw or data_same or not alive)),
+				Mv::to(d_y + 5, dgraph_x + 1), Theme::c("title"), Fx::b, "GPU ", rjust(gpu_str, 4), "%");
 
 			//? Info part of box
 			const string stat_color = (not alive ? Theme::c("inactive_fg") : (detailed.status == "Running" ? Theme::c("proc_misc") : Theme::c("main_fg")));
-			out += Mv::to(d_y + 2, d_x + 1) + stat_color + Fx::ub
-									+ cjust(detailed.status, item_width) + Theme::c("main_fg")
-									+ cjust(detailed.elapsed, item_width);
+			append(out, Mv::to(d_y + 2, d_x + 1), stat_color, Fx::ub,
+									cjust(detailed.status, item_width), Theme::c("main_fg"),
+									cjust(detailed.elapsed, item_width));
 			if (item_fit >= 3) out += cjust(detailed.io_read, item_width);
 			if (item_fit >= 4) out += cjust(detailed.io_write, item_width);
 			if (item_fit >= 5) out += cjust(detailed.parent, item_width, true);
@@ -4223,10 +4201,10 @@ namespace Proc {
 			string mem_str = fmt::format("{:.2f}", mem_p);
 			mem_str.resize(4);
 			if (mem_str.ends_with('.')) mem_str.pop_back();
-			out += Mv::to(d_y + 4, d_x + 1) + Theme::c("title") + Fx::b + rjust((item_fit > 4 ? "Memory: " : "M:") + rjust(mem_str, 4) + "% ", max(1, (d_width / 3) - 2))
-				+ Theme::c("inactive_fg") + Fx::ub + graph_bg * max(1, d_width / 3) + Mv::l(max(1, d_width / 3))
-				+ Theme::c("proc_misc") + detailed_mem_graph(detailed.mem_bytes, (redraw or data_same or not alive)) + ' '
-				+ Theme::c("title") + Fx::b + detailed.memory;
+			append(out, Mv::to(d_y + 4, d_x + 1), Theme::c("title"), Fx::b, rjust((item_fit > 4 ? "Memory: " : "M:") + rjust(mem_str, 4) + "% ", max(1, (d_width / 3) - 2)),
+				Theme::c("inactive_fg"), Fx::ub, graph_bg * max(1, d_width / 3), Mv::l(max(1, d_width / 3)),
+				Theme::c("proc_misc"), detailed_mem_graph(detailed.mem_bytes, (redraw or data_same or not alive)), ' ',
+				Theme::c("title"), Fx::b, detailed.memory);
 
 			//? Tag control: "Tag [●] ██" after memory value - only shown when process is followed
 			if (followed_pid == Config::getI("detailed_pid")) {
@@ -4239,14 +4217,14 @@ namespace Proc {
 				int tag_y = d_y + 4;
 				
 				out += Mv::to(tag_y, tag_x);
-				out += Theme::c("main_fg") + "Tag ";
+				append(out, Theme::c("main_fg"), "Tag ");
 				
 				//? Checkbox with dot indicator
-				out += Theme::c("hi_fg") + "[" + (is_tagged ? "●" : " ") + "]";
+				append(out, Theme::c("hi_fg"), "[", (is_tagged ? "●" : " "), "]");
 				Input::mouse_mappings["proc_tag_toggle"] = {tag_y, tag_x + 4, 1, 3};
 				
 				//? Color swatch
-				out += " " + Theme::c_safe(tag_color_name) + "██";
+				append(out, " ", Theme::c_safe(tag_color_name), "██");
 				Input::mouse_mappings["proc_tag_color"] = {tag_y, tag_x + 8, 1, 2};
 				out += Fx::reset;
 			}
@@ -4271,6 +4249,16 @@ namespace Proc {
 		//? Read column visibility config settings for rendering loop
 		const bool render_show_memory = Config::getB("proc_show_memory");
 		const bool render_show_cpu = Config::getB("proc_show_cpu");
+		const bool tag_line_mode = Config::getS("proc_tag_mode") == "line";
+		const uint64_t process_configs_version = Config::process_configs_version();
+
+		//? Everything a row depends on besides the process and its position
+		const uint64_t row_layout = row_digest(x, y, width, prog_size, cmd_size, tree_size, thread_size, user_size, io_size, state_size,
+			nice_size, priority_size, io_read_size, io_write_size, ports_size, virt_size, runtime_size, cpu_time_size, gpu_time_size,
+			bottom_layout, proc_tree, proc_colors, proc_gradient, show_graphs, show_gpu, show_gpu_graphs, render_show_memory, render_show_cpu,
+			mem_bytes, tag_line_mode, process_configs_version, select_max).value();
+		size_t rows_drawn = 0, rows_cached = 0;
+		const uint64_t rows_start = time_micros();
 
 		//* Iteration over processes
 		int lc = 0;
@@ -4315,6 +4303,70 @@ namespace Proc {
 					p_gpu_counters[p.pid] = 0;
 			}
 
+			//? Format CPU% to fit in 4 chars: "X.YZ" (0-9.99), "XX.Y" (10-99.9), " XXX" (100-999), "X.Yk" (1000+)
+			string cpu_str = fmt::format("{:.2f}", p.cpu_p);
+			if (p.cpu_p < 10) cpu_str.resize(3);           // "5.25" -> "5.2"
+			else if (p.cpu_p < 100) cpu_str.resize(4);     // "15.75" -> "15.7"
+			else if (p.cpu_p < 1000) cpu_str.resize(3);    // "105.25" -> "105"
+			else if (p.cpu_p < 10'000) cpu_str.resize(4);  // "1050.25" -> "1050"
+			else {
+				cpu_str = fmt::format("{:.1f}k", p.cpu_p / 1000);
+				if (cpu_str.size() > 4) cpu_str.resize(4);
+				if (cpu_str.ends_with('.')) cpu_str.pop_back();
+			}
+			string mem_str = (mem_bytes ? floating_humanizer(p.mem, true) : "");
+			if (not mem_bytes) {
+				double mem_p = clamp((double)p.mem * 100 / totalMem, 0.0, 100.0);
+				mem_str = mem_p < 0.01 ? "0" : fmt::format("{:.1f}", mem_p);
+				if (mem_str.size() > 3) mem_str.resize(3);
+				if (mem_str.ends_with('.')) mem_str.pop_back();
+				mem_str += '%';
+			}
+
+			// Format GPU string (Apple Silicon only)
+			string gpu_str;
+			if (show_gpu) {
+				gpu_str = fmt::format("{:.1f}", p.gpu_p);
+				if (gpu_str.size() > 4) gpu_str.resize(4);
+				if (gpu_str.ends_with('.')) gpu_str.pop_back();
+			}
+
+			//? Scale percentage to quartiles for better visibility in braille graphs
+			//? 0% = 0 pixels, 1-25% = 1 pixel, 26-50% = 2 pixels, 51-75% = 3 pixels, 76-100% = 4 pixels
+			auto scale_to_graph = [](double pct) -> long long {
+				if (pct < 0.1) return 0;
+				if (pct <= 25) return 25;
+				if (pct <= 50) return 50;
+				if (pct <= 75) return 75;
+				return 100;
+			};
+
+			//? The row is reused as long as the values it shows are the same, only its graphs are drawn every time
+			const bool cpu_graph = not (bottom_layout and not proc_tree) and render_show_cpu and p_graphs.contains(p.pid);
+			const bool gpu_graph = not (bottom_layout and not proc_tree) and show_gpu and show_gpu_graphs and p_gpu_graphs.contains(p.pid);
+			const bool io_shown = io_size > 0 or io_read_size > 0;
+			const uint64_t digest = row_digest(row_layout, lc, is_selected, is_followed, (selected > lc) ? selected - lc : lc - selected,
+				cpu_graph, gpu_graph, p.pid, p.name, p.cmd, p.prefix, p.short_cmd, p.user, cpu_str, mem_str, gpu_str,
+				(int)round(p.cpu_p), (int)round(p.mem * 100 / totalMem), (int)round(p.gpu_p), p.threads,
+				(io_shown ? p.io_read : 0), (io_shown ? p.io_write : 0), p.state, p.p_nice, p.p_priority, p.ports,
+				(virt_size > 0 ? p.virt_mem : 0), (runtime_size > 0 ? p.runtime : 0), (cpu_time_size > 0 ? p.cpu_t : 0),
+				(gpu_time_size > 0 ? p.gpu_time : 0)).value();
+			rows_drawn++;
+			if (auto cached = p_rows.find(p.pid); cached != p_rows.end() and cached->second.digest == digest) {
+				const auto& row = cached->second;
+				out.append(row.text, 0, row.cpu_graph_at);
+				if (cpu_graph) out += p_graphs.at(p.pid)({scale_to_graph(p.cpu_p)}, data_same);
+				out.append(row.text, row.cpu_graph_at, row.gpu_graph_at - row.cpu_graph_at);
+				if (gpu_graph) out += p_gpu_graphs.at(p.pid)({scale_to_graph(p.gpu_p)}, data_same);
+				out.append(row.text, row.gpu_graph_at);
+				rows_cached++;
+				if (lc++ > height - 5) break;
+				else if (lc > height - 5 and proc_banner_shown) break;
+				continue;
+			}
+			const size_t row_begin = out.size();
+			size_t cpu_graph_at = 0, cpu_graph_len = 0, gpu_graph_at = string::npos, gpu_graph_len = 0;
+
 			out += Fx::reset;
 
 			//? Set correct gradient colors if enabled
@@ -4366,14 +4418,14 @@ namespace Proc {
 			string tag_bg_start;
 			string tag_bg_end;
 			string display_name = p.name;  //? Default to actual process name
-			if (auto tag_cfg = Config::find_process_config(p.name, p.cmd)) {
+			if (const auto* tag_cfg = Config::find_process_config(p.pid, p.cpu_s, p.name, p.cmd)) {
 				//? Use custom display name if configured
 				if (!tag_cfg->display_name.empty()) {
 					display_name = tag_cfg->display_name;
 				}
 				if (tag_cfg->has_tagging()) {
 					string tag_color_str = Theme::c_safe(tag_cfg->tag_color);
-					if (Config::getS("proc_tag_mode") == "line" and not is_selected and not is_followed) {
+					if (tag_line_mode and not is_selected and not is_followed) {
 						//? Line mode: override ALL line colors with tag color (skip for selected/followed rows)
 						g_color = c_color = m_color = t_color = gp_color = tag_color_str;
 						end = Theme::c("main_fg") + Fx::ub;
@@ -4392,67 +4444,39 @@ namespace Proc {
 			if (not proc_tree) {
 				if (bottom_layout) {
 					//? Bottom layout: Pid | Program | User | S | Ni | Thr | ...data... | Command
-					out += Mv::to(y+2+lc, x+1) + tag_bg_start
-						+ g_color + rjust(to_string(p.pid), 8) + "  "
-						+ c_color + ljust(display_name, prog_size, true, true) + "  " + end;  //? wide=true for proper Unicode display width
+					append(out, Mv::to(y+2+lc, x+1), tag_bg_start,
+						g_color, rjust(to_string(p.pid), 8), "  ",
+						c_color, ljust(display_name, prog_size, true, true), "  ", end);  //? wide=true for proper Unicode display width
 					//? Rest of bottom layout columns handled in common section below
 				}
 				else {
 					//? Side layout: original Pid | Program | Command order
-					out += Mv::to(y+2+lc, x+1) + tag_bg_start
-						+ g_color + rjust(to_string(p.pid), 8) + ' '
-						+ c_color + ljust(display_name, prog_size, true, true) + ' ' + end  //? wide=true for proper Unicode display width
-						+ (cmd_size > 0 ? g_color + ljust(san_cmd, cmd_size, true, p_wide_cmd[p.pid]) + Mv::to(y+2+lc, x+11+prog_size+cmd_size) + ' ' : "");
+					append(out, Mv::to(y+2+lc, x+1), tag_bg_start,
+						g_color, rjust(to_string(p.pid), 8), ' ',
+						c_color, ljust(display_name, prog_size, true, true), ' ', end,  //? wide=true for proper Unicode display width
+						(cmd_size > 0 ? g_color + ljust(san_cmd, cmd_size, true, p_wide_cmd[p.pid]) + Mv::to(y+2+lc, x+11+prog_size+cmd_size) + ' ' : ""));
 				}
 			}
 			//? Tree view line
 			else {
 				const string prefix_pid = p.prefix + to_string(p.pid);
 				int width_left = tree_size;
-				out += Mv::to(y+2+lc, x+1) + tag_bg_start + g_color + uresize(prefix_pid, width_left) + ' ';
+				append(out, Mv::to(y+2+lc, x+1), tag_bg_start, g_color, uresize(prefix_pid, width_left), ' ');
 				width_left -= ulen(prefix_pid);
 				if (width_left > 0) {
-					out += c_color + uresize(display_name, width_left - 1) + end + ' ';
+					append(out, c_color, uresize(display_name, width_left - 1), end, ' ');
 					width_left -= (ulen(display_name) + 1);
 				}
 				if (width_left > 7) {
 					const string_view cmd = width_left > 40 ? rtrim(san_cmd) : p.short_cmd;
 					if (not cmd.empty() and cmd != p.name) {
-						out += g_color + '(' + uresize(string{cmd}, width_left - 3, p_wide_cmd[p.pid]) + ") ";
+						append(out, g_color, '(', uresize(string{cmd}, width_left - 3, p_wide_cmd[p.pid]), ") ");
 						width_left -= (ulen(string{cmd}, true) + 3);
 					}
 				}
-				out += string(max(0, width_left), ' ') + Mv::to(y+2+lc, x+2+tree_size);
+				append(out, string(max(0, width_left), ' '), Mv::to(y+2+lc, x+2+tree_size));
 			}
 			//? Common end of line
-			//? Format CPU% to fit in 4 chars: "X.YZ" (0-9.99), "XX.Y" (10-99.9), " XXX" (100-999), "X.Yk" (1000+)
-			string cpu_str = fmt::format("{:.2f}", p.cpu_p);
-			if (p.cpu_p < 10) cpu_str.resize(3);           // "5.25" -> "5.2"
-			else if (p.cpu_p < 100) cpu_str.resize(4);     // "15.75" -> "15.7"
-			else if (p.cpu_p < 1000) cpu_str.resize(3);    // "105.25" -> "105"
-			else if (p.cpu_p < 10'000) cpu_str.resize(4);  // "1050.25" -> "1050"
-			else {
-				cpu_str = fmt::format("{:.1f}k", p.cpu_p / 1000);
-				if (cpu_str.size() > 4) cpu_str.resize(4);
-				if (cpu_str.ends_with('.')) cpu_str.pop_back();
-			}
-			string mem_str = (mem_bytes ? floating_humanizer(p.mem, true) : "");
-			if (not mem_bytes) {
-				double mem_p = clamp((double)p.mem * 100 / totalMem, 0.0, 100.0);
-				mem_str = mem_p < 0.01 ? "0" : fmt::format("{:.1f}", mem_p);
-				if (mem_str.size() > 3) mem_str.resize(3);
-				if (mem_str.ends_with('.')) mem_str.pop_back();
-				mem_str += '%';
-			}
-
-			// Format GPU string (Apple Silicon only)
-			string gpu_str;
-			if (show_gpu) {
-				gpu_str = fmt::format("{:.1f}", p.gpu_p);
-				if (gpu_str.size() > 4) gpu_str.resize(4);
-				if (gpu_str.ends_with('.')) gpu_str.pop_back();
-			}
-
 			// Format combined I/O operation count string (with K/M/G suffix for large values)
 			string io_str;
 			if (io_size > 0) {
@@ -4584,16 +4608,6 @@ namespace Proc {
 				}
 			}
 
-			//? Scale percentage to quartiles for better visibility in braille graphs
-			//? 0% = 0 pixels, 1-25% = 1 pixel, 26-50% = 2 pixels, 51-75% = 3 pixels, 76-100% = 4 pixels
-			auto scale_to_graph = [](double pct) -> long long {
-				if (pct < 0.1) return 0;
-				if (pct <= 25) return 25;
-				if (pct <= 50) return 50;
-				if (pct <= 75) return 75;
-				return 100;
-			};
-
 			if (bottom_layout and not proc_tree) {
 				//? Bottom layout: no braille graphs, use heat colors for CPU%/GPU%
 				//? Use Theme gradient (green at 0% -> red at 100%) like other CPU displays
@@ -4602,41 +4616,68 @@ namespace Proc {
 				//? Columns only shown if config enabled and size > 0
 				string cpu_heat = Theme::g("cpu").at(clamp((long long)p.cpu_p, 0ll, 100ll));
 				string gpu_heat = Theme::g("cpu").at(clamp((long long)p.gpu_p, 0ll, 100ll));
-				out += (user_size > 0 ? g_color + ljust((cmp_greater(p.user.size(), user_size) ? p.user.substr(0, user_size - 1) + '+' : p.user), user_size) + "  " : "")
-					+ (state_size > 0 ? rjust(state_str, state_size) + "  " : "")
-					+ (priority_size > 0 ? rjust(to_string(p.p_priority), priority_size) + "  " : "")
-					+ (nice_size > 0 ? rjust(nice_str, nice_size) + "  " : "")
-					+ (thread_size > 0 ? t_color + rjust(proc_threads_string, thread_size) + "  " + end : "")
-					+ (ports_size > 0 ? g_color + rjust(ports_str, ports_size) + "  " + end : "")
-					+ (io_read_size > 0 ? g_color + rjust(io_read_str, io_read_size) + "  " + rjust(io_write_str, io_write_size) + "  " + end : "")
-					+ (render_show_memory ? m_color + rjust(mem_str, 5) + "  " + end : "")
-					+ (virt_size > 0 ? g_color + rjust(virt_str, virt_size) + "  " + end : "")
-					+ (cpu_time_size > 0 ? g_color + rjust(cpu_time_str, cpu_time_size) + "  " + end : "")
-					+ (gpu_time_size > 0 ? gp_color + rjust(gpu_time_str, gpu_time_size) + "  " + end : "")
-					+ (runtime_size > 0 ? g_color + rjust(runtime_str, runtime_size) + "  " + end : "")
-					+ (render_show_cpu ? cpu_heat + rjust(cpu_str, 5) + "  " + end : "")
-					+ (show_gpu ? gpu_heat + rjust(gpu_str, 5) + "  " + end : "")
-					+ (cmd_size > 0 ? g_color + ljust(san_cmd, cmd_size, true, p_wide_cmd[p.pid]) : "")
-					+ tag_bg_end + end;  //? Don't use clear_eol - it wipes Logs panel when shown beside Proc
+				append(out, (user_size > 0 ? g_color + ljust((cmp_greater(p.user.size(), user_size) ? p.user.substr(0, user_size - 1) + '+' : p.user.str()), user_size) + "  " : ""),
+					(state_size > 0 ? rjust(state_str, state_size) + "  " : ""),
+					(priority_size > 0 ? rjust(to_string(p.p_priority), priority_size) + "  " : ""),
+					(nice_size > 0 ? rjust(nice_str, nice_size) + "  " : ""),
+					(thread_size > 0 ? t_color + rjust(proc_threads_string, thread_size) + "  " + end : ""),
+					(ports_size > 0 ? g_color + rjust(ports_str, ports_size) + "  " + end : ""),
+					(io_read_size > 0 ? g_color + rjust(io_read_str, io_read_size) + "  " + rjust(io_write_str, io_write_size) + "  " + end : ""),
+					(render_show_memory ? m_color + rjust(mem_str, 5) + "  " + end : ""),
+					(virt_size > 0 ? g_color + rjust(virt_str, virt_size) + "  " + end : ""),
+					(cpu_time_size > 0 ? g_color + rjust(cpu_time_str, cpu_time_size) + "  " + end : ""),
+					(gpu_time_size > 0 ? gp_color + rjust(gpu_time_str, gpu_time_size) + "  " + end : ""),
+					(runtime_size > 0 ? g_color + rjust(runtime_str, runtime_size) + "  " + end : ""),
+					(render_show_cpu ? cpu_heat + rjust(cpu_str, 5) + "  " + end : ""),
+					(show_gpu ? gpu_heat + rjust(gpu_str, 5) + "  " + end : ""),
+					(cmd_size > 0 ? g_color + ljust(san_cmd, cmd_size, true, p_wide_cmd[p.pid]) : ""),
+					tag_bg_end, end);  //? Don't use clear_eol - it wipes Logs panel when shown beside Proc
 			}
 			else {
 				//? Side layout or tree view: original column order
 				//? Columns only shown if config enabled and size > 0
-				out += (thread_size > 0 ? t_color + rjust(proc_threads_string, thread_size) + ' ' + end : "" )
-					+ (user_size > 0 ? g_color + ljust((cmp_greater(p.user.size(), user_size) ? p.user.substr(0, user_size - 1) + '+' : p.user), user_size) + ' ' : "")
-					+ (render_show_memory ? m_color + rjust(mem_str, 5) + end + ' ' : "")
-					+ (io_size > 0 ? g_color + rjust(io_str, io_size) + ' ' + end : "")
-					+ (render_show_cpu ? (is_selected or is_followed ? "" : Theme::c("inactive_fg")) + (show_graphs ? graph_bg * 5: "")
-						+ (p_graphs.contains(p.pid) ? Mv::l(5) + c_color + p_graphs.at(p.pid)({scale_to_graph(p.cpu_p)}, data_same) : "") + end + ' '
-						+ c_color + rjust(cpu_str, 4) : "")
-					+ (show_gpu ? " " + (is_selected or is_followed ? "" : Theme::c("inactive_fg")) + (show_gpu_graphs ? graph_bg * 5 : "")
-						+ (show_gpu_graphs and p_gpu_graphs.contains(p.pid) ? Mv::l(5) + gp_color + p_gpu_graphs.at(p.pid)({scale_to_graph(p.gpu_p)}, data_same) : "") + end + ' '
-						+ gp_color + rjust(gpu_str, 4) : "")
-					+ "  " + tag_bg_end + end;  //? Don't use clear_eol - it wipes Logs panel when shown beside Proc
+				append(out, (thread_size > 0 ? t_color + rjust(proc_threads_string, thread_size) + ' ' + end : "" ),
+					(user_size > 0 ? g_color + ljust((cmp_greater(p.user.size(), user_size) ? p.user.substr(0, user_size - 1) + '+' : p.user.str()), user_size) + ' ' : ""),
+					(render_show_memory ? m_color + rjust(mem_str, 5) + end + ' ' : ""),
+					(io_size > 0 ? g_color + rjust(io_str, io_size) + ' ' + end : ""));
+				if (render_show_cpu) {
+					append(out, (is_selected or is_followed ? "" : Theme::c("inactive_fg")), (show_graphs ? graph_bg * 5: ""));
+					if (cpu_graph) {
+						append(out, Mv::l(5), c_color);
+						cpu_graph_at = out.size() - row_begin;
+						out += p_graphs.at(p.pid)({scale_to_graph(p.cpu_p)}, data_same);
+						cpu_graph_len = out.size() - row_begin - cpu_graph_at;
+					}
+					append(out, end, ' ', c_color, rjust(cpu_str, 4));
+				}
+				if (show_gpu) {
+					append(out, " ", (is_selected or is_followed ? "" : Theme::c("inactive_fg")), (show_gpu_graphs ? graph_bg * 5 : ""));
+					if (gpu_graph) {
+						append(out, Mv::l(5), gp_color);
+						gpu_graph_at = out.size() - row_begin;
+						out += p_gpu_graphs.at(p.pid)({scale_to_graph(p.gpu_p)}, data_same);
+						gpu_graph_len = out.size() - row_begin - gpu_graph_at;
+					}
+					append(out, end, ' ', gp_color, rjust(gpu_str, 4));
+				}
+				append(out, "  ", tag_bg_end, end);  //? Don't use clear_eol - it wipes Logs panel when shown beside Proc
 			}
+
+			//? Keep the row with its graphs cut out
+			auto& row = p_rows[p.pid];
+			row.digest = digest;
+			row.text.assign(out, row_begin);
+			if (gpu_graph_len > 0) row.text.erase(gpu_graph_at, gpu_graph_len);
+			if (cpu_graph_len > 0) row.text.erase(cpu_graph_at, cpu_graph_len);
+			row.cpu_graph_at = cpu_graph_at;
+			row.gpu_graph_at = min(gpu_graph_at - cpu_graph_len, row.text.size());
 			if (lc++ > height - 5) break;
 			else if (lc > height - 5 and proc_banner_shown) break;
 		}
+		if (Global::debug) {
+			Runner::debug_stat("proc rows", fmt::format("{} μs", time_micros() - rows_start));
+			Runner::debug_stat("proc cached", fmt::format("{}/{} {}%", rows_cached, rows_drawn, rows_cached * 100 / max<size_t>(rows_drawn, 1)));
+		}
 
 		out += Fx::reset;
 		while (lc++ < height - 3) out += Mv::to(y+lc+1, x+1) + string(width - 2, ' ');
@@ -4656,19 +4697,26 @@ namespace Proc {
 		//? Draw scrollbar if needed
 		if (numpids > select_max) {
 			scroll_pos = clamp((int)round((double)start * select_max / (numpids - select_max)), 0, height - 5);
-			out += Mv::to(y + 1, x + width - 2) + Fx::b + Theme::c("main_fg") + Symbols::up
-				+ Mv::to(y + height - 2, x + width - 2) + Symbols::down;
+			append(out, Mv::to(y + 1, x + width - 2), Fx::b, Theme::c("main_fg"), Symbols::up,
+				Mv::to(y + height - 2, x + width - 2), Symbols::down);
 
 			for (int i = y + 2; i < y + height - 2; i++) {
-				out += Mv::to(i, x + width - 2) + ((i == y + 2 + scroll_pos) ? "█" : " ");
+				append(out, Mv::to(i, x + width - 2), ((i == y + 2 + scroll_pos) ? "█" : " "));
 			}
 		}
 
 		//? Current selection and number of processes
 		string location = to_string(start + (follow_process ? followed : selected)) + '/' + to_string(numpids);
-		string loc_clear = Symbols::h_line * max((size_t)0, 9 - location.size());
-		out += Mv::to(y + height - 1, x+width - 3 - max(9, (int)location.size())) + Fx::ub + Theme::c("proc_box") + loc_clear
-			+ Symbols::title_left_down + Theme::c("title") + Fx::b + location + Fx::ub + Theme::c("proc_box") + Symbols::title_right_down;
+		//? Processes that came and went between updates, only known when tracking process events
+		if (const uint64_t short_lived = Proc::short_lived; short_lived > 0 and width >= 60)
+			location = to_string(short_lived) + " short-lived " + location;
+		//? Keep clearing the widest text drawn since the last full redraw of the box
+		static size_t loc_width{};
+		if (redraw) loc_width = 9;
+		loc_width = max(loc_width, location.size());
+		string loc_clear = Symbols::h_line * (loc_width - location.size());
+		append(out, Mv::to(y + height - 1, x+width - 3 - (int)loc_width), Fx::ub, Theme::c("proc_box"), loc_clear,
+			Symbols::title_left_down, Theme::c("title"), Fx::b, location, Fx::ub, Theme::c("proc_box"), Symbols::title_right_down);
 
 		//? Clear out left over graphs from dead processes at a regular interval
 		if (not data_same and ++counter >= 100) {
@@ -4701,6 +4749,10 @@ namespace Proc {
 			std::erase_if(p_wide_cmd, [&live_pids](const auto& pair) {
 				return not live_pids.contains(pair.first);
 			});
+
+			std::erase_if(p_rows, [&live_pids](const auto& pair) {
+				return not live_pids.contains(pair.first);
+			});
 		}
 
 		//? Draw hide button if detailed view is shown
@@ -4732,7 +4784,7 @@ namespace Proc {
 		}
 
 		redraw = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 
 }
@@ -5033,8 +5085,8 @@ namespace Logs {
 		int color_y = modal_y + 1;
 		out += Mv::to(color_y, modal_x + 2);
 		for (size_t i = 0; i < 6; i++) {
-			string color = theme(TagColors::themes[i]);
-			out += color + "██" + Fx::reset + " ";
+			string color = Theme::c_safe(TagColors::themes[i]);
+			append(out, color, "██", Fx::reset, " ");
 			Input::mouse_mappings["color_" + to_string(i)] = {color_y, modal_x + 2 + static_cast<int>(i) * 3, 1, 2};
 		}
 
@@ -5356,14 +5408,14 @@ namespace Logs {
 
 		//? Process info (read-only)
 		out += Mv::to(row_y, pad_x);
-		out += theme("inactive_fg") + "Process: " + theme("main_fg") + config_modal_name;
+		append(out, theme("inactive_fg"), "Process: ", theme("main_fg"), config_modal_name);
 		row_y++;
 
 		//? Command field (editable, supports wildcards like *)
 		int cmd_row = row_y;
 		out += Mv::to(row_y, pad_x);
 		bool field_sel = (config_modal_field == 0);
-		out += theme("main_fg") + "Command: ";
+		append(out, theme("main_fg"), "Command: ");
 		if (field_sel) out += theme("selected_bg") + theme("selected_fg");
 		//? Build command text with cursor
 		string cmd_text;
@@ -5378,20 +5430,20 @@ namespace Logs {
 				cmd_text = config_modal_cmdline + string(max(0, 35 - static_cast<int>(config_modal_cmdline.length())), ' ');
 			}
 		}
-		out += "[" + cmd_text.substr(0, 36) + "]";
+		append(out, "[", cmd_text.substr(0, 36), "]");
 		out += Fx::reset;
 		Input::mouse_mappings["config_field_0"] = {cmd_row, pad_x + 9, 1, 37};
 		row_y++;
 		//? Hint below command field
 		out += Mv::to(row_y, pad_x + 9);
-		out += theme("inactive_fg") + "(use * for wildcard)";
+		append(out, theme("inactive_fg"), "(use * for wildcard)");
 		row_y += 2;
 
 		//? Display Name field
 		int display_row = row_y;
 		out += Mv::to(row_y, pad_x);
 		field_sel = (config_modal_field == 1);
-		out += theme("main_fg") + "Display: ";
+		append(out, theme("main_fg"), "Display: ");
 		if (field_sel) out += theme("selected_bg") + theme("selected_fg");
 		//? Build display text with cursor
 		string disp_text;
@@ -5407,7 +5459,7 @@ namespace Logs {
 				disp_text = config_modal_display + string(max(0, 25 - static_cast<int>(config_modal_display.length())), ' ');
 			}
 		}
-		out += "[" + disp_text.substr(0, 26) + "]";
+		append(out, "[", disp_text.substr(0, 26), "]");
 		out += Fx::reset;
 		Input::mouse_mappings["config_field_1"] = {display_row, pad_x + 9, 1, 27};
 		row_y++;
@@ -5416,7 +5468,7 @@ namespace Logs {
 		int logpath_row = row_y;
 		out += Mv::to(row_y, pad_x);
 		field_sel = (config_modal_field == 2);
-		out += theme("main_fg") + "LogPath: ";
+		append(out, theme("main_fg"), "LogPath: ");
 		if (field_sel) out += theme("selected_bg") + theme("selected_fg");
 		//? Build path text with cursor
 		string path_text;
@@ -5432,7 +5484,7 @@ namespace Logs {
 				path_text = config_modal_path + string(max(0, 35 - static_cast<int>(config_modal_path.length())), ' ');
 			}
 		}
-		out += "[" + path_text.substr(0, 36) + "]";
+		append(out, "[", path_text.substr(0, 36), "]");
 		out += Fx::reset;
 		Input::mouse_mappings["config_field_2"] = {logpath_row, pad_x + 9, 1, 37};
 		row_y += 2;
@@ -5441,10 +5493,10 @@ namespace Logs {
 		int tagged_row = row_y;
 		out += Mv::to(row_y, pad_x);
 		field_sel = (config_modal_field == 3);
-		out += theme("main_fg") + "Tagged:  ";
+		append(out, theme("main_fg"), "Tagged:  ");
 		if (field_sel) out += theme("selected_bg") + theme("selected_fg");
-		out += "[" + string(config_modal_tagged ? "x" : " ") + "]";
-		out += Fx::reset + theme("inactive_fg") + " (highlight in list)";
+		append(out, "[", string(config_modal_tagged ? "x" : " "), "]");
+		append(out, Fx::reset, theme("inactive_fg"), " (highlight in list)");
 		Input::mouse_mappings["config_field_3"] = {tagged_row, pad_x + 9, 1, 3};
 		row_y += 2;
 
@@ -5452,9 +5504,9 @@ namespace Logs {
 		int color_row = row_y;
 		out += Mv::to(row_y, pad_x);
 		field_sel = (config_modal_field == 4);
-		out += theme("main_fg") + "Color:   ";
+		append(out, theme("main_fg"), "Color:   ");
 		if (!config_modal_tagged) {
-			out += theme("inactive_fg") + "(enable Tagged first)";
+			append(out, theme("inactive_fg"), "(enable Tagged first)");
 			//? Clear color mappings when disabled
 			for (int i = 0; i < 6; i++) {
 				Input::mouse_mappings.erase("config_color_" + to_string(i));
@@ -5463,11 +5515,11 @@ namespace Logs {
 			for (size_t i = 0; i < 6; i++) {
 				bool color_sel = field_sel && (static_cast<int>(i) == config_modal_color_idx);
 				if (color_sel) out += theme("selected_bg");
-				out += theme(TagColors::themes[i]) + "██" + Fx::reset + " ";
+				append(out, Theme::c_safe(TagColors::themes[i]), "██", Fx::reset, " ");
 				//? Mouse mapping for each color: 2 chars wide + 1 space
 				Input::mouse_mappings["config_color_" + to_string(i)] = {color_row, pad_x + 9 + static_cast<int>(i) * 3, 1, 2};
 			}
-			out += theme("inactive_fg") + "(1-6)";
+			append(out, theme("inactive_fg"), "(1-6)");
 		}
 		row_y++;
 
@@ -5475,7 +5527,7 @@ namespace Logs {
 		if (config_modal_tagged) {
 			//? Each color is "██ " (2 chars + space = 3 total), center triangle under the 2-char block
 			out += Mv::to(row_y, pad_x + 10 + config_modal_color_idx * 3);
-			out += theme("hi_fg") + "▲";
+			append(out, theme("hi_fg"), "▲");
 		}
 		row_y += 2;
 
@@ -5487,11 +5539,11 @@ namespace Logs {
 		for (size_t i = 0; i < 3; i++) {
 			bool btn_sel = (config_modal_field == 5 && config_modal_button == static_cast<int>(i));
 			if (btn_sel) {
-				out += theme("selected_bg") + theme("selected_fg") + Fx::b;
+				append(out, theme("selected_bg"), theme("selected_fg"), Fx::b);
 			} else {
 				out += theme("main_fg");
 			}
-			out += "[" + buttons[i] + "]" + Fx::reset + "  ";
+			append(out, "[", buttons[i], "]", Fx::reset, "  ");
 			//? Mouse mapping for button: [text] + 2 spaces
 			int btn_width = static_cast<int>(buttons[i].length()) + 2;  // brackets
 			Input::mouse_mappings["config_btn_" + to_string(i)] = {btn_row, btn_x, 1, btn_width};
@@ -5500,20 +5552,19 @@ namespace Logs {
 
 		//? Instructions
 		out += Mv::to(modal_y + modal_h - 2, pad_x);
-		out += theme("inactive_fg") + "Tab:Next  Enter:Select  Esc:Cancel  Click:Select";
+		append(out, theme("inactive_fg"), "Tab:Next  Enter:Select  Esc:Cancel  Click:Select");
 
 		return out;
 	}
 
-	string draw(bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+	void draw(string& out, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 		//? Skip drawing if dimensions are invalid (panel not yet sized)
-		if (width < min_width || height < min_height) return "";
+		if (width < min_width || height < min_height) return;
 		if (force_redraw) redraw = true;
 		if (not data_same) redraw = true;
 
 		if (redraw) {
-			string out;
 			const auto& theme = Theme::c;
 
 			//? Track previous position to clear old status line when layout changes
@@ -5528,7 +5579,7 @@ namespace Logs {
 				int new_status_y = y + height - 1;
 				if (old_status_y != new_status_y && old_status_y > 0 && old_status_y <= Term::height) {
 					//? Clear the old status line row
-					out += Mv::to(old_status_y, prev_x + 1) + string(static_cast<size_t>(prev_width - 2), ' ');
+					append(out, Mv::to(old_status_y, prev_x + 1), string(static_cast<size_t>(prev_width - 2), ' '));
 				}
 			}
 			prev_x = x;
@@ -5570,7 +5621,7 @@ namespace Logs {
 
 			//? Helper lambda to clear a row
 			auto clear_row = [&](int row) {
-				out += Mv::to(row, x + 1) + string(static_cast<size_t>(content_width), ' ');
+				append(out, Mv::to(row, x + 1), string(static_cast<size_t>(content_width), ' '));
 			};
 
 			//? Empty state: check if following a process
@@ -5584,9 +5635,10 @@ namespace Logs {
 					: "Press 'F' to follow a process, then '8' for logs";
 				int msg_x = x + (width - static_cast<int>(ulen(msg))) / 2;
 				int msg_y = y + height / 2;
-				out += Mv::to(msg_y, msg_x) + theme("inactive_fg") + msg;
+				append(out, Mv::to(msg_y, msg_x), theme("inactive_fg"), msg);
 				redraw = false;
-				return out + Fx::reset;
+				out += Fx::reset;
+				return;
 			}
 
 			//? Calculate visible range (entries already filtered at collection time)
@@ -5611,7 +5663,7 @@ namespace Logs {
 				string msg = "No logs for PID " + std::to_string(current_pid);
 				int msg_x = x + (width - static_cast<int>(ulen(msg))) / 2;
 				int msg_y = y + height / 2;
-				out += Mv::to(msg_y, msg_x) + theme("inactive_fg") + msg;
+				append(out, Mv::to(msg_y, msg_x), theme("inactive_fg"), msg);
 				//? Don't return - continue to draw status bar below
 			}
 			else {
@@ -5695,10 +5747,10 @@ namespace Logs {
 
 				if (color_full_line) {
 					//? Full line colored
-					out += Mv::to(row, x + 1) + level_color + padded_line + Fx::reset + theme("main_fg");
+					append(out, Mv::to(row, x + 1), level_color, padded_line, Fx::reset, theme("main_fg"));
 				} else {
 					//? Only marker colored: [ (white) + letter (colored) + ] (white) + space + rest (default)
-					out += Mv::to(row, x + 1) + theme("main_fg") + "[" + level_color + string(1, level_char) + theme("main_fg") + "] " + padded_line;
+					append(out, Mv::to(row, x + 1), theme("main_fg"), "[", level_color, string(1, level_char), theme("main_fg"), "] ", padded_line);
 				}
 			}
 			}  //? End of else block (entries not empty)
@@ -5731,7 +5783,7 @@ namespace Logs {
 			bool compact = (content_width < full_mode_width + 2);
 			
 			//? Clear status line before drawing (prevents ghosting on resize)
-			out += Mv::to(status_y, x + 1) + string(static_cast<size_t>(content_width), ' ');
+			append(out, Mv::to(status_y, x + 1), string(static_cast<size_t>(content_width), ' '));
 			
 			//? Build status line with colors and mouse mappings
 			out += Mv::to(status_y, cur_x);
@@ -5743,22 +5795,22 @@ namespace Logs {
 				int max_err_len = compact ? 10 : 20;
 				string err_display = export_error.length() > static_cast<size_t>(max_err_len) 
 					? export_error.substr(0, static_cast<size_t>(max_err_len - 3)) + "..." : export_error;
-				out += theme("log_fault") + Fx::b + "[ERR] " + err_display + Fx::ub + fg + " ";
+				append(out, theme("log_fault"), Fx::b, "[ERR] ", err_display, Fx::ub, fg, " ");
 				cur_x += 7 + static_cast<int>(err_display.length());
 			} else if (exporting) {
-				out += theme("log_error") + Fx::b + "[REC]" + Fx::ub + fg + " ";
+				append(out, theme("log_error"), Fx::b, "[REC]", Fx::ub, fg, " ");
 				cur_x += 6;
 			} else if (paused) {
-				out += fg + (compact ? "[P] " : "[PAUSED] ");
+				append(out, fg, (compact ? "[P] " : "[PAUSED] "));
 				cur_x += compact ? 4 : 9;
 			} else {
-				out += fg + (compact ? "[L] " : "[LIVE] ");
+				append(out, fg, (compact ? "[L] " : "[LIVE] "));
 				cur_x += compact ? 4 : 7;
 			}
 			
 			//? Filter name in color (abbreviate in compact mode)
 			string filter_display = compact ? filter_name.substr(0, 1) : filter_name;
-			out += filter_color + filter_display + fg + " ";
+			append(out, filter_color, filter_display, fg, " ");
 			cur_x += static_cast<int>(filter_display.length()) + 1;
 
 			//? Source indicator with availability dots (format: S:Sys ◉◉)
@@ -5771,13 +5823,13 @@ namespace Logs {
 				int src_start_x = cur_x;
 				if (compact) {
 					//? Compact: S:S or S:A with dots
-					out += hi + "S" + fg + ":" + (source == Source::System ? "S" : "A") + " ";
-					out += sys_dot_color + "●" + app_dot_color + (app_log_available ? "●" : "○") + fg + " ";
+					append(out, hi, "S", fg, ":", (source == Source::System ? "S" : "A"), " ");
+					append(out, sys_dot_color, "●", app_dot_color, (app_log_available ? "●" : "○"), fg, " ");
 					cur_x += 7;  //? "S:S ●○ " = 7 chars (S:S =3, space=1, ●○=2, space=1)
 				} else {
 					//? Full: S:Sys or S:App with dots
-					out += hi + "S" + fg + ":" + (source == Source::System ? "Sys" : "App") + " ";
-					out += sys_dot_color + "●" + app_dot_color + (app_log_available ? "●" : "○") + fg + " ";
+					append(out, hi, "S", fg, ":", (source == Source::System ? "Sys" : "App"), " ");
+					append(out, sys_dot_color, "●", app_dot_color, (app_log_available ? "●" : "○"), fg, " ");
 					cur_x += 9;  //? "S:Sys ●○ " = 9 chars (S:Sys=5, space=1, ●○=2, space=1)
 				}
 				//? Add mouse mapping for source toggle
@@ -5786,64 +5838,64 @@ namespace Logs {
 
 			//? Position counter (shorter format in compact)
 			string short_pos = compact ? to_string(total_entries) : pos_str;
-			out += short_pos + " ";
+			append(out, short_pos, " ");
 			cur_x += static_cast<int>(short_pos.length()) + 1;
 			
 			//? Separator and buttons
-			out += fg + "| ";
+			append(out, fg, "| ");
 			cur_x += 2;
 			
 			//? Buttons - full or compact labels
 			if (compact) {
 				//? Compact: Spc E F R B
 				int p_x = cur_x;
-				out += hi + "Spc" + fg + " ";
+				append(out, hi, "Spc", fg, " ");
 				cur_x += 4;
 				Input::mouse_mappings["logs_pause"] = {status_y, p_x, 1, 3};
 				
 				int e_x = cur_x;
-				out += hi + "E" + fg + " ";
+				append(out, hi, "E", fg, " ");
 				cur_x += 2;
 				Input::mouse_mappings["logs_export"] = {status_y, e_x, 1, 1};
 				
 				int f_x = cur_x;
-				out += hi + "F" + fg + " ";
+				append(out, hi, "F", fg, " ");
 				cur_x += 2;
 				Input::mouse_mappings["logs_filter"] = {status_y, f_x, 1, 1};
 				
 				int r_x = cur_x;
-				out += hi + "R" + fg + " ";
+				append(out, hi, "R", fg, " ");
 				cur_x += 2;
 				Input::mouse_mappings["logs_sort"] = {status_y, r_x, 1, 1};
 				
 				int b_x = cur_x;
-				out += hi + "B" + fg + ":" + to_string(max_entries);
+				append(out, hi, "B", fg, ":", to_string(max_entries));
 				cur_x += 2 + static_cast<int>(to_string(max_entries).length());
 				Input::mouse_mappings["logs_buffer"] = {status_y, b_x, 1, 2 + static_cast<int>(to_string(max_entries).length())};
 			} else {
 				//? Full: SPC:Pause E:Export F:Filter R:New B:500
 				int p_x = cur_x;
-				out += hi + "SPC" + fg + ":Pause ";
+				append(out, hi, "SPC", fg, ":Pause ");
 				cur_x += 10;
 				Input::mouse_mappings["logs_pause"] = {status_y, p_x, 1, 9};
 				
 				int e_x = cur_x;
-				out += hi + "E" + fg + ":Export ";
+				append(out, hi, "E", fg, ":Export ");
 				cur_x += 9;
 				Input::mouse_mappings["logs_export"] = {status_y, e_x, 1, 8};
 				
 				int f_x = cur_x;
-				out += hi + "F" + fg + ":Filter ";
+				append(out, hi, "F", fg, ":Filter ");
 				cur_x += 9;
 				Input::mouse_mappings["logs_filter"] = {status_y, f_x, 1, 8};
 				
 				int r_x = cur_x;
-				out += hi + "R" + fg + ":" + sort_str + " ";
+				append(out, hi, "R", fg, ":", sort_str, " ");
 				cur_x += 3 + static_cast<int>(sort_str.length());
 				Input::mouse_mappings["logs_sort"] = {status_y, r_x, 1, 2 + static_cast<int>(sort_str.length())};
 				
 				int b_x = cur_x;
-				out += hi + "B" + fg + ":" + to_string(max_entries);
+				append(out, hi, "B", fg, ":", to_string(max_entries));
 				cur_x += 2 + static_cast<int>(to_string(max_entries).length());
 				Input::mouse_mappings["logs_buffer"] = {status_y, b_x, 1, 2 + static_cast<int>(to_string(max_entries).length())};
 			}
@@ -5871,12 +5923,12 @@ namespace Logs {
 				for (int i = 0; i < 5; i++) {
 					out += Mv::to(opt_y + i, modal_x + 2);
 					if (i == filter_modal_selected) {
-						out += theme("selected_bg") + theme("selected_fg") + Fx::b;
-						out += " " + to_string(i + 1) + ". " + ljust(filters[static_cast<size_t>(i)], 10) + " ";
+						append(out, theme("selected_bg"), theme("selected_fg"), Fx::b);
+						append(out, " ", to_string(i + 1), ". ", ljust(filters[static_cast<size_t>(i)], 10), " ");
 						out += Fx::reset;
 					} else {
-						out += theme("hi_fg") + to_string(i + 1) + "." + theme("main_fg");
-						out += " " + filters[static_cast<size_t>(i)];
+						append(out, theme("hi_fg"), to_string(i + 1), ".", theme("main_fg"));
+						append(out, " ", filters[static_cast<size_t>(i)]);
 					}
 					//? Mouse mapping for each option
 					Input::mouse_mappings["filter_" + to_string(i)] = {opt_y + i, modal_x + 1, 1, modal_w - 2};
@@ -5884,7 +5936,7 @@ namespace Logs {
 				
 				//? Instructions
 				out += Mv::to(modal_y + modal_h - 2, modal_x + 2);
-				out += theme("inactive_fg") + "1-5/Enter/Esc" + Fx::reset;
+				append(out, theme("inactive_fg"), "1-5/Enter/Esc", Fx::reset);
 			}
 
 			//? Draw buffer size selection modal if active
@@ -5904,21 +5956,21 @@ namespace Logs {
 				for (int i = 0; i < 7; i++) {
 					out += Mv::to(opt_y + i, modal_x + 2);
 					if (i == buffer_modal_selected) {
-						out += theme("selected_bg") + theme("selected_fg") + Fx::b;
+						append(out, theme("selected_bg"), theme("selected_fg"), Fx::b);
 						if (i == 6) {
 							//? Custom with input field
 							string custom_display = buffer_custom_input.empty() ? "____" : buffer_custom_input + "_";
-							out += " " + to_string(i + 1) + ". Custom: " + custom_display + " ";
+							append(out, " ", to_string(i + 1), ". Custom: ", custom_display, " ");
 						} else {
-							out += " " + to_string(i + 1) + ". " + ljust(sizes[static_cast<size_t>(i)], 14) + " ";
+							append(out, " ", to_string(i + 1), ". ", ljust(sizes[static_cast<size_t>(i)], 14), " ");
 						}
 						out += Fx::reset;
 					} else {
-						out += theme("hi_fg") + to_string(i + 1) + "." + theme("main_fg");
+						append(out, theme("hi_fg"), to_string(i + 1), ".", theme("main_fg"));
 						if (i == 6) {
 							out += " Custom";
 						} else {
-							out += " " + sizes[static_cast<size_t>(i)];
+							append(out, " ", sizes[static_cast<size_t>(i)]);
 						}
 					}
 					//? Mouse mapping for each option
@@ -5927,7 +5979,7 @@ namespace Logs {
 				
 				//? Instructions
 				out += Mv::to(modal_y + modal_h - 2, modal_x + 2);
-				out += theme("inactive_fg") + "1-7/Enter/Esc" + Fx::reset;
+				append(out, theme("inactive_fg"), "1-7/Enter/Esc", Fx::reset);
 			}
 
 			//? Draw error modal if active
@@ -5962,28 +6014,28 @@ namespace Logs {
 				int line_y = modal_y + 2;
 				for (const auto& l : lines) {
 					out += Mv::to(line_y++, modal_x + 3);
-					out += theme("main_fg") + l;
+					append(out, theme("main_fg"), l);
 				}
 				
 				//? Instructions
 				out += Mv::to(modal_y + modal_h - 2, modal_x + (modal_w - 18) / 2);
-				out += theme("inactive_fg") + "Press any key..." + Fx::reset;
+				append(out, theme("inactive_fg"), "Press any key...", Fx::reset);
 			}
 
 			//? Note: Color picker and config modals are now drawn in Proc::draw()
 			//? since they use Proc panel coordinates and should work even when Logs is hidden
 
 			redraw = false;
-			return out + Fx::reset;
+			out += Fx::reset;
+			return;
 		}
-		return "";
 	}
 }
 
 namespace Draw {
 	void calcSizes() {
 		atomic_wait(Runner::active);
-		Config::unlock();
+		Config::merge();
 		auto boxes = Config::getS("shown_boxes");
 		auto cpu_bottom = Config::getB("cpu_bottom");
 		[[maybe_unused]] auto gpu_bottom = Config::getB("gpu_bottom");
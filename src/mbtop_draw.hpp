@@ -19,12 +19,15 @@ tab-size = 4
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <deque>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
 
+#include "mbtop_theme.hpp"
+
 using std::array;
 using std::deque;
 using std::string;
@@ -57,6 +60,9 @@ namespace Symbols {
 	const string left = "←";
 	const string right = "→";
 	const string enter = "↵";
+
+	//* Glyphs for Draw::Graph indexed by previous * 5 + current value (0-4), keyed by "<symbol>_up" and "<symbol>_down"
+	extern const std::unordered_map<string, vector<string>> graph_symbols;
 }
 
 namespace Draw {
@@ -94,12 +100,12 @@ namespace Draw {
 	//* Class holding a percentage meter
 	class Meter {
 		int width;
-		string color_gradient;
+		Theme::gradient_key gradient;
 		bool invert;
 		array<string, 101> cache;
 	public:
 		Meter();
-		Meter(const int width, string color_gradient, bool invert = false);
+		Meter(const int width, const string& color_gradient, bool invert = false);
 
 		//* Return a string representation of the meter with given value
 		string operator()(int value);
@@ -107,15 +113,56 @@ namespace Draw {
 
 	//* Class holding a percentage graph
 	class Graph {
-		int width, height;
+		int width{}, height{};
 		string color_gradient;
+		Theme::gradient_key gradient;
 		string out, symbol = "default";
 		bool invert, no_zero;
 		int direction = 0;  //? 0=RTL, 1=LTR, 2=TTB, 3=BTT
 		long long offset;
 		long long last = 0, max_value = 0;
 		bool current = true, tty_mode = false;
-		std::unordered_map<bool, vector<string>> graphs = { {true, {}}, {false, {}}};
+
+		//* Bytes of one graph row, the columns on screen are the window [begin, end) of <buf>
+		struct Row {
+			string buf;
+			size_t begin{}, end{};
+		};
+
+		//* Fixed width circular buffer of columns with the oldest column at <head>
+		//* <lens> holds the byte length of each cell (row major, one slot per column) so the oldest column can be
+		//* dropped from the row windows without parsing them, RTL rows grow towards the end and LTR rows towards the start
+		struct Ring {
+			vector<Row> rows;
+			vector<uint8_t> lens;
+			int head{}, size{};
+		};
+		array<Ring, 2> rings;
+
+		//* Drop the oldest column of <ring>
+		void _drop(Ring& ring);
+
+		//* Claim the slot for a new column in <ring>, the oldest column is dropped when full
+		int _claim(Ring& ring);
+
+		//* Write the cell of <row> in column <slot>, newest side of the row
+		void _put(Ring& ring, int row, int slot, std::string_view cell);
+
+		//* A value of a vertical graph with the number of columns it fills with two and with one dot per dot row
+		//* Vertical graphs don't use the rings, every braille row holds four consecutive values, so a new value moves
+		//* every value to the next dot row and changes every cell. Only the values are kept and all rows drawn again
+		struct Bar {
+			long long value{};
+			int full{}, half{};
+		};
+		vector<Bar> bars;			//? Ring of the last height * 4 values, newest at <bars_head>
+		int bars_head{};
+		vector<string> bar_colors;	//? Gradient color of each column
+
+		Bar _bar(long long value) const;
+
+		//* Add the values from <data_offset> to the bars and draw them to <out>
+		void _create_bars(const deque<long long>& data, int data_offset);
 
 		//* Create two representations of the graph to switch between to represent two values for each braille character
 		void _create(const deque<long long>& data, int data_offset);
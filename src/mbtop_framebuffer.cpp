@@ -0,0 +1,629 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+
+#include <fmt/format.h>
+
+#include "mbtop_framebuffer.hpp"
+#include "mbtop_tools.hpp"
+
+namespace Term {
+
+	namespace {
+		//* Split CSI parameters on ';' into <out>, empty parameters become -1, returns the number of parameters
+		size_t parse_params(std::string_view params, std::array<int, 16>& out) {
+			size_t count = 0;
+			int value = -1;
+			for (const char c : params) {
+				if (c == ';' or c == ':') {
+					out[count++] = value;
+					value = -1;
+					if (count == out.size()) return count;
+				}
+				else if (c >= '0' and c <= '9' and value < 100000) value = std::max(value, 0) * 10 + (c - '0');
+			}
+			out[count++] = value;
+			return count;
+		}
+
+		void set_glyph(FrameBuffer::cell& cell, std::string_view glyph, int width) {
+			cell.glyph.fill(0);
+			cell.len = static_cast<uint8_t>(std::min(glyph.size(), cell.glyph.size()));
+			std::copy_n(glyph.data(), cell.len, cell.glyph.data());
+			cell.width = static_cast<uint8_t>(width);
+		}
+
+		void blank(FrameBuffer::cell& cell) {
+			set_glyph(cell, " ", 1);
+		}
+
+		//* Apply the SGR parameters <params> to <cur>
+		void apply_sgr(FrameBuffer::pen& cur, std::string_view params) {
+			using enum FrameBuffer::attr;
+			using enum FrameBuffer::color_kind;
+			std::array<int, 16> p;
+			const size_t count = parse_params(params, p);
+			for (size_t i = 0; i < count; ++i) {
+				const int code = std::max(p[i], 0);
+				switch (code) {
+					case 0: cur = {}; break;
+					case 1: cur.attrs |= bold; break;
+					case 2: cur.attrs |= dim; break;
+					case 3: cur.attrs |= italic; break;
+					case 4: cur.attrs |= underline; break;
+					case 5: case 6: cur.attrs |= blink; break;
+					case 7: cur.attrs |= reverse; break;
+					case 9: cur.attrs |= strike; break;
+					case 22: cur.attrs &= ~(bold | dim); break;
+					case 23: cur.attrs &= ~italic; break;
+					case 24: cur.attrs &= ~underline; break;
+					case 25: cur.attrs &= ~blink; break;
+					case 27: cur.attrs &= ~reverse; break;
+					case 29: cur.attrs &= ~strike; break;
+					case 39: cur.fg = color_default; break;
+					case 49: cur.bg = color_default; break;
+					case 38: case 48: {
+						auto& target = code == 38 ? cur.fg : cur.bg;
+						if (i + 2 < count and p[i + 1] == 5) {
+							target = color_indexed | (static_cast<uint32_t>(p[i + 2]) & 0xff);
+							i += 2;
+						}
+						else if (i + 4 < count and p[i + 1] == 2) {
+							target = color_rgb | (static_cast<uint32_t>(p[i + 2]) & 0xff) << 16
+								| (static_cast<uint32_t>(p[i + 3]) & 0xff) << 8 | (static_cast<uint32_t>(p[i + 4]) & 0xff);
+							i += 4;
+						}
+						else i = count;
+						break;
+					}
+					default:
+						if (code >= 30 and code <= 37) cur.fg = color_basic | (code - 30);
+						else if (code >= 40 and code <= 47) cur.bg = color_basic | (code - 40);
+						else if (code >= 90 and code <= 97) cur.fg = color_bright | (code - 90);
+						else if (code >= 100 and code <= 107) cur.bg = color_bright | (code - 100);
+						break;
+				}
+			}
+		}
+	}
+
+	void FrameBuffer::resize(int width, int height) {
+		width = std::max(width, 0);
+		height = std::max(height, 0);
+		if (width == cols and height == rows) return;
+		cols = width;
+		rows = height;
+		back.assign(static_cast<size_t>(cols) * rows, cell{});
+		front = back;
+		row = std::min(row, std::max(rows - 1, 0));
+		col = std::min(col, std::max(cols - 1, 0));
+		saved_row = saved_col = 0;
+		wrap_pending = false;
+		invalidate();
+	}
+
+	void FrameBuffer::invalidate() noexcept {
+		repaint = true;
+		term_pen.reset();
+	}
+
+	void FrameBuffer::sync() {
+		front = back;
+		passthrough.clear();
+		repaint = false;
+		term_pen = cur;
+	}
+
+	void FrameBuffer::put(std::string_view glyph, int width) {
+		//? Combining characters join the glyph left of the cursor
+		if (width == 0) {
+			int c = wrap_pending ? col : col - 1;
+			if (c < 0) return;
+			if (at(row, c).width == 0 and c > 0) --c;
+			auto& target = at(row, c);
+			if (target.len + glyph.size() <= target.glyph.size()) {
+				std::copy_n(glyph.data(), glyph.size(), target.glyph.data() + target.len);
+				target.len += static_cast<uint8_t>(glyph.size());
+			}
+			return;
+		}
+
+		//? Autowrap, at the bottom line the terminal scrolls everything up one line
+		const auto newline = [&] {
+			col = 0;
+			if (row + 1 < rows) {
+				++row;
+				return;
+			}
+			std::move(back.begin() + cols, back.end(), back.begin());
+			erase(rows - 1, 0, rows - 1, cols - 1);
+		};
+		if (wrap_pending) {
+			wrap_pending = false;
+			newline();
+		}
+		if (width == 2 and col == cols - 1) newline();
+
+		auto& target = at(row, col);
+		//? Overwriting half of a wide glyph blanks the other half
+		if (target.width == 0 and col > 0) blank(at(row, col - 1));
+		if (target.width == 2 and col + 1 < cols) blank(at(row, col + 1));
+		set_glyph(target, glyph, width);
+		target.style = cur;
+
+		if (width == 2 and col + 1 < cols) {
+			auto& covered = at(row, col + 1);
+			if (covered.width == 2 and col + 2 < cols) blank(at(row, col + 2));
+			set_glyph(covered, "", 0);
+			covered.style = cur;
+		}
+
+		col += width;
+		if (col >= cols) {
+			col = cols - 1;
+			wrap_pending = true;
+		}
+	}
+
+	void FrameBuffer::erase(int from_row, int from_col, int to_row, int to_col) {
+		const size_t first = static_cast<size_t>(from_row) * cols + from_col;
+		const size_t last = static_cast<size_t>(to_row) * cols + to_col;
+		//? Erased cells take the current background color like on terminals with back color erase
+		cell erased;
+		erased.style.bg = cur.bg;
+		for (size_t i = first; i <= last and i < back.size(); ++i) back[i] = erased;
+	}
+
+	void FrameBuffer::csi(char final, std::string_view params) {
+		if (final == 'm') return apply_sgr(cur, params);
+
+		std::array<int, 16> p;
+		const size_t count = parse_params(params, p);
+		const int n = std::max(p[0], 1);
+		switch (final) {
+			case 'f': case 'H':
+				row = std::clamp(n, 1, rows) - 1;
+				col = std::clamp(count > 1 ? std::max(p[1], 1) : 1, 1, cols) - 1;
+				break;
+			case 'A': row = std::max(row - n, 0); break;
+			case 'B': row = std::min(row + n, rows - 1); break;
+			case 'C': col = std::min(col + n, cols - 1); break;
+			case 'D': col = std::max(col - n, 0); break;
+			case 'G': col = std::clamp(n, 1, cols) - 1; break;
+			case 'd': row = std::clamp(n, 1, rows) - 1; break;
+			case 's':
+				saved_row = row;
+				saved_col = col;
+				break;
+			case 'u':
+				row = saved_row;
+				col = saved_col;
+				break;
+			case 'J':
+				if (p[0] <= 0) erase(row, col, rows - 1, cols - 1);
+				else if (p[0] == 1) erase(0, 0, row, col);
+				else erase(0, 0, rows - 1, cols - 1);
+				return;
+			case 'K':
+				if (p[0] <= 0) erase(row, col, row, cols - 1);
+				else if (p[0] == 1) erase(row, 0, row, col);
+				else erase(row, 0, row, cols - 1);
+				return;
+			case 'X':
+				erase(row, col, row, std::min(col + n, cols) - 1);
+				return;
+			default:
+				//? Unknown effect on the screen, pass it on and repaint everything after it
+				passthrough += fmt::format("\x1b[{}{}", params, final);
+				invalidate();
+				return;
+		}
+		wrap_pending = false;
+	}
+
+	void FrameBuffer::write(std::string_view s) {
+		if (cols == 0 or rows == 0) {
+			passthrough.append(s);
+			return;
+		}
+		size_t i = 0;
+		while (i < s.size()) {
+			const auto c = static_cast<unsigned char>(s[i]);
+
+			//? Printable ascii runs, the bulk of all output
+			if (c >= 0x20 and c < 0x7f) {
+				put(s.substr(i, 1), 1);
+				++i;
+				continue;
+			}
+
+			if (c == 0x1b) {
+				if (i + 1 >= s.size()) break;
+				const char next = s[i + 1];
+				if (next == '[') {
+					size_t end = i + 2;
+					while (end < s.size() and s[end] >= 0x20 and s[end] <= 0x3f) ++end;
+					if (end >= s.size()) break;
+					const auto params = s.substr(i + 2, end - i - 2);
+					//? Private modes like cursor visibility, mouse reporting or synchronized output don't touch the grid
+					if (not params.empty() and params[0] >= 0x3c) passthrough.append(s.substr(i, end + 1 - i));
+					else csi(s[end], params);
+					i = end + 1;
+				}
+				else if (next == ']') {
+					//? Operating system command, ends with BEL or ST
+					size_t end = i + 2;
+					while (end < s.size() and s[end] != '\a' and not (s[end] == 0x1b and end + 1 < s.size() and s[end + 1] == '\\')) ++end;
+					end = std::min(end + (end < s.size() and s[end] == 0x1b ? 2 : 1), s.size());
+					passthrough.append(s.substr(i, end - i));
+					i = end;
+				}
+				else if (next == '7') {
+					saved_row = row;
+					saved_col = col;
+					i += 2;
+				}
+				else if (next == '8') {
+					row = saved_row;
+					col = saved_col;
+					wrap_pending = false;
+					i += 2;
+				}
+				else {
+					passthrough.append(s.substr(i, 2));
+					i += 2;
+				}
+				continue;
+			}
+
+			if (c < 0x20 or c == 0x7f) {
+				switch (c) {
+					//? Output post processing turns a line feed into carriage return and line feed
+					case '\n': row = std::min(row + 1, rows - 1); [[fallthrough]];
+					case '\r': col = 0; break;
+					case '\b': col = std::max(col - 1, 0); break;
+					case '\t': col = std::min((col / 8 + 1) * 8, cols - 1); break;
+					default: break;
+				}
+				wrap_pending = false;
+				++i;
+				continue;
+			}
+
+			//? UTF-8 sequence, invalid bytes are treated as a single column glyph
+			size_t len = (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xe ? 3 : (c >> 3) == 0x1e ? 4 : 1;
+			uint32_t cp = len == 2 ? c & 0x1f : len == 3 ? c & 0x0f : c & 0x07;
+			if (i + len > s.size()) len = 1;
+			for (size_t k = 1; k < len; ++k) {
+				const auto cont = static_cast<unsigned char>(s[i + k]);
+				if ((cont & 0xc0) != 0x80) {
+					len = 1;
+					break;
+				}
+				cp = (cp << 6) | (cont & 0x3f);
+			}
+			put(s.substr(i, len), len == 1 ? 1 : Tools::char_width(cp));
+			i += len;
+		}
+	}
+
+	void FrameBuffer::append_color(std::string& out, uint32_t color, bool background) {
+		const uint32_t value = color & 0xffffff;
+		const auto number = [&out](uint32_t n) {
+			char buf[10];
+			out.append(buf, std::to_chars(buf, buf + sizeof(buf), n).ptr);
+		};
+		switch (color & 0xff000000) {
+			case color_basic: number((background ? 40 : 30) + value); break;
+			case color_bright: number((background ? 100 : 90) + value); break;
+			case color_indexed:
+				out += background ? "48;5;" : "38;5;";
+				number(value);
+				break;
+			case color_rgb:
+				out += background ? "48;2;" : "38;2;";
+				number(value >> 16);
+				out += ';';
+				number((value >> 8) & 0xff);
+				out += ';';
+				number(value & 0xff);
+				break;
+			default: out += background ? "49" : "39"; break;
+		}
+	}
+
+	void FrameBuffer::append_sgr_params(std::string& out, const pen& from, const pen& to) {
+		static constexpr std::array<std::pair<uint16_t, const char*>, 7> on_codes = {{
+			{bold, "1"}, {dim, "2"}, {italic, "3"}, {underline, "4"}, {blink, "5"}, {reverse, "7"}, {strike, "9"}
+		}};
+		//? 22 turns off both bold and dim, the one that stays is turned on again
+		static constexpr std::array<std::pair<uint16_t, const char*>, 6> off_codes = {{
+			{bold | dim, "22"}, {italic, "23"}, {underline, "24"}, {blink, "25"}, {reverse, "27"}, {strike, "29"}
+		}};
+		const size_t start = out.size();
+		const auto separate = [&] { if (out.size() > start) out += ';'; };
+
+		uint16_t turn_on = to.attrs & ~from.attrs;
+		for (const auto& [bits, code] : off_codes) {
+			if (from.attrs & ~to.attrs & bits) {
+				separate();
+				out += code;
+				turn_on |= to.attrs & bits;
+			}
+		}
+		for (const auto& [bit, code] : on_codes) {
+			if (turn_on & bit) {
+				separate();
+				out += code;
+			}
+		}
+		if (to.fg != from.fg) {
+			separate();
+			append_color(out, to.fg, false);
+		}
+		if (to.bg != from.bg) {
+			separate();
+			append_color(out, to.bg, true);
+		}
+	}
+
+	void FrameBuffer::append_sgr(std::string& out, const std::optional<pen>& from, const pen& to) {
+		out += "\x1b[";
+		const size_t start = out.size();
+		if (from.has_value()) append_sgr_params(out, *from, to);
+
+		//? Turning attributes off one by one can be longer than starting over from a reset
+		if (not from.has_value() or (from->attrs & ~to.attrs) != 0) {
+			const size_t changes = out.size();
+			out += '0';
+			if (to != pen{}) {
+				out += ';';
+				append_sgr_params(out, pen{}, to);
+			}
+			if (from.has_value() and changes - start <= out.size() - changes) out.resize(changes);
+			else out.erase(start, changes - start);
+		}
+		out += 'm';
+	}
+
+	std::string FrameBuffer::flush() {
+		std::string out;
+		flush(out);
+		return out;
+	}
+
+	void FrameBuffer::flush(std::string& out) {
+		out += passthrough;
+		passthrough.clear();
+		if (cols == 0 or rows == 0) return;
+
+		//? Where the terminal cursor is after the output so far, -1 when unknown
+		int out_row = -1, out_col = -1;
+		for (int r = 0; r < rows; ++r) {
+			for (int c = 0; c < cols; ++c) {
+				const size_t i = static_cast<size_t>(r) * cols + c;
+				const auto& cell = back[i];
+				if (cell.width == 0 or (not repaint and cell == front[i])) continue;
+
+				if (out_row != r or out_col != c) {
+					const int gap = c - out_col;
+					//? Rewriting a few unchanged cells is shorter than a cursor move if they need no SGR change
+					const bool fill = out_row == r and gap > 0 and gap <= 3 and term_pen.has_value()
+						and std::all_of(back.begin() + (i - gap), back.begin() + i, [&](const auto& skipped) {
+							return skipped.width == 1 and skipped.style == *term_pen;
+						});
+					if (fill) {
+						for (auto it = back.begin() + (i - gap); it != back.begin() + i; ++it) out.append(it->glyph.data(), it->len);
+					}
+					else if (out_row == r and gap > 0) fmt::format_to(std::back_inserter(out), "\x1b[{}C", gap);
+					else fmt::format_to(std::back_inserter(out), "\x1b[{};{}f", r + 1, c + 1);
+				}
+
+				if (term_pen != cell.style) {
+					append_sgr(out, term_pen, cell.style);
+					term_pen = cell.style;
+				}
+				out.append(cell.glyph.data(), cell.len);
+
+				out_row = r;
+				out_col = c + cell.width;
+				//? The terminal holds the cursor at the last column until the next glyph, and a wide glyph
+				//? might be measured differently by the terminal, so the next cell gets an absolute move
+				if (cell.width != 1 or out_col >= cols) out_row = -1;
+			}
+		}
+		front = back;
+		repaint = false;
+	}
+
+	std::string FrameBuffer::text(int r) const {
+		std::string out;
+		for (int c = 0; c < cols; ++c) {
+			const auto& cell = get(r, c);
+			out.append(cell.glyph.data(), cell.len);
+		}
+		return out;
+	}
+
+	void OutputMinimizer::resize(int width, int height) {
+		if (width == cols and height == rows) return;
+		cols = width;
+		rows = height;
+		invalidate();
+	}
+
+	void OutputMinimizer::invalidate() noexcept {
+		term_pen.reset();
+		cur_known = false;
+		pending_sgrs = 0;
+	}
+
+	void OutputMinimizer::flush_sgr() {
+		if (not cur_known or term_pen == cur) {
+			pending_sgrs = 0;
+			return;
+		}
+		//? A single sequence applied to what the terminal has is written as it was, the common case and much cheaper
+		if (pending_sgrs == 1 and term_pen == pending_from) out.append(pending_sgr);
+		else FrameBuffer::append_sgr(out, term_pen, cur);
+		term_pen = cur;
+		pending_sgrs = 0;
+	}
+
+	void OutputMinimizer::flush_move() {
+		if (not move_pending) return;
+		move_pending = false;
+		if (move_absolute) {
+			fmt::format_to(std::back_inserter(out), "\x1b[{};{}f", move_row, move_col);
+			return;
+		}
+		const auto relative = [&](int n, char back, char forward) {
+			if (n == 0) return;
+			out += "\x1b[";
+			if (std::abs(n) > 1) fmt::format_to(std::back_inserter(out), "{}", std::abs(n));
+			out += n < 0 ? back : forward;
+		};
+		relative(move_row, 'A', 'B');
+		relative(move_col, 'D', 'C');
+	}
+
+	void OutputMinimizer::move(char final, int n) {
+		const bool vertical = final == 'A' or final == 'B';
+		const int delta = final == 'A' or final == 'D' ? -n : n;
+		//? After an absolute move the position is known and relative moves can be clamped to the screen like the terminal does
+		if (move_pending and move_absolute) {
+			if (vertical) move_row = std::clamp(move_row + delta, 1, rows);
+			else move_col = std::clamp(move_col + delta, 1, cols);
+			return;
+		}
+		//? Without it, moves in opposite directions don't add up if the first one stops at the edge
+		const int pending = vertical ? move_row : move_col;
+		if (move_pending and ((pending < 0 and delta > 0) or (pending > 0 and delta < 0))) flush_move();
+		if (not move_pending) {
+			move_pending = true;
+			move_absolute = false;
+			move_row = move_col = 0;
+		}
+		(vertical ? move_row : move_col) += delta;
+	}
+
+	void OutputMinimizer::csi(char final, std::string_view params, std::string_view sequence) {
+		const bool sized = cols > 0 and rows > 0;
+		switch (final) {
+			case 'm':
+				//? Until the output starts over from a reset, the state it builds on is unknown and it's passed on as is
+				if (not cur_known) {
+					const auto first = params.substr(0, params.find_first_of(";:"));
+					if (not first.empty() and first != "0") {
+						out.append(sequence);
+						return;
+					}
+					cur_known = true;
+				}
+				if (term_pen == cur) pending_sgrs = 0;
+				if (pending_sgrs++ == 0) {
+					pending_from = cur;
+					pending_sgr = sequence;
+				}
+				apply_sgr(cur, params);
+				return;
+			case 'f': case 'H':
+				if (not sized) break;
+				{
+					std::array<int, 16> p;
+					const size_t count = parse_params(params, p);
+					move_pending = move_absolute = true;
+					move_row = std::clamp(p[0], 1, rows);
+					move_col = std::clamp(count > 1 ? p[1] : 1, 1, cols);
+				}
+				return;
+			case 'A': case 'B': case 'C': case 'D':
+				if (not sized) break;
+				{
+					std::array<int, 16> p;
+					parse_params(params, p);
+					move(final, std::max(p[0], 1));
+				}
+				return;
+			default: break;
+		}
+		//? Erases fill with the current background and anything else might depend on the colors too
+		flush_move();
+		flush_sgr();
+		out.append(sequence);
+	}
+
+	const std::string& OutputMinimizer::minimize(std::string_view s) {
+		out.clear();
+		size_t i = 0;
+		while (i < s.size()) {
+			//? Glyphs and control characters, written as they are after the cursor move and colors they need
+			if (s[i] != '\x1b') {
+				const size_t end = std::min(s.find('\x1b', i), s.size());
+				flush_move();
+				flush_sgr();
+				out.append(s.substr(i, end - i));
+				i = end;
+				continue;
+			}
+
+			const char next = i + 1 < s.size() ? s[i + 1] : 0;
+			if (next == '[') {
+				size_t end = i + 2;
+				while (end < s.size() and s[end] >= 0x20 and s[end] <= 0x3f) ++end;
+				if (end >= s.size()) break;
+				const auto params = s.substr(i + 2, end - i - 2);
+				const auto sequence = s.substr(i, end + 1 - i);
+				//? Private modes don't depend on colors, only keep them in order with the cursor moves
+				if (not params.empty() and params[0] >= 0x3c) {
+					flush_move();
+					out.append(sequence);
+				}
+				else csi(s[end], params, sequence);
+				i = end + 1;
+			}
+			else if (next == ']') {
+				size_t end = i + 2;
+				while (end < s.size() and s[end] != '\a' and not (s[end] == 0x1b and end + 1 < s.size() and s[end + 1] == '\\')) ++end;
+				end = std::min(end + (end < s.size() and s[end] == 0x1b ? 2 : 1), s.size());
+				flush_move();
+				out.append(s.substr(i, end - i));
+				i = end;
+			}
+			else if (next != 0) {
+				flush_move();
+				out.append(s.substr(i, 2));
+				//? Restoring the cursor with ESC 8 also restores the colors saved with it
+				if (next == '8') {
+					term_pen.reset();
+					pending_sgrs = 0;
+				}
+				i += 2;
+			}
+			else break;
+		}
+		flush_move();
+		flush_sgr();
+		//? A sequence cut off at the end is passed on for the terminal to complete with the next write
+		if (i < s.size()) out.append(s.substr(i));
+		return out;
+	}
+}
@@ -0,0 +1,167 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Term {
+
+	//* Model of the terminal screen as a grid of cells with a glyph and SGR attributes each
+	//* Output meant for the terminal is applied to the grid with write(), the escape sequences used by the Draw functions
+	//* (cursor moves, SGR colors and styles, erase) are interpreted and anything else is passed through unchanged.
+	//* flush() then returns only what's needed to turn the last flushed screen into the current one.
+	class FrameBuffer {
+	public:
+		//? Attribute bits of a cell
+		enum attr : uint16_t {
+			bold = 1 << 0,
+			dim = 1 << 1,
+			italic = 1 << 2,
+			underline = 1 << 3,
+			blink = 1 << 4,
+			reverse = 1 << 5,
+			strike = 1 << 6,
+		};
+
+		//? Colors keep the form they were given in, top byte is the kind and the rest the index or rgb value
+		enum color_kind : uint32_t {
+			color_default = 0,
+			color_basic = 1u << 24,		//? 30-37, 40-47
+			color_bright = 2u << 24,	//? 90-97, 100-107
+			color_indexed = 3u << 24,	//? 38;5;n, 48;5;n
+			color_rgb = 4u << 24,		//? 38;2;r;g;b, 48;2;r;g;b
+		};
+
+		struct pen {
+			uint32_t fg{};
+			uint32_t bg{};
+			uint16_t attrs{};
+			bool operator==(const pen& other) const = default;
+		};
+
+		struct cell {
+			std::array<char, 12> glyph{' '};
+			uint8_t len{1};
+			uint8_t width{1};	//? 2 for wide glyphs, 0 for the cell covered by a wide glyph to its left
+			pen style;
+			bool operator==(const cell& other) const = default;
+		};
+
+	private:
+		int cols{}, rows{};
+		std::vector<cell> back;		//? Screen after everything written so far
+		std::vector<cell> front;	//? Screen as of the last flush()
+		bool repaint{true};			//? Terminal contents unknown, next flush() writes every cell
+		std::string passthrough;	//? Sequences not handled by the grid, written first by the next flush()
+
+		//? Parser state, carried between writes like the terminal carries it
+		pen cur;
+		int row{}, col{};
+		int saved_row{}, saved_col{};
+		bool wrap_pending{};
+
+		//? SGR state of the terminal after the last flush(), nullopt when unknown
+		std::optional<pen> term_pen;
+
+		cell& at(int r, int c) { return back[static_cast<size_t>(r) * cols + c]; }
+		void put(std::string_view glyph, int width);
+		void erase(int from_row, int from_col, int to_row, int to_col);
+		void csi(char final, std::string_view params);
+
+		static void append_sgr_params(std::string& out, const pen& from, const pen& to);
+		static void append_color(std::string& out, uint32_t color, bool background);
+	public:
+		FrameBuffer() = default;
+		FrameBuffer(int width, int height) { resize(width, height); }
+
+		//* Set the screen size, clears the grid and repaints everything on the next flush() if it changed
+		void resize(int width, int height);
+
+		//* Forget what's on the terminal, the next flush() writes every cell
+		void invalidate() noexcept;
+
+		//* Apply terminal output to the grid
+		void write(std::string_view output);
+
+		//* Bytes that bring the terminal from the last flushed screen to the current one, empty if nothing changed
+		std::string flush();
+
+		//* Same as flush() but appended to <out>
+		void flush(std::string& out);
+
+		//* Mark the current grid as being on the terminal, for output that was written as is instead of through flush()
+		void sync();
+
+		int width() const noexcept { return cols; }
+		int height() const noexcept { return rows; }
+
+		//* Cell at zero based <r>, <c> of the current grid
+		const cell& get(int r, int c) const { return back[static_cast<size_t>(r) * cols + c]; }
+
+		//* Glyphs of row <r> as a string, for tests and debugging
+		std::string text(int r) const;
+
+		//* Append the shortest SGR sequence that changes the terminal from <from>, unknown if nullopt, to <to>
+		static void append_sgr(std::string& out, const std::optional<pen>& from, const pen& to);
+	};
+
+	//* Rewrites terminal output to fewer bytes with the same effect on the screen, for frames written whole
+	//* SGR sequences are held back until a glyph or an erase needs them and then written as the smallest change from
+	//* what the terminal has, so colors set again or set and replaced before anything is printed cost nothing.
+	//* Runs of cursor moves with nothing printed in between are folded into one move.
+	class OutputMinimizer {
+		int cols{}, rows{};
+		std::string out;
+
+		//? SGR state of the terminal after what was written so far, nullopt when unknown
+		std::optional<FrameBuffer::pen> term_pen;
+		//? SGR state the output asked for, only known after it started from a reset
+		FrameBuffer::pen cur;
+		bool cur_known{};
+
+		//? SGR sequences since the terminal state last matched, the first one and the state it was applied to
+		size_t pending_sgrs{};
+		std::string_view pending_sgr;
+		FrameBuffer::pen pending_from;
+
+		//? Cursor moves not written yet, an absolute position (1 based) or a relative move per axis
+		bool move_pending{}, move_absolute{};
+		int move_row{}, move_col{};
+
+		void csi(char final, std::string_view params, std::string_view sequence);
+		void move(char final, int n);
+		void flush_move();
+		void flush_sgr();
+	public:
+		//* Set the screen size used to fold relative moves into absolute ones, forgets the terminal state if it changed
+		void resize(int width, int height);
+
+		//* Forget the SGR state of the terminal, for when something else was written to it
+		void invalidate() noexcept;
+
+		//* Minimized <output>, valid until the next call, leaves the terminal in the same state <output> would
+		const std::string& minimize(std::string_view output);
+	};
+}
@@ -0,0 +1,82 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#include <memory>
+#include <ostream>
+#include <mutex>
+#include <unordered_map>
+
+#include "mbtop_intern.hpp"
+
+namespace Tools {
+
+	//* All interned strings, entries stay until swept so acquiring and releasing a string never frees under a reader
+	struct intern_pool {
+		std::mutex mtx;
+		std::unordered_map<std::string_view, std::unique_ptr<interned_string::entry>> entries;	//? Keyed by the entry's own text
+		size_t sweep_at{1024};
+
+		void sweep_locked() {
+			std::erase_if(entries, [](const auto& item) { return item.second->refs.load(std::memory_order_acquire) == 0; });
+			sweep_at = std::max<size_t>(1024, entries.size() * 2);
+		}
+	};
+
+	namespace {
+		intern_pool& pool() {
+			static intern_pool instance;
+			return instance;
+		}
+		const std::string empty_string;
+	}
+
+	const interned_string::entry* interned_string::acquire(std::string_view text) {
+		if (text.empty()) return nullptr;
+		auto& p = pool();
+		std::lock_guard lock(p.mtx);
+		if (auto it = p.entries.find(text); it != p.entries.end()) {
+			it->second->refs.fetch_add(1, std::memory_order_relaxed);
+			return it->second.get();
+		}
+		if (p.entries.size() >= p.sweep_at) p.sweep_locked();
+		auto created = std::make_unique<entry>(std::string(text), 1);
+		const entry* result = created.get();
+		p.entries.emplace(created->text, std::move(created));
+		return result;
+	}
+
+	const std::string& interned_string::str() const noexcept {
+		return ptr != nullptr ? ptr->text : empty_string;
+	}
+
+	size_t interned_string::pool_size() {
+		auto& p = pool();
+		std::lock_guard lock(p.mtx);
+		return p.entries.size();
+	}
+
+	void interned_string::sweep() {
+		auto& p = pool();
+		std::lock_guard lock(p.mtx);
+		p.sweep_locked();
+	}
+
+	std::ostream& operator<<(std::ostream& os, const interned_string& s) {
+		return os << s.str();
+	}
+}
@@ -0,0 +1,131 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#pragma once
+
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace Tools {
+
+	//* Immutable string shared by every equal value, for names, users and commands repeated across thousands of processes
+	//* Equal strings are the same pool entry, so equality is a pointer compare. Reads like a const std::string.
+	//* Usage example: interned_string name = "php-fpm"; if (name == other.name) ...; fmt::format("{}", name);
+	class interned_string {
+		struct entry {
+			std::string text;
+			mutable std::atomic<uint32_t> refs{};
+		};
+		const entry* ptr{};		//? nullptr for the empty string
+
+		static const entry* acquire(std::string_view text);
+		void release() noexcept { if (ptr != nullptr) ptr->refs.fetch_sub(1, std::memory_order_acq_rel); }
+		friend struct intern_pool;
+	public:
+		interned_string() noexcept = default;
+		interned_string(std::string_view text) : ptr(acquire(text)) {}
+		interned_string(const std::string& text) : ptr(acquire(text)) {}
+		interned_string(const char* text) : ptr(acquire(text)) {}
+		interned_string(const interned_string& other) noexcept : ptr(other.ptr) {
+			if (ptr != nullptr) ptr->refs.fetch_add(1, std::memory_order_relaxed);
+		}
+		interned_string(interned_string&& other) noexcept : ptr(other.ptr) { other.ptr = nullptr; }
+		interned_string& operator=(const interned_string& other) noexcept {
+			if (other.ptr != nullptr) other.ptr->refs.fetch_add(1, std::memory_order_relaxed);
+			release();
+			ptr = other.ptr;
+			return *this;
+		}
+		interned_string& operator=(interned_string&& other) noexcept {
+			if (this != &other) {
+				release();
+				ptr = other.ptr;
+				other.ptr = nullptr;
+			}
+			return *this;
+		}
+		~interned_string() { release(); }
+
+		const std::string& str() const noexcept;
+		operator const std::string&() const noexcept { return str(); }
+		operator std::string_view() const noexcept { return str(); }
+
+		bool empty() const noexcept { return ptr == nullptr; }
+		size_t size() const noexcept { return str().size(); }
+		size_t length() const noexcept { return str().size(); }
+		const char* c_str() const noexcept { return str().c_str(); }
+		const char* data() const noexcept { return str().data(); }
+		auto begin() const noexcept { return str().begin(); }
+		auto end() const noexcept { return str().end(); }
+		char operator[](size_t pos) const noexcept { return str()[pos]; }
+		char front() const noexcept { return str().front(); }
+		char back() const noexcept { return str().back(); }
+		size_t find(std::string_view needle, size_t pos = 0) const noexcept { return str().find(needle, pos); }
+		size_t find(char c, size_t pos = 0) const noexcept { return str().find(c, pos); }
+		size_t rfind(char c, size_t pos = std::string::npos) const noexcept { return str().rfind(c, pos); }
+		std::string substr(size_t pos = 0, size_t count = std::string::npos) const { return str().substr(pos, count); }
+		bool starts_with(std::string_view prefix) const noexcept { return str().starts_with(prefix); }
+		bool ends_with(std::string_view suffix) const noexcept { return str().ends_with(suffix); }
+		bool contains(std::string_view needle) const noexcept { return str().contains(needle); }
+		bool contains(char c) const noexcept { return str().contains(c); }
+
+		friend bool operator==(const interned_string& a, const interned_string& b) noexcept { return a.ptr == b.ptr; }
+		friend bool operator==(const interned_string& a, std::string_view b) noexcept { return a.str() == b; }
+		friend bool operator==(const interned_string& a, const std::string& b) noexcept { return a.str() == b; }
+		friend bool operator==(const interned_string& a, const char* b) noexcept { return a.str() == b; }
+		friend std::strong_ordering operator<=>(const interned_string& a, const interned_string& b) noexcept {
+			if (a.ptr == b.ptr) return std::strong_ordering::equal;
+			return a.str() <=> b.str();
+		}
+		friend std::strong_ordering operator<=>(const interned_string& a, std::string_view b) noexcept { return std::string_view(a.str()) <=> b; }
+
+		friend std::string operator+(const interned_string& a, std::string_view b) { return std::string(a.str()).append(b); }
+		friend std::string operator+(const interned_string& a, char b) { return std::string(a.str()) + b; }
+		friend std::string operator+(std::string_view a, const interned_string& b) { return std::string(a).append(b.str()); }
+		friend std::string operator+(const std::string& a, const interned_string& b) { return a + b.str(); }
+		friend std::string operator+(std::string&& a, const interned_string& b) { return std::move(a.append(b.str())); }
+		friend std::string operator+(const char* a, const interned_string& b) { return a + b.str(); }
+		friend std::string operator+(char a, const interned_string& b) { return a + b.str(); }
+
+		friend std::ostream& operator<<(std::ostream& os, const interned_string& s);
+
+		//* Strings in the pool, including the ones no longer used until the next sweep
+		static size_t pool_size();
+		//* Free the pool entries no interned_string refers to any more, also done by the pool itself as it grows
+		static void sweep();
+	};
+}
+
+template <>
+struct fmt::formatter<Tools::interned_string> : fmt::formatter<std::string_view> {
+	auto format(const Tools::interned_string& s, fmt::format_context& ctx) const {
+		return fmt::formatter<std::string_view>::format(s.str(), ctx);
+	}
+};
+
+template <>
+struct std::hash<Tools::interned_string> {
+	size_t operator()(const Tools::interned_string& s) const noexcept { return std::hash<std::string_view>{}(s.str()); }
+};
@@ -331,6 +331,58 @@ namespace Menu {
 				"",
 				"Min value: 100 ms",
 				"Max value: 86400000 ms = 24 hours."},
+			{"cpu_update_ms",
+				"Update time of the cpu box in ms.",
+				"",
+				"Lower values catch short usage",
+				"spikes in the cpu graphs.",
+				"",
+				"0 = same as update_ms.",
+				"Otherwise 100 to 86400000 ms."},
+			{"mem_update_ms",
+				"Update time of the mem box in ms.",
+				"",
+				"Includes disks, higher values",
+				"lower the cost of disk stats.",
+				"",
+				"0 = same as update_ms.",
+				"Otherwise 100 to 86400000 ms."},
+			{"net_update_ms",
+				"Update time of the net box in ms.",
+				"",
+				"Lower values catch short traffic",
+				"spikes in the net graphs.",
+				"",
+				"0 = same as update_ms.",
+				"Otherwise 100 to 86400000 ms."},
+			{"proc_update_ms",
+				"Update time of the proc box in ms.",
+				"",
+				"Higher values lower the cost of",
+				"reading all processes.",
+				"",
+				"0 = same as update_ms.",
+				"Otherwise 100 to 86400000 ms."},
+			{"concurrent_collect",
+				"Collect boxes concurrently.",
+				"",
+				"Collect data for all shown boxes at the",
+				"same time on separate threads, so a slow",
+				"box doesn't hold back the others.",
+				"",
+				"Boxes are still drawn in the same order.",
+				"",
+				"True or False"},
+			{"io_uring",
+				"(Linux) Batch reads with io_uring.",
+				"",
+				"Read the /proc and /sys files of each",
+				"update with a single io_uring batch",
+				"instead of one system call per file.",
+				"",
+				"Falls back to regular reads on kernels",
+				"older than 5.6 or when io_uring is",
+				"blocked by seccomp or sysctl."},
 			{"rounded_corners",
 				"Rounded corners on boxes.",
 				"",
@@ -344,6 +396,23 @@ namespace Menu {
 				"to reduce flickering on supported terminals.",
 				"",
 				"True or False."},
+			{"diff_output",
+				"Only write changed screen cells.",
+				"",
+				"Keeps a copy of the screen and writes",
+				"only the cells that changed since the",
+				"last frame, much less output over ssh.",
+				"",
+				"True or False."},
+			{"minimize_output",
+				"Minimize whole frame output.",
+				"",
+				"When diff_output is off, drops color",
+				"and style changes that change nothing",
+				"and merges cursor moves before a frame",
+				"is written.",
+				"",
+				"True or False."},
 			{"graph_symbol",
 				"Default symbols to use for graph creation.",
 				"",
@@ -1012,6 +1081,26 @@ namespace Menu {
 				"",
 				"Set to 'True' to filter out internal",
 				"processes started by the Linux kernel."},
+			{"proc_collect_threads",
+				"(Linux) Threads used to read processes.",
+				"",
+				"Number of threads that read /proc",
+				"in parallel when there are many",
+				"processes running.",
+				"",
+				"0 = automatic, 1 = single thread."},
+			{"proc_events",
+				"(Linux) Track processes with events.",
+				"",
+				"Use the netlink process connector to",
+				"follow process start and exit instead",
+				"of listing /proc on every update.",
+				"",
+				"Shows processes that started and exited",
+				"between updates as short-lived.",
+				"",
+				"Needs root or CAP_NET_ADMIN, falls back",
+				"to listing /proc otherwise."},
 			{"proc_follow_detailed",
 				"Follow selected process with detailed view",
 				"",
@@ -1130,7 +1219,7 @@ namespace Menu {
 			y = Term::height/2 - 9;
 			bg = Draw::createBox(x + 2, y, 78, 19, Theme::c("hi_fg"), true, "signals");
 			bg += Mv::to(y+2, x+3) + Theme::c("title") + Fx::b + cjust("Send signal to PID " + to_string(s_pid) + " ("
-				+ uresize((s_pid == Config::getI("detailed_pid") ? Proc::detailed.entry.name : Config::getS("selected_name")), 30) + ")", 76);
+				+ uresize((s_pid == Config::getI("detailed_pid") ? Proc::detailed.entry.name.str() : Config::getS("selected_name")), 30) + ")", 76);
 		}
 		else if (is_in(key, "escape", "q")) {
 			return Closed;
@@ -1304,7 +1393,7 @@ namespace Menu {
 		if (s_pid == 0) return Closed;
 		if (redraw) {
 			atomic_wait(Runner::active);
-			auto& p_name = (s_pid == Config::getI("detailed_pid") ? Proc::detailed.entry.name : Config::getS("selected_name"));
+			auto& p_name = (s_pid == Config::getI("detailed_pid") ? Proc::detailed.entry.name.str() : Config::getS("selected_name"));
 			vector<string> cont_vec = {
 				Fx::b + Theme::c("main_fg") + "Send signal: " + Fx::ub + Theme::c("hi_fg") + to_string(signalToSend)
 				+ (signalToSend > 0 and signalToSend <= 32 ? Theme::c("main_fg") + " (" + P_Signals.at(signalToSend) + ')' : ""),
@@ -1642,7 +1731,7 @@ namespace Menu {
 		else if (is_in(key, "left", "right") or (vim_keys and is_in(key, "h", "l"))) {
 			const auto& option = categories[selected_cat][item_height * page + selected][0];
 			if (selPred.test(isInt)) {
-				const int mod = (option == "update_ms" ? 100 : 1);
+				const int mod = (option.ends_with("update_ms") ? 100 : 1);
 				long value = Config::getI(option);
 				if (key == "right" or (vim_keys and key == "l")) value += mod;
 				else value -= mod;
@@ -1723,7 +1812,7 @@ namespace Menu {
 
 		//? Draw the menu
 		if (retval == Changed) {
-			Config::unlock();
+			Config::merge();
 			auto& out = Global::overlay;
 			out = bg;
 			item_height = min((int)categories[selected_cat].size(), (int)floor((double)(height - 4) / 2));
@@ -1927,7 +2016,7 @@ namespace Menu {
 			y = Term::height/2 - 6;
 			bg = Draw::createBox(x + 2, y, 50, 13, Theme::c("hi_fg"), true, "renice");
 			bg += Mv::to(y+2, x+3) + Theme::c("title") + Fx::b + cjust("Renice PID " + to_string(s_pid) + " ("
-				+ uresize((s_pid == Config::getI("detailed_pid") ? Proc::detailed.entry.name : Config::getS("selected_name")), 15) + ")", 48);
+				+ uresize((s_pid == Config::getI("detailed_pid") ? Proc::detailed.entry.name.str() : Config::getS("selected_name")), 15) + ")", 48);
 		}
 		else if (is_in(key, "escape", "q")) {
 			return Closed;
@@ -3133,8 +3222,16 @@ namespace MenuV2 {
 				{
 					{"Update", {
 						{"update_ms", "Update Interval", "Update time in milliseconds (100-86400000)", ControlType::Slider, {}, "", 100, 10000, 100},
+						{"cpu_update_ms", "CPU Interval", "CPU box update time in ms (0=update_ms)", ControlType::Slider, {}, "", 0, 10000, 100},
+						{"mem_update_ms", "MEM Interval", "MEM box and disks update time in ms (0=update_ms)", ControlType::Slider, {}, "", 0, 10000, 100},
+						{"net_update_ms", "NET Interval", "NET box update time in ms (0=update_ms)", ControlType::Slider, {}, "", 0, 10000, 100},
+						{"proc_update_ms", "PROC Interval", "PROC box update time in ms (0=update_ms)", ControlType::Slider, {}, "", 0, 10000, 100},
 						{"background_update", "Background Update", "Update UI when menus are showing", ControlType::Toggle, {}, "", 0, 0, 0},
+						{"concurrent_collect", "Concurrent Collect", "Collect all boxes at the same time on separate threads", ControlType::Toggle, {}, "", 0, 0, 0},
+						{"io_uring", "io_uring Reads", "Batch /proc and /sys reads with io_uring (Linux)", ControlType::Toggle, {}, "", 0, 0, 0},
 						{"terminal_sync", "Terminal Sync", "Use synchronized output to reduce flickering", ControlType::Toggle, {}, "", 0, 0, 0},
+						{"diff_output", "Diff Output", "Only write screen cells that changed since the last frame", ControlType::Toggle, {}, "", 0, 0, 0},
+						{"minimize_output", "Minimize Output", "Drop redundant color changes and cursor moves from whole frames", ControlType::Toggle, {}, "", 0, 0, 0},
 					}},
 					{"Input", {
 						{"vim_keys", "Vim Keys (hjkl)", "Enable h,j,k,l for directional control", ControlType::Toggle, {}, "", 0, 0, 0},
@@ -3321,6 +3418,8 @@ namespace MenuV2 {
 						{"proc_aggregate", "Aggregate", "Aggregate child process stats in tree view", ControlType::Toggle, {}, "", 0, 0, 0},
 						{"proc_info_smaps", "Use smaps", "Use smaps for accurate memory (slower)", ControlType::Toggle, {}, "", 0, 0, 0},
 						{"proc_filter_kernel", "Filter Kernel", "Filter out kernel processes (Linux)", ControlType::Toggle, {}, "", 0, 0, 0},
+						{"proc_events", "Process Events", "Track processes with netlink events (Linux, root)", ControlType::Toggle, {}, "", 0, 0, 0},
+						{"proc_collect_threads", "Collect Threads", "Threads reading /proc (Linux, 0=auto)", ControlType::Slider, {}, "", 0, Config::PROC_COLLECT_THREADS_MAX, 1},
 						{"proc_follow_detailed", "Follow Detailed", "Follow selected process in detailed view", ControlType::Toggle, {}, "", 0, 0, 0},
 						{"keep_dead_proc_usage", "Keep Dead Usage", "Preserve CPU/mem usage for dead processes", ControlType::Toggle, {}, "", 0, 0, 0},
 					}},
@@ -4844,7 +4943,7 @@ namespace MenuV2 {
 
 		// Draw content
 		if (retval == Menu::Changed or Menu::redraw) {
-			Config::unlock();  //? Flush any pending config changes from boolsTmp/intsTmp/stringsTmp to main maps
+			Config::merge();  //? Write any config changes made by the runner to the live values
 			out = Menu::bg;
 
 			//? Clear dynamic mouse mappings (keep tab and close_settings mappings from rebuildMenuBg)
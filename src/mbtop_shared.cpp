@@ -18,10 +18,12 @@ tab-size = 4
 
 #include <sys/resource.h>
 #include <algorithm>
+#include <charconv>
 #include <filesystem>
 #include <fstream>
 #include <ranges>
 #include <regex>
+#include <span>
 #include <string>
 
 #include "mbtop_config.hpp"
@@ -34,6 +36,7 @@ using namespace Tools;
 
 namespace Cpu {
     std::optional<std::string> container_engine;
+	atomic<uint64_t> data_version{};
 
 	string trim_name(string name) {
 		auto name_vec = ssplit(name);
@@ -80,6 +83,14 @@ namespace Cpu {
 	}
 }
 
+namespace Mem {
+	atomic<uint64_t> data_version{};
+}
+
+namespace Net {
+	atomic<uint64_t> data_version{};
+}
+
 #ifdef GPU_SUPPORT
 namespace Gpu {
 	vector<string> gpu_names;
@@ -180,6 +191,9 @@ namespace Proc {
 	//? Currently visible sort fields - updated by draw() based on column visibility
 	vector<string> visible_sort_fields;
 
+	atomic<uint64_t> short_lived{};
+	atomic<uint64_t> data_version{};
+
 bool set_priority(pid_t pid, int priority) {
   if (setpriority(PRIO_PROCESS, pid, priority) == 0) {
     return true;
@@ -187,55 +201,131 @@ bool set_priority(pid_t pid, int priority) {
   return false;
 }
 
-	void proc_sorter(vector<proc_info>& proc_vec, const string& sorting, bool reverse, bool tree) {
-		if (reverse) {
-			switch (v_index(sort_vector, sorting)) {
-			case 0: rng::stable_sort(proc_vec, rng::less{}, &proc_info::pid); 		break;
-			case 1: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::name);		break;
-			case 2: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::cmd); 		break;
-			case 3: rng::stable_sort(proc_vec, rng::less{}, &proc_info::threads);	break;
-			case 4: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::user); 		break;
-			case 5: rng::stable_sort(proc_vec, rng::less{}, &proc_info::mem); 		break;
-			case 6: rng::stable_sort(proc_vec, rng::less{}, &proc_info::cpu_p);		break;
-			case 7: rng::stable_sort(proc_vec, rng::less{}, &proc_info::cpu_c);		break;
-			case 8: rng::stable_sort(proc_vec, rng::less{}, &proc_info::gpu_p);		break;
-			case 9: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return (a.io_read + a.io_write) < (b.io_read + b.io_write); });	break;
-			case 10: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::state);	break;  // state
-			case 11: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::p_priority);	break;  // priority (higher value = lower priority)
-			case 12: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::p_nice);	break;  // nice
-			case 13: rng::stable_sort(proc_vec, rng::less{}, &proc_info::io_read);	break;  // io read
-			case 14: rng::stable_sort(proc_vec, rng::less{}, &proc_info::io_write);	break;  // io write
-			case 15: rng::stable_sort(proc_vec, rng::less{}, &proc_info::virt_mem);	break;  // virt mem
-			case 16: rng::stable_sort(proc_vec, rng::less{}, &proc_info::ports);	break;  // ports
-			case 17: rng::stable_sort(proc_vec, rng::less{}, &proc_info::runtime);	break;  // runtime
-			case 18: rng::stable_sort(proc_vec, rng::less{}, &proc_info::cpu_t);	break;  // cpu time
-			case 19: rng::stable_sort(proc_vec, rng::less{}, &proc_info::gpu_time);	break;  // gpu time
+	namespace {
+		//* Stable sort of <procs> by the value <key> gives for each process, ordered by <comp>
+		//* The keys are read once into a contiguous column and sorted along with their index, the processes themselves are
+		//* then moved once each into their new place instead of being swapped around by the sort.
+		//* With <rows> less than the unfiltered processes only those first rows are selected and sorted, the rest mostly
+		//* keep their previous place. Returns the number of unfiltered rows in order, SIZE_MAX when all of them are.
+		template <typename Key, typename Compare>
+		size_t sort_by_key(std::span<proc_info> procs, Key key, Compare comp, size_t rows) {
+			using key_type = std::remove_cvref_t<std::invoke_result_t<Key, const proc_info&>>;
+			static vector<std::pair<key_type, uint32_t>> column;
+			static vector<uint32_t> order;
+			static vector<bool> taken;
+			const uint32_t size = static_cast<uint32_t>(procs.size());
+			const bool partial = rows < size;
+
+			//? Filtered processes are never shown, a partial sort leaves them out and puts them after the rest
+			column.clear();
+			for (uint32_t i = 0; i < size; ++i) {
+				if (not partial or not procs[i].filtered) column.emplace_back(key(procs[i]), i);
 			}
+			//? Ties keep their order through the index, the same result as a stable sort without its merge buffer
+			const auto before = [&](const auto& a, const auto& b) {
+				return comp(a.first, b.first) or (not comp(b.first, a.first) and a.second < b.second);
+			};
+			if (partial and rows < column.size()) {
+				rng::nth_element(column, column.begin() + rows, before);
+				column.resize(rows);
+			}
+			else rows = SIZE_MAX;
+			rng::sort(column, before);
+
+			//? order[i] is where the process for slot i comes from
+			order.clear();
+			for (const auto& [value, index] : column) order.push_back(index);
+			if (order.size() < size) {
+				//? The rest stay where they are, processes pushed out of the first rows take the places of the ones moved up
+				const uint32_t head = static_cast<uint32_t>(order.size());
+				taken.assign(size, false);
+				for (const auto index : order) taken[index] = true;
+				uint32_t pushed_out = 0;
+				for (uint32_t i = head; i < size; ++i) {
+					if (taken[i]) {
+						while (taken[pushed_out]) ++pushed_out;
+						order.push_back(pushed_out++);
+					}
+					else order.push_back(i);
+				}
+			}
+
+			//? Follow each cycle of the permutation
+			constexpr uint32_t placed = UINT32_MAX;
+			for (uint32_t start = 0; start < size; ++start) {
+				if (order[start] == placed) continue;
+				if (order[start] == start) {
+					order[start] = placed;
+					continue;
+				}
+				proc_info first = std::move(procs[start]);
+				uint32_t slot = start;
+				while (order[slot] != start) {
+					const uint32_t from = order[slot];
+					procs[slot] = std::move(procs[from]);
+					order[slot] = placed;
+					slot = from;
+				}
+				procs[slot] = std::move(first);
+				order[slot] = placed;
+			}
+			return rows;
 		}
-		else {
-			switch (v_index(sort_vector, sorting)) {
-			case 0: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::pid); 		break;
-			case 1: rng::stable_sort(proc_vec, rng::less{}, &proc_info::name);		break;
-			case 2: rng::stable_sort(proc_vec, rng::less{}, &proc_info::cmd); 		break;
-			case 3: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::threads);	break;
-			case 4: rng::stable_sort(proc_vec, rng::less{}, &proc_info::user);		break;
-			case 5: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::mem); 		break;
-			case 6: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::cpu_p);   	break;
-			case 7: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::cpu_c);   	break;
-			case 8: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::gpu_p);   	break;
-			case 9: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return (a.io_read + a.io_write) > (b.io_read + b.io_write); });	break;
-			case 10: rng::stable_sort(proc_vec, rng::less{}, &proc_info::state);	break;  // state
-			case 11: rng::stable_sort(proc_vec, rng::less{}, &proc_info::p_priority);	break;  // priority (lower value = higher priority)
-			case 12: rng::stable_sort(proc_vec, rng::less{}, &proc_info::p_nice);	break;  // nice
-			case 13: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::io_read);	break;  // io read
-			case 14: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::io_write);	break;  // io write
-			case 15: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::virt_mem);	break;  // virt mem
-			case 16: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::ports);	break;  // ports
-			case 17: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::runtime);	break;  // runtime
-			case 18: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::cpu_t);	break;  // cpu time
-			case 19: rng::stable_sort(proc_vec, rng::greater{}, &proc_info::gpu_time);	break;  // gpu time
+
+		//* Call <fn> with a function giving the value a process is sorted by for sort field <field>, returns <fallback>
+		//* for an unknown field
+		template <typename F, typename R>
+		R with_sort_key(int field, F&& fn, R fallback) {
+			switch (field) {
+			case 0: return fn([](const proc_info& p) { return p.pid; });
+			//? Names, commands and users are compared as views of the interned text
+			case 1: return fn([](const proc_info& p) { return std::string_view(p.name); });
+			case 2: return fn([](const proc_info& p) { return std::string_view(p.cmd); });
+			case 3: return fn([](const proc_info& p) { return p.threads; });
+			case 4: return fn([](const proc_info& p) { return std::string_view(p.user); });
+			case 5: return fn([](const proc_info& p) { return p.mem; });
+			case 6: return fn([](const proc_info& p) { return p.cpu_p; });
+			case 7: return fn([](const proc_info& p) { return p.cpu_c; });
+			case 8: return fn([](const proc_info& p) { return p.gpu_p; });
+			case 9: return fn([](const proc_info& p) { return p.io_read + p.io_write; });
+			case 10: return fn([](const proc_info& p) { return p.state; });
+			case 11: return fn([](const proc_info& p) { return p.p_priority; });
+			case 12: return fn([](const proc_info& p) { return p.p_nice; });
+			case 13: return fn([](const proc_info& p) { return p.io_read; });
+			case 14: return fn([](const proc_info& p) { return p.io_write; });
+			case 15: return fn([](const proc_info& p) { return p.virt_mem; });
+			case 16: return fn([](const proc_info& p) { return p.ports; });
+			case 17: return fn([](const proc_info& p) { return p.runtime; });
+			case 18: return fn([](const proc_info& p) { return p.cpu_t; });
+			case 19: return fn([](const proc_info& p) { return p.gpu_time; });
 			}
+			return fallback;
+		}
+
+		//* Sort fields where a higher value comes first unless reversed, the rest sort ascending
+		bool sorts_descending(int field) {
+			return field == 0 or (field >= 3 and field <= 9 and field != 4) or field >= 13;
+		}
+	}
+
+	size_t proc_sorter(vector<proc_info>& proc_vec, const string& sorting, bool reverse, bool tree, size_t rows, size_t sorted) {
+		//? The tree and "cpu lazy" reorder the whole list afterwards and need all of it in order
+		if (tree or sorting == "cpu lazy") rows = SIZE_MAX;
+		if (rows == SIZE_MAX) sorted = 0;
+
+		//? Rows already in order stay where they are, only the rest is sorted
+		size_t first = 0;
+		for (size_t in_order = 0; first < proc_vec.size() and in_order < sorted; ++first) {
+			if (not proc_vec[first].filtered) ++in_order;
 		}
+		const auto rest = std::span(proc_vec).subspan(first);
+		const size_t rest_rows = rows > sorted ? rows - sorted : 0;
+
+		const int field = v_index(sort_vector, sorting);
+		const auto sort_rest = [&](auto comp) {
+			return with_sort_key(field, [&](auto key) { return sort_by_key(rest, key, comp, rest_rows); }, SIZE_MAX);
+		};
+		const size_t done = sorts_descending(field) != reverse ? sort_rest(rng::greater{}) : sort_rest(rng::less{});
 
 		//* When sorting with "cpu lazy" push processes over threshold cpu usage to the front regardless of cumulative usage
 		if (not tree and not reverse and sorting == "cpu lazy") {
@@ -253,156 +343,326 @@ bool set_priority(pid_t pid, int priority) {
 				}
 			}
 		}
+
+		return done == SIZE_MAX ? SIZE_MAX : sorted + done;
 	}
 
-	void tree_sort(vector<tree_proc>& proc_vec, const string& sorting, bool reverse, bool paused, int& c_index, const int index_max, bool collapsed) {
-		if (proc_vec.size() > 1 and not paused) {
-			if (reverse) {
-				switch (v_index(sort_vector, sorting)) {
-				case 3: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().threads < b.entry.get().threads; });	break;
-				case 5: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().mem < b.entry.get().mem; });	break;
-				case 6: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().cpu_p < b.entry.get().cpu_p; });	break;
-				case 7: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().cpu_c < b.entry.get().cpu_c; });	break;
-				case 8: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().gpu_p < b.entry.get().gpu_p; });	break;
-				case 9: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return (a.entry.get().io_read + a.entry.get().io_write) < (b.entry.get().io_read + b.entry.get().io_write); });	break;
-				case 10: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().state > b.entry.get().state; });	break;
-				case 11: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().p_priority > b.entry.get().p_priority; });	break;
-				case 12: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().p_nice > b.entry.get().p_nice; });	break;
-				case 13: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().io_read < b.entry.get().io_read; });	break;
-				case 14: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().io_write < b.entry.get().io_write; });	break;
-				case 15: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().virt_mem < b.entry.get().virt_mem; });	break;
-				case 16: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().ports < b.entry.get().ports; });	break;
-				case 17: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().runtime < b.entry.get().runtime; });	break;
-				case 18: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().cpu_t < b.entry.get().cpu_t; });	break;
-				case 19: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().gpu_time < b.entry.get().gpu_time; });	break;
-				}
-			}
-			else {
-				switch (v_index(sort_vector, sorting)) {
-				case 3: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().threads > b.entry.get().threads; });	break;
-				case 5: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().mem > b.entry.get().mem; });	break;
-				case 6: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().cpu_p > b.entry.get().cpu_p; });	break;
-				case 7: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().cpu_c > b.entry.get().cpu_c; });	break;
-				case 8: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().gpu_p > b.entry.get().gpu_p; });	break;
-				case 9: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return (a.entry.get().io_read + a.entry.get().io_write) > (b.entry.get().io_read + b.entry.get().io_write); });	break;
-				case 10: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().state < b.entry.get().state; });	break;
-				case 11: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().p_priority < b.entry.get().p_priority; });	break;
-				case 12: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().p_nice < b.entry.get().p_nice; });	break;
-				case 13: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().io_read > b.entry.get().io_read; });	break;
-				case 14: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().io_write > b.entry.get().io_write; });	break;
-				case 15: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().virt_mem > b.entry.get().virt_mem; });	break;
-				case 16: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().ports > b.entry.get().ports; });	break;
-				case 17: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().runtime > b.entry.get().runtime; });	break;
-				case 18: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().cpu_t > b.entry.get().cpu_t; });	break;
-				case 19: rng::stable_sort(proc_vec, [](const auto& a, const auto& b) { return a.entry.get().gpu_time > b.entry.get().gpu_time; });	break;
+	filter_cache filter_results;
+
+	struct filter_matcher::compiled_regex {
+		std::regex regex;
+	};
+
+	namespace {
+		constexpr uint8_t fold_ascii(uint8_t c) noexcept { return c >= 'A' and c <= 'Z' ? c + ('a' - 'A') : c; }
+
+		//* Longest run of characters every match of the extended regex <pattern> contains, empty if there's none
+		//* Sets <plain> if <pattern> has no special characters at all and only matches itself
+		string required_literal(std::string_view pattern, bool& plain) {
+			plain = pattern.find_first_of(".[]()*+?{}|^$\\") == std::string_view::npos;
+			if (plain) return string(pattern);
+			//? Alternatives, groups and character classes aren't worth following, no literal is always safe
+			if (pattern.find_first_of("|(") != std::string_view::npos or pattern.find("[:") != std::string_view::npos
+				or pattern.find("[=") != std::string_view::npos or pattern.find("[.") != std::string_view::npos) return {};
+
+			string best, run;
+			const auto end_run = [&] {
+				if (run.size() > best.size()) best = run;
+				run.clear();
+			};
+			for (size_t i = 0; i < pattern.size(); ++i) {
+				const char c = pattern[i];
+				switch (c) {
+					case '*': case '?': case '{':
+						//? The character before might not be there
+						if (not run.empty()) run.pop_back();
+						end_run();
+						if (c == '{' and (i = pattern.find('}', i)) == std::string_view::npos) return best;
+						break;
+					case '+': case '.': case '^': case '$':
+						end_run();
+						break;
+					case '[': {
+						//? A ']' right after the opening bracket is part of the set
+						size_t close = i + 1;
+						if (close < pattern.size() and pattern[close] == '^') ++close;
+						if (close < pattern.size() and pattern[close] == ']') ++close;
+						if ((close = pattern.find(']', close)) == std::string_view::npos) return {};
+						end_run();
+						i = close;
+						break;
+					}
+					case '\\':
+						if (i + 1 >= pattern.size() or std::string_view(".[]()*+?{}|^$\\").find(pattern[i + 1]) == std::string_view::npos) return {};
+						run += pattern[++i];
+						break;
+					default:
+						run += c;
+						break;
 				}
 			}
+			end_run();
+			return best;
 		}
+	}
 
-		for (auto& r : proc_vec) {
-			r.entry.get().tree_index = (collapsed or r.entry.get().filtered ? index_max : c_index++);
-			if (not r.children.empty()) {
-				tree_sort(r.children, sorting, reverse, paused, c_index, (collapsed or r.entry.get().collapsed or r.entry.get().tree_index == (size_t)index_max));
-			}
+	filter_matcher::literal::literal(std::string_view text, bool fold) : needle(text), fold(fold) {
+		if (fold) for (auto& c : needle) c = static_cast<char>(fold_ascii(static_cast<uint8_t>(c)));
+		//? Horspool shifts, how far the window can move when its last byte is a given value
+		const size_t n = needle.size();
+		skip.fill(static_cast<uint8_t>(std::min<size_t>(n, 255)));
+		for (size_t i = 0; i + 1 < n; ++i) {
+			const auto c = static_cast<uint8_t>(needle[i]);
+			const auto shift = static_cast<uint8_t>(std::min<size_t>(n - 1 - i, 255));
+			skip[c] = shift;
+			if (fold and c >= 'a' and c <= 'z') skip[c - ('a' - 'A')] = shift;
 		}
 	}
 
-	auto matches_filter(const proc_info& proc, const std::string& filter) -> bool {
-		if (filter.starts_with("!")) {
-			if (filter.size() == 1) {
-				return true;
-			}
+	bool filter_matcher::literal::found_in(std::string_view haystack) const noexcept {
+		const size_t n = needle.size();
+		if (n == 0) return true;
+		if (haystack.size() < n) return false;
+		if (not fold) return haystack.find(needle) != std::string_view::npos;
+
+		const auto* h = reinterpret_cast<const uint8_t*>(haystack.data());
+		const auto* want = reinterpret_cast<const uint8_t*>(needle.data());
+		for (size_t pos = 0; pos + n <= haystack.size(); pos += skip[h[pos + n - 1]]) {
+			if (fold_ascii(h[pos + n - 1]) != want[n - 1]) continue;
+			size_t i = 0;
+			while (i + 1 < n and fold_ascii(h[pos + i]) == want[i]) ++i;
+			if (i + 1 == n) return true;
+		}
+		return false;
+	}
 
-			// An incomplete regex throws, see issue https://github.com/aristocratos/btop/issues/1133
-			try {
-				std::regex regex { filter.substr(1), std::regex::extended };
-				return std::regex_search(std::to_string(proc.pid), regex) || std::regex_search(proc.name, regex) ||
-							 std::regex_match(proc.cmd, regex) || std::regex_search(proc.user, regex);
-			} catch (std::regex_error& /* unused */) {
-				return false;
-			}
+	filter_matcher::filter_matcher(std::string_view filter) : text(filter) {
+		if (not filter.starts_with('!')) {
+			search = literal(filter, true);
+			digits_only = not filter.empty() and rng::all_of(filter, [](char c) { return c >= '0' and c <= '9'; });
+			return;
 		}
+		is_regex = true;
+		const auto pattern = filter.substr(1);
+		if (pattern.empty()) return;
+		search = literal(required_literal(pattern, literal_only), false);
+		if (literal_only) return;
+
+		// An incomplete regex throws, see issue https://github.com/aristocratos/btop/issues/1133
+		try {
+			regex = std::make_shared<const compiled_regex>(std::regex(string(pattern), std::regex::extended));
+		} catch (std::regex_error& /* unused */) {
+			valid = false;
+		}
+	}
+
+	bool filter_matcher::matches(const proc_info& proc) const {
+		if (not valid) return false;
+		char pid_buf[24];
+		const std::string_view pid(pid_buf, std::to_chars(pid_buf, pid_buf + sizeof(pid_buf), proc.pid).ptr - pid_buf);
 
-		return std::to_string(proc.pid).contains(filter) || s_contains_ic(proc.name, filter) ||
-					 s_contains_ic(proc.cmd, filter) || s_contains_ic(proc.user, filter);
+		if (not is_regex) {
+			return (digits_only and pid.contains(search.needle)) or search.found_in(proc.name)
+				or search.found_in(proc.cmd) or search.found_in(proc.user);
+		}
+		if (text.size() == 1) return true;
+		if (literal_only) {
+			return search.found_in(pid) or search.found_in(proc.name) or proc.cmd == search.needle or search.found_in(proc.user);
+		}
+		const auto& re = regex->regex;
+		const auto search_in = [&](std::string_view field) {
+			return search.found_in(field) and std::regex_search(field.begin(), field.end(), re);
+		};
+		return search_in(pid) or search_in(proc.name) or (search.found_in(proc.cmd) and std::regex_match(proc.cmd.str(), re))
+			or search_in(proc.user);
 	}
 
-	void _tree_gen(proc_info& cur_proc, vector<proc_info>& in_procs, vector<tree_proc>& out_procs,
-		int cur_depth, bool collapsed, const string& filter, bool found, bool no_update, bool should_filter) {
-		bool filtering = false;
+	bool filter_matcher::narrows(const filter_matcher& previous) const noexcept {
+		if (text == previous.text) return true;
+		//? A plain filter containing the last one can only match where the last one did
+		return not is_regex and not previous.is_regex and search.needle.contains(previous.search.needle);
+	}
 
-		//? If filtering, include children of matching processes
-		if (not found and (should_filter or not filter.empty())) {
-			if (!matches_filter(cur_proc, filter)) {
-				filtering = true;
-				cur_proc.filtered = true;
-				filter_found++;
-			}
-			else {
-				found = true;
-				cur_depth = 0;
-			}
+	void filter_cache::set_filter(const string& filter) {
+		if (filter == matcher.filter()) return;
+		filter_matcher next(filter);
+		++generation;
+		match_valid_from = generation;
+		if (not next.narrows(matcher)) {
+			miss_valid_from = generation;
+			results.clear();
 		}
-		else if (cur_proc.filtered) cur_proc.filtered = false;
+		matcher = std::move(next);
+	}
+
+	bool filter_cache::matches(const proc_info& proc) {
+		//? Pids of exited processes pile up if the collector never calls retain()
+		if (results.size() > 1 << 16 and not results.contains(proc.pid)) results.clear();
+		auto& e = results[proc.pid];
+		if (e.generation >= (e.match ? match_valid_from : miss_valid_from) and e.starttime == proc.cpu_s
+			and e.name_size == proc.name.size() and e.cmd_size == proc.cmd.size() and e.user_size == proc.user.size()) return e.match;
+		e = {proc.cpu_s, proc.name.size(), proc.cmd.size(), proc.user.size(), generation, matcher.matches(proc)};
+		return e.match;
+	}
 
-		cur_proc.depth = cur_depth;
+	auto matches_filter(const proc_info& proc, const std::string& filter) -> bool {
+		filter_results.set_filter(filter);
+		return filter_results.matches(proc);
+	}
 
-		//? Set tree index position for process if not filtered out or currently in a collapsed sub-tree
-		out_procs.push_back({ cur_proc, {} });
-		if (not collapsed and not filtering) {
-			cur_proc.tree_index = out_procs.size() - 1;
+	tree_builder process_tree;
+
+	void tree_builder::build(vector<proc_info>& procs, const string& sorting, bool reverse, bool keep_order, const string& filter,
+							 bool no_update, bool should_filter) {
+		prefixes_built = 0;
+		const uint32_t size = static_cast<uint32_t>(procs.size());
+		if (size == 0) return;
+		const bool aggregate = Config::getB("proc_aggregate");
+		const bool filtering = should_filter or not filter.empty();
+
+		//? Children of each process in list order, counted per parent and then placed, without sorting by parent pid
+		slot_of.clear();
+		uint64_t root_ppid = procs[0].ppid;
+		for (uint32_t i = 0; i < size; ++i) {
+			slot_of[procs[i].pid] = i;
+			root_ppid = std::min(root_ppid, procs[i].ppid);
+		}
+		constexpr uint32_t none = UINT32_MAX;
+		parent_of.assign(size, none);
+		child_start.assign(size + 1, 0);
+		roots.clear();
+		for (uint32_t i = 0; i < size; ++i) {
+			if (procs[i].ppid == root_ppid) roots.push_back(i);
+			else if (const auto it = slot_of.find(procs[i].ppid); it != slot_of.end()) {
+				parent_of[i] = it->second;
+				++child_start[it->second + 1];
+			}
+		}
+		for (uint32_t i = 0; i < size; ++i) child_start[i + 1] += child_start[i];
+		children.resize(child_start[size]);
+		next_child.assign(child_start.begin(), child_start.end() - 1);
+		for (uint32_t i = 0; i < size; ++i) {
+			if (parent_of[i] != none) children[next_child[parent_of[i]]++] = i;
+		}
+		//? Processes whose parents never lead to a root, like orphans while the list is paused, aren't part of the tree
+		//? and can't be reached, so neither walk below loops
+
+		//? Filter, depth and collapsed totals, children are added to their parent after their own children
+		const auto enter = [&](uint32_t node, uint32_t depth, bool collapsed, bool found) {
+			auto& p = procs[node];
+			bool filtered_out = false;
+			if (not found and filtering) {
+				if (not matches_filter(p, filter)) {
+					filtered_out = true;
+					p.filtered = true;
+					++filter_found;
+				}
+				else {
+					found = true;
+					depth = 0;
+				}
+			}
+			else if (p.filtered) p.filtered = false;
+			p.depth = depth;
 
 			//? Try to find name of the binary file and append to program name if not the same
-			if (cur_proc.short_cmd.empty() and not cur_proc.cmd.empty()) {
-				std::string_view cmd_view = cur_proc.cmd;
+			if (not collapsed and not filtered_out and p.short_cmd.empty() and not p.cmd.empty()) {
+				std::string_view cmd_view = p.cmd;
 				cmd_view = cmd_view.substr((size_t)0, std::min(cmd_view.find(' '), cmd_view.size()));
 				cmd_view = cmd_view.substr(std::min(cmd_view.find_last_of('/') + 1, cmd_view.size()));
-				cur_proc.short_cmd = string{cmd_view};
+				p.short_cmd = string{cmd_view};
+			}
+			stack.push_back({.node = node, .next = child_start[node], .depth = depth, .collapsed = collapsed, .found = found,
+							 .filtered_out = filtered_out});
+		};
+		const auto add_to = [](proc_info& parent, const proc_info& child) {
+			parent.cpu_p += child.cpu_p;
+			parent.cpu_c += child.cpu_c;
+			parent.mem += child.mem;
+			parent.threads += child.threads;
+		};
+		for (const auto root : roots) {
+			enter(root, 0, false, false);
+			while (not stack.empty()) {
+				if (auto& top = stack.back(); top.next < child_start[top.node + 1]) {
+					const uint32_t child = children[top.next++];
+					auto& cur = procs[top.node];
+					if (top.collapsed and not top.filtered_out) cur.filtered = true;
+					enter(child, top.depth + 1, top.collapsed or cur.collapsed, top.found);
+					continue;
+				}
+				const uint32_t done = stack.back().node;
+				stack.pop_back();
+				if (stack.empty()) break;
+				const auto& up = stack.back();
+				auto& parent = procs[up.node];
+				auto& p = procs[done];
+				if (not no_update and not up.filtered_out and (up.collapsed or parent.collapsed)) {
+					if (p.state != 'X') add_to(parent, p);
+					++filter_found;
+					p.filtered = true;
+				}
+				else if (aggregate and p.state != 'X') add_to(parent, p);
 			}
 		}
-		else {
-			cur_proc.tree_index = in_procs.size();
+
+		//? Each level sorted by the numeric columns, names, commands, users and pids keep the order proc_sorter gave them
+		const int field = v_index(sort_vector, sorting);
+		if (not keep_order and (field == 3 or (field >= 5 and field <= 19))) {
+			const bool descending = sorts_descending(field) != reverse;
+			with_sort_key(field, [&](auto key) {
+				const auto sort_level = [&](std::span<uint32_t> level) {
+					if (level.size() < 2) return;
+					const auto by_key = [&](uint32_t i) { return key(procs[i]); };
+					if (descending) rng::stable_sort(level, rng::greater{}, by_key);
+					else rng::stable_sort(level, rng::less{}, by_key);
+				};
+				sort_level(roots);
+				for (uint32_t i = 0; i < size; ++i) sort_level(std::span(children).subspan(child_start[i], child_start[i + 1] - child_start[i]));
+				return 0;
+			}, 0);
 		}
 
-		//? Recursive iteration over all children
-		for (auto& p : rng::equal_range(in_procs, cur_proc.pid, rng::less{}, &proc_info::ppid)) {
-			if (collapsed and not filtering) {
-				cur_proc.filtered = true;
+		//? Positions and prefixes in the order the tree is shown, a prefix is only built again when it changed
+		const size_t hidden = size;
+		size_t index = 0;
+		const auto visit = [&](uint32_t node, bool is_last, bool collapsed, uint32_t base, uint32_t end) {
+			auto& p = procs[node];
+			p.tree_index = (collapsed or p.filtered ? hidden : index++);
+			if (p.filtered) p.depth = 0;
+
+			const bool has_children = child_start[node + 1] > child_start[node];
+			const std::string_view tail = has_children ? (p.collapsed ? "[+]─" : "[-]─") : (is_last ? " └─" : " ├─");
+			header.resize(end);
+			const std::string_view lead = std::string_view(header).substr(base);
+			if (p.prefix.size() != lead.size() + tail.size() or not p.prefix.starts_with(lead) or not p.prefix.ends_with(tail)) {
+				p.prefix.assign(lead).append(tail);
+				++prefixes_built;
 			}
 
-			_tree_gen(p, in_procs, out_procs.back().children, cur_depth + 1, (collapsed or cur_proc.collapsed), filter, found, no_update, should_filter);
-
-			if (not no_update and not filtering and (collapsed or cur_proc.collapsed)) {
-				//auto& parent = cur_proc;
-				if (p.state != 'X') {
-					cur_proc.cpu_p += p.cpu_p;
-					cur_proc.cpu_c += p.cpu_c;
-					cur_proc.mem += p.mem;
-					cur_proc.threads += p.threads;
+			//? Children of a filtered process start over without a header
+			if (p.filtered) base = end;
+			else header.append(is_last ? "   " : " │ ");
+			stack.push_back({.node = node, .next = child_start[node], .collapsed = collapsed or p.collapsed or p.tree_index == hidden,
+							 .base = base, .end = static_cast<uint32_t>(header.size())});
+		};
+		header.clear();
+		for (size_t r = 0; r < roots.size(); ++r) {
+			visit(roots[r], r + 1 == roots.size(), false, 0, 0);
+			while (not stack.empty()) {
+				auto& top = stack.back();
+				const uint32_t last = child_start[top.node + 1];
+				if (top.next == last) {
+					stack.pop_back();
+					continue;
 				}
-				filter_found++;
-				p.filtered = true;
-			}
-			else if (Config::getB("proc_aggregate") and p.state != 'X') {
-				cur_proc.cpu_p += p.cpu_p;
-				cur_proc.cpu_c += p.cpu_c;
-				cur_proc.mem += p.mem;
-				cur_proc.threads += p.threads;
+				const uint32_t child = children[top.next++];
+				visit(child, top.next == last, top.collapsed, top.base, top.end);
 			}
 		}
-	}
-
-	void _collect_prefixes(tree_proc &t, const bool is_last, const string &header) {
-		const bool is_filtered = t.entry.get().filtered;
-		if (is_filtered) t.entry.get().depth = 0;
 
-		if (!t.children.empty()) t.entry.get().prefix = header + (t.entry.get().collapsed ? "[+]─": "[-]─");
-		else t.entry.get().prefix = header + (is_last ? " └─": " ├─");
-
-		for (auto child = t.children.begin(); child != t.children.end(); ++child) {
-			_collect_prefixes(*child, child == (t.children.end() - 1),
-				is_filtered ? "": header + (is_last ? "   ": " │ "));
-		}
+		//? Final order based on tree index
+		sort_by_key(std::span(procs), [](const proc_info& p) { return p.tree_index; }, rng::less{}, SIZE_MAX);
 	}
 }
 
@@ -23,6 +23,7 @@ tab-size = 4
 #include <cstdint>
 #include <deque>
 #include <filesystem>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -44,6 +45,8 @@ tab-size = 4
 # include <kvm.h>
 #endif
 
+#include "mbtop_intern.hpp"
+
 using std::array;
 using std::atomic;
 using std::deque;
@@ -66,6 +69,7 @@ namespace Global {
 	extern atomic<bool> thread_exception;
 	extern string banner;
 	extern atomic<bool> resized;
+	extern bool debug;  //* Running with --debug, guards building Runner::debug_stat() values
 	extern uid_t real_uid, set_uid;
 	extern atomic<bool> init_conf;
 	extern string overlay;
@@ -88,9 +92,22 @@ namespace Runner {
 	extern string debug_bg;
 
 	void run(const string& box="", bool no_update = false, bool force_redraw = false);
+
+	//* Collect and draw the shown boxes whose own update interval has passed, called from the main loop
+	void update();
+
+	//* Time in milliseconds when the next box is due for update()
+	uint64_t next_update();
+
 	void stop();
 	void thread_trigger();  //? Signal semaphore to wake up runner thread
 
+	//* Forget what's on the terminal after writing to it outside of the runner, the next frame repaints every cell
+	void invalidate_screen();
+
+	//* Set a named line shown below the timings in the debug overlay, does nothing unless running with --debug
+	void debug_stat(const string& name, string value);
+
 }
 
 namespace Tools {
@@ -245,8 +262,8 @@ namespace Gpu {
 	//* Collect gpu stats and temperatures
     auto collect(bool no_update = false) -> vector<gpu_info>&;
 
-	//* Draw contents of gpu box using <gpus> as source
-  	string draw(const gpu_info& gpu, unsigned long index, bool force_redraw, bool data_same);
+	//* Append the contents of gpu box to <out> using <gpus> as source
+  	void draw(string& out, const gpu_info& gpu, unsigned long index, bool force_redraw, bool data_same);
 #else
 	struct gpu_info {
 		bool supported = false;
@@ -292,8 +309,8 @@ namespace Pwr {
 	//? Called from collector thread - acquires mutex internally
 	void update_history(long long cpu_mw, long long gpu_mw, long long ane_mw, size_t max_size = 100);
 
-	//* Draw contents of power panel
-	string draw(bool force_redraw, bool data_same);
+	//* Append the contents of power panel to <out>
+	void draw(string& out, bool force_redraw, bool data_same);
 }
 
 namespace Cpu {
@@ -305,6 +322,8 @@ namespace Cpu {
 	extern vector<string> available_sensors;
 	extern tuple<int, float, long, string> current_bat;
 	extern std::optional<std::string> container_engine;
+	//* Incremented whenever collect() stores a new sample, the runner compares it with the version it last drew
+	extern atomic<uint64_t> data_version;
 
 	struct cpu_info {
 		std::unordered_map<string, deque<long long>> cpu_percent = {
@@ -331,8 +350,8 @@ namespace Cpu {
 	//* Collect cpu stats and temperatures
 	auto collect(bool no_update = false) -> cpu_info&;
 
-	//* Draw contents of cpu box using <cpu> as source
-    string draw(const cpu_info& cpu, const vector<Gpu::gpu_info>& gpu, bool force_redraw = false, bool data_same = false);
+	//* Append the contents of cpu box to <out> using <cpu> as source
+    void draw(string& out, const cpu_info& cpu, const vector<Gpu::gpu_info>& gpu, bool force_redraw = false, bool data_same = false);
 
 	//* Parse /proc/cpu info for mapping of core ids
 	auto get_core_mapping() -> std::unordered_map<int, int>;
@@ -354,6 +373,8 @@ namespace Mem {
 	const array swap_names { "swap_used"s, "swap_free"s };
 	const array vram_names { "vram_used"s, "vram_free"s };
 	extern int disk_ios;
+	//* Incremented whenever collect() stores a new sample
+	extern atomic<uint64_t> data_version;
 
 	struct disk_info {
 		std::filesystem::path dev;
@@ -391,8 +412,8 @@ namespace Mem {
 	//* Collect mem & disks stats
 	auto collect(bool no_update = false) -> mem_info&;
 
-	//* Draw contents of mem box using <mem> as source
-	string draw(const mem_info& mem, bool force_redraw = false, bool data_same = false);
+	//* Append the contents of mem box to <out> using <mem> as source
+	void draw(string& out, const mem_info& mem, bool force_redraw = false, bool data_same = false);
 
 	//* Disk scroll state
 	extern int disk_start, disk_selected, disk_select_max, num_disks;
@@ -419,6 +440,8 @@ namespace Net {
 	extern vector<string> interfaces;
 	extern bool rescale;
 	extern std::unordered_map<string, uint64_t> graph_max;
+	//* Incremented whenever collect() stores a new sample
+	extern atomic<uint64_t> data_version;
 
 	struct net_stat {
 		uint64_t speed{};
@@ -457,12 +480,18 @@ namespace Net {
 	//* Collect net upload/download stats
 	auto collect(bool no_update=false) -> net_info&;
 
-	//* Draw contents of net box using <net> as source
-	string draw(const net_info& net, bool force_redraw = false, bool data_same = false);
+	//* Append the contents of net box to <out> using <net> as source
+	void draw(string& out, const net_info& net, bool force_redraw = false, bool data_same = false);
 }
 
 namespace Proc {
+	using Tools::interned_string;
+
 	extern atomic<int> numpids;
+	//* Processes that started and exited again between the last two updates, only tracked with proc_events on Linux
+	extern atomic<uint64_t> short_lived;
+	//* Incremented whenever collect() reads new values for the process list, not when it only re-sorts or filters
+	extern atomic<uint64_t> data_version;
 
 	extern string box;
 	extern int x, y, width, height, min_width, min_height;
@@ -521,12 +550,11 @@ namespace Proc {
 	//* Container for process information
 	struct proc_info {
 		size_t pid{};
-		string name{};          // defaults to ""
-		string cmd{};           // defaults to ""
+		interned_string name{};	// shared by all processes with the same name
+		interned_string cmd{};
 		string short_cmd{};     // defaults to ""
 		size_t threads{};
-		int name_offset{};
-		string user{};          // defaults to ""
+		interned_string user{};
 		uint64_t mem{};
 		double cpu_p{};         // defaults to = 0.0
 		double cpu_c{};         // defaults to = 0.0
@@ -580,33 +608,115 @@ namespace Proc {
 	//* Update current selection and view, returns -1 if no change otherwise the current selection
 	int selection(const std::string_view cmd_key);
 
-	//* Draw contents of proc box using <plist> as data source
-	string draw(const vector<proc_info>& plist, bool force_redraw = false, bool data_same = false);
-
-	struct tree_proc {
-		std::reference_wrapper<proc_info> entry;
-		vector<tree_proc> children;
-	};
+	//* Append the contents of proc box to <out> using <plist> as data source
+	void draw(string& out, const vector<proc_info>& plist, bool force_redraw = false, bool data_same = false);
 
 	//* Change priority (nice) of pid, returns true on success otherwise false
 	bool set_priority(pid_t pid, int priority);
 
 	//* Sort vector of proc_info's
-	void proc_sorter(vector<proc_info>& proc_vec, const string& sorting, bool reverse, bool tree = false);
+	//* Only the first <rows> unfiltered processes are put in order when there are more, the rest mostly keep their previous
+	//* place. The first <sorted> of them are already in order from the last call and kept as they are.
+	//* Returns the number of unfiltered processes in order, SIZE_MAX when all of them are
+	size_t proc_sorter(vector<proc_info>& proc_vec, const string& sorting, bool reverse, bool tree = false,
+					   size_t rows = SIZE_MAX, size_t sorted = 0);
+
+	//* Process filter compiled once per filter string
+	//* Plain filters match pid, name, command and user case insensitively, filters starting with '!' are extended
+	//* regular expressions searched in pid, name and user and matched against the whole command. Literal text a
+	//* regex can't match without is searched for first and regexes without special characters never run the regex.
+	class filter_matcher {
+	public:
+		//* Substring search for a fixed needle, case insensitive for ascii if <fold>
+		struct literal {
+			string needle;
+			bool fold{};
+			std::array<uint8_t, 256> skip{};
+
+			literal() = default;
+			literal(std::string_view text, bool fold);
+			bool found_in(std::string_view haystack) const noexcept;
+		};
+	private:
+		struct compiled_regex;
+		string text;
+		bool is_regex{}, valid{true};
+		bool digits_only{};			//? Only a plain filter of digits can match in a pid
+		literal search;				//? Plain filter, or the literal part every match of a regex contains
+		bool literal_only{};		//? Regex without special characters, same as looking for <search>
+		std::shared_ptr<const compiled_regex> regex;
+	public:
+		explicit filter_matcher(std::string_view filter = {});
+
+		const string& filter() const noexcept { return text; }
+		bool matches(const proc_info& proc) const;
 
-	//* Recursive sort of process tree
-	void tree_sort(vector<tree_proc>& proc_vec, const string& sorting, bool reverse, bool paused,
-					int& c_index, const int index_max, bool collapsed = false);
+		//* True if every process this matches was also matched by <previous>
+		bool narrows(const filter_matcher& previous) const noexcept;
+	};
+
+	//* Filter results by pid, kept between updates and matched again only for processes that changed
+	//* When the filter is extended while it's typed, processes that didn't match the shorter filter are skipped
+	class filter_cache {
+		struct entry {
+			uint64_t starttime{};
+			size_t name_size{}, cmd_size{}, user_size{};	//? Cheap check for a process that changed without the collector telling
+			uint64_t generation{};
+			bool match{};
+		};
+		filter_matcher matcher;
+		std::unordered_map<size_t, entry> results;
+		uint64_t generation{1};
+		uint64_t match_valid_from{1}, miss_valid_from{1};	//? Oldest generation whose matches and misses still hold
+	public:
+		//* Change the filter, keeps what still holds for the new one
+		void set_filter(const string& filter);
+
+		bool matches(const proc_info& proc);
+
+		//* Forget the result for <pid>, for when its name, command or user changed
+		void forget(size_t pid) { results.erase(pid); }
+
+		//* Forget results for pids where <keep>(pid) is false
+		template <typename F>
+		void retain(F&& keep) { std::erase_if(results, [&](const auto& item) { return not keep(item.first); }); }
 
+		size_t size() const noexcept { return results.size(); }
+	};
+
+	//? Filter results used by matches_filter()
+	extern filter_cache filter_results;
+
+	//* True if <proc> matches <filter>, see filter_matcher, results are cached in filter_results
 	auto matches_filter(const proc_info& proc, const std::string& filter) -> bool;
 
-	//* Generate process tree list
-	void _tree_gen(proc_info& cur_proc, vector<proc_info>& in_procs, vector<tree_proc>& out_procs,
-				   int cur_depth, bool collapsed, const string& filter,
-				   bool found = false, bool no_update = false, bool should_filter = false);
+	//* Process tree built from parent pids without recursion, kept between updates to reuse its buffers
+	class tree_builder {
+		struct frame {
+			uint32_t node{}, next{}, depth{};
+			bool collapsed{}, found{}, filtered_out{};
+			uint32_t base{}, end{};		//? Header of the node's children in header
+		};
+		std::unordered_map<size_t, uint32_t> slot_of;		//? Position of each pid in the list
+		vector<uint32_t> parent_of, child_start, next_child, children, roots;	//? children[child_start[i]..child_start[i + 1]] of position i
+		vector<frame> stack;
+		string header;
+		size_t prefixes_built{};
+	public:
+		//* Order <procs> as a tree below the processes sharing the lowest parent pid. Children follow their parent in the
+		//* order proc_sorter left them, each level sorted by <sorting> unless <keep_order>. Sets depth, filtered, prefix
+		//* and tree_index, hidden processes get a tree_index of procs.size() and go last. With <should_filter> or a
+		//* <filter>, processes not matching it are filtered out unless a parent matched, and unless <no_update> the
+		//* totals of collapsed children are added to their parent
+		void build(vector<proc_info>& procs, const string& sorting, bool reverse, bool keep_order, const string& filter,
+				   bool no_update, bool should_filter);
+
+		//* Prefixes the last build() had to change, the rest were still right from the update before
+		size_t rebuilt_prefixes() const noexcept { return prefixes_built; }
+	};
 
-	//* Build prefixes for tree view
-	void _collect_prefixes(tree_proc& t, bool is_last, const string &header = "");
+	//? Process tree used by collect()
+	extern tree_builder process_tree;
 }
 
 namespace Logs {
@@ -657,8 +767,8 @@ namespace Logs {
 	//* Collect logs from macOS unified logging for the current process
 	void collect();
 
-	//* Draw contents of logs panel
-	string draw(bool force_redraw = false, bool data_same = false);
+	//* Append the contents of logs panel to <out>
+	void draw(string& out, bool force_redraw = false, bool data_same = false);
 
 	//* Clear log buffer and reset state
 	void clear();
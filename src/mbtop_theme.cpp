@@ -18,6 +18,7 @@ tab-size = 4
 
 #include <cmath>
 #include <fstream>
+#include <stdexcept>
 #include <unistd.h>
 
 #include "mbtop_config.hpp"
@@ -47,6 +48,12 @@ namespace Theme {
 	std::unordered_map<string, string> colors;
 	std::unordered_map<string, array<int, 3>> rgbs;
 	std::unordered_map<string, array<string, 101>> gradients;
+	array<string, color_names.size()> color_slots;
+	array<array<string, 101>, gradient_names.size()> gradient_slots;
+
+	gradient_key::gradient_key(std::string_view name) : slot(slot_of(gradient_names, name)) {
+		if (slot == gradient_names.size()) throw std::out_of_range("Unknown theme gradient: " + string(name));
+	}
 
 	//? mbtop Default Theme - Based on Nord palette with enhanced colors
 	const std::unordered_map<string, string> Default_theme = {
@@ -423,6 +430,19 @@ namespace Theme {
 			}
 		}
 
+		//* Copy the generated colors and gradients to their slots
+		void fillSlots() {
+			for (size_t i = 0; i < color_names.size(); ++i) {
+				const auto found = colors.find(string(color_names[i]));
+				color_slots[i] = (found != colors.end()) ? found->second : "";
+			}
+			for (size_t i = 0; i < gradient_names.size(); ++i) {
+				const auto found = gradients.find(string(gradient_names[i]));
+				if (found != gradients.end()) gradient_slots[i] = found->second;
+				else gradient_slots[i].fill("");
+			}
+		}
+
 		//* Load a .theme file from disk
 		auto loadFile(const string& filename) {
 			const fs::path filepath = filename;
@@ -496,6 +516,7 @@ namespace Theme {
 			generateColors((theme == "Default" or theme_path.empty() ? Default_theme : loadFile(theme_path)));
 			generateGradients();
 		}
+		fillSlots();
 		Term::fg = colors.at("main_fg");
 		Term::bg = colors.at("main_bg");
 		Fx::reset = Fx::reset_base + Term::fg + Term::bg;
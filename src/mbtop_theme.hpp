@@ -21,6 +21,7 @@ tab-size = 4
 #include <array>
 #include <filesystem>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 
@@ -58,16 +59,64 @@ namespace Theme {
 	extern std::unordered_map<string, array<int, 3>> rgbs;
 	extern std::unordered_map<string, array<string, 101>> gradients;
 
-	//* Return escape code for color <name>
-	inline const string& c(const string& name) { return colors.at(name); }
+	//* Names of the theme colors, the position of a name is its slot in <color_slots>
+	inline constexpr std::array<std::string_view, 60> color_names = {
+		"main_bg", "main_fg", "title", "hi_fg", "selected_bg", "selected_fg", "inactive_fg", "graph_text",
+		"meter_bg", "proc_misc", "cpu_box", "mem_box", "net_box", "proc_box", "div_line", "temp_start", "temp_mid",
+		"temp_end", "cpu_start", "cpu_mid", "cpu_end", "free_start", "free_mid", "free_end", "cached_start",
+		"cached_mid", "cached_end", "available_start", "available_mid", "available_end", "used_start", "used_mid",
+		"used_end", "disk_used_start", "disk_used_mid", "disk_used_end", "disk_free_start", "disk_free_mid",
+		"disk_free_end", "download_start", "download_mid", "download_end", "upload_start", "upload_mid",
+		"upload_end", "process_start", "process_mid", "process_end", "proc_pause_bg", "proc_follow_bg",
+		"proc_banner_bg", "proc_banner_fg", "followed_bg", "followed_fg", "log_fault", "log_error", "log_info",
+		"log_debug_plus", "log_debug", "tag_blue"
+	};
+
+	//* Names of the generated gradients, the position of a name is its slot in <gradient_slots>
+	inline constexpr std::array<std::string_view, 13> gradient_names = {
+		"temp", "cpu", "free", "cached", "available", "used", "disk_used", "disk_free", "download", "upload",
+		"process", "proc", "proc_color"
+	};
+
+	//* Flat copies of <colors> and <gradients> made by setTheme(), empty where the current theme has no value
+	extern array<string, color_names.size()> color_slots;
+	extern array<array<string, 101>, gradient_names.size()> gradient_slots;
+
+	template <size_t N>
+	constexpr size_t slot_of(const std::array<std::string_view, N>& names, std::string_view name) {
+		for (size_t i = 0; i < N; ++i) if (names[i] == name) return i;
+		return N;
+	}
+
+	//* Interned color name, string literals are resolved to their slot at compile time and unknown names don't compile
+	struct color_key {
+		size_t slot;
+		consteval color_key(const char* name) : slot(slot_of(color_names, name)) {
+			if (slot == color_names.size()) throw "Unknown theme color";
+		}
+	};
+
+	//* Interned gradient name, like color_key but can also be resolved at runtime with the explicit constructor
+	struct gradient_key {
+		size_t slot{};
+		constexpr gradient_key() = default;
+		consteval gradient_key(const char* name) : slot(slot_of(gradient_names, name)) {
+			if (slot == gradient_names.size()) throw "Unknown theme gradient";
+		}
+		//* Throws std::out_of_range for unknown names
+		explicit gradient_key(std::string_view name);
+	};
+
+	//* Return escape code for color <key>
+	inline const string& c(color_key key) { return color_slots[key.slot]; }
 
 	//* Return escape code for color <name>, with fallback if not found
 	inline const string& c_safe(const string& name, const string& fallback = "main_fg") {
 		return colors.contains(name) ? colors.at(name) : colors.at(fallback);
 	}
 
-	//* Return array of escape codes for color gradient <name>
-	inline const array<string, 101>& g(const string& name) { return gradients.at(name); }
+	//* Return array of escape codes for color gradient <key>
+	inline const array<string, 101>& g(gradient_key key) { return gradient_slots[key.slot]; }
 
 	//* Return array of red, green and blue in decimal for color <name>
 	inline const std::array<int, 3>& dec(const string& name) { return rgbs.at(name); }
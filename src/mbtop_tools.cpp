@@ -16,9 +16,11 @@ indent = tab
 tab-size = 4
 */
 
+#include <bit>
 #include <chrono>
 #include <cmath>
 
+#include <cstring>
 #include <ctime>
 #include <filesystem>
 #include <fstream>
@@ -29,8 +31,18 @@ tab-size = 4
 #include <thread>
 #include <utility>
 #include <cstdlib>
+#include <limits>
+#include <new>
+#include <optional>
+
+#if defined(__SSE2__) or defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) and defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 #include <fcntl.h>
+#include <signal.h>
 #include <sys/ioctl.h>
 #include <termios.h>
 #include <unistd.h>
@@ -45,6 +57,7 @@ using std::cout;
 using std::floor;
 using std::flush;
 using std::max;
+using std::min;
 using std::string_view;
 using std::to_string;
 
@@ -196,30 +209,225 @@ namespace Term {
 
 //? --------------------------------------------------- FUNCTIONS -----------------------------------------------------
 
-// ! Disabled due to issue when compiling with musl, reverted back to using regex
-// namespace Fx {
-// 	string uncolor(const string& s) {
-// 		string out = s;
-// 		for (size_t offset = 0, start_pos = 0, end_pos = 0;;) {
-// 			start_pos = (offset == 0) ? out.find('\x1b') : offset;
-// 			if (start_pos == string::npos)
-// 				break;
-// 			offset = start_pos + 1;
-// 			end_pos = out.find('m', offset);
-// 			if (end_pos == string::npos)
-// 				break;
-// 			else if (auto next_pos = out.find('\x1b', offset); not isdigit(out[end_pos - 1]) or end_pos > next_pos) {
-// 			 	offset = next_pos;
-// 				continue;
-// 			}
-
-// 			out.erase(start_pos, (end_pos - start_pos)+1);
-// 			offset = 0;
-// 		}
-// 		out.shrink_to_fit();
-// 		return out;
-// 	}
-// }
+namespace Fx {
+	size_t escape_len(string_view s, bool color_only) noexcept {
+		const auto is_digit = [](char c) { return c >= '0' and c <= '9'; };
+		if (s.size() < 4 or s[0] != '\x1b' or s[1] != '[' or not is_digit(s[2])) return 0;
+
+		//? Up to five fields of digits, the second can only be one digit long when all four separators are used
+		int separators = 0;
+		size_t second_len = 0, pos = 3;
+		for (; pos < s.size(); ++pos) {
+			if (s[pos] == ';') {
+				if (++separators > 4) return 0;
+			}
+			else if (is_digit(s[pos])) {
+				if (separators == 1) ++second_len;
+			}
+			else break;
+		}
+		if (pos == s.size() or (separators == 4 and second_len > 1)) return 0;
+
+		const char final = s[pos];
+		if (final == 'm' or (not color_only and "fsuCDAB"sv.find(final) != string_view::npos)) return pos + 1;
+		return 0;
+	}
+
+	//* Copy <s> without the escape sequences matched by escape_len(), memchr() skips the plain text in between
+	static string strip_escapes(string_view s, bool color_only) {
+		string out;
+		out.reserve(s.size());
+		size_t pos = 0;
+		while (pos < s.size()) {
+			const auto* esc = static_cast<const char*>(std::memchr(s.data() + pos, '\x1b', s.size() - pos));
+			const size_t start = (esc == nullptr ? s.size() : static_cast<size_t>(esc - s.data()));
+			out.append(s.data() + pos, start - pos);
+			if (start == s.size()) break;
+			const size_t len = escape_len(s.substr(start), color_only);
+			if (len == 0) out += '\x1b';
+			pos = start + max(len, (size_t)1);
+		}
+		return out;
+	}
+
+	string uncolor(string_view s) {
+		return strip_escapes(s, true);
+	}
+
+	string unescape(string_view s) {
+		return strip_escapes(s, false);
+	}
+}
+
+//? ------------------------------------------------ UTF-8 KERNELS ----------------------------------------------------
+
+//* Block wise UTF-8 scanning for ulen(), wide_ulen(), uresize() and luresize(), each block of bytes is reduced to bitmasks
+//* with AVX2, SSE2 or NEON when the target has them and a plain loop otherwise
+namespace {
+#if defined(__AVX2__)
+	constexpr size_t simd_block = 32;
+
+	struct block_masks {
+		uint32_t high;		//? Bytes >= 0x80
+		uint32_t cont;		//? Continuation bytes 0x80-0xBF
+		uint32_t ctrl;		//? Control characters < 0x20 and 0x7F, for ASCII bytes
+		uint32_t lead4;		//? Bytes >= 0xF0
+	};
+
+	inline block_masks masks(const char* p) {
+		const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+		const __m256i zero = _mm256_setzero_si256();
+		const auto mask = [](__m256i m) { return static_cast<uint32_t>(_mm256_movemask_epi8(m)); };
+		return {
+			mask(v),
+			mask(_mm256_cmpgt_epi8(_mm256_set1_epi8(-64), v)),
+			mask(_mm256_or_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), v), _mm256_cmpeq_epi8(v, _mm256_set1_epi8(0x7F)))),
+			mask(_mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(-17)), _mm256_cmpgt_epi8(zero, v))),
+		};
+	}
+#elif defined(__SSE2__)
+	constexpr size_t simd_block = 16;
+
+	struct block_masks {
+		uint32_t high, cont, ctrl, lead4;
+	};
+
+	inline block_masks masks(const char* p) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+		const __m128i zero = _mm_setzero_si128();
+		const auto mask = [](__m128i m) { return static_cast<uint32_t>(_mm_movemask_epi8(m)); };
+		return {
+			mask(v),
+			mask(_mm_cmplt_epi8(v, _mm_set1_epi8(-64))),
+			mask(_mm_or_si128(_mm_cmplt_epi8(v, _mm_set1_epi8(0x20)), _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7F)))),
+			mask(_mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(-17)), _mm_cmplt_epi8(v, zero))),
+		};
+	}
+#elif defined(__ARM_NEON) and defined(__aarch64__)
+	constexpr size_t simd_block = 16;
+
+	struct block_masks {
+		uint32_t high, cont, ctrl, lead4;
+	};
+
+	inline block_masks masks(const char* p) {
+		const int8x16_t v = vld1q_s8(reinterpret_cast<const int8_t*>(p));
+		const auto mask = [](uint8x16_t m) {
+			static const uint8x16_t bits = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+			const uint8x16_t set = vandq_u8(m, bits);
+			return static_cast<uint32_t>(vaddv_u8(vget_low_u8(set))) | (static_cast<uint32_t>(vaddv_u8(vget_high_u8(set))) << 8);
+		};
+		return {
+			mask(vcltzq_s8(v)),
+			mask(vcltq_s8(v, vdupq_n_s8(-64))),
+			mask(vorrq_u8(vcltq_s8(v, vdupq_n_s8(0x20)), vceqq_s8(v, vdupq_n_s8(0x7F)))),
+			mask(vandq_u8(vcgtq_s8(v, vdupq_n_s8(-17)), vcltzq_s8(v))),
+		};
+	}
+#else
+	constexpr size_t simd_block = 16;
+
+	struct block_masks {
+		uint32_t high, cont, ctrl, lead4;
+	};
+
+	inline block_masks masks(const char* p) {
+		block_masks m{};
+		for (size_t i = 0; i < simd_block; ++i) {
+			const auto c = static_cast<unsigned char>(p[i]);
+			m.high |= uint32_t{c >= 0x80} << i;
+			m.cont |= uint32_t{(c & 0xC0) == 0x80} << i;
+			m.ctrl |= uint32_t{c < 0x20 or c == 0x7F} << i;
+			m.lead4 |= uint32_t{c >= 0xF0} << i;
+		}
+		return m;
+	}
+#endif
+
+	inline bool is_cont(unsigned char c) { return (c & 0xC0) == 0x80; }
+
+	//* Decode the multi byte sequence at the start of <s> into <cp> and return its length, 0 if it isn't valid
+	//* Accepts what the glibc UTF-8 decoder accepts: no overlong forms or surrogates, five and six byte forms allowed
+	size_t decode(std::string_view s, uint32_t& cp) {
+		const auto lead = static_cast<unsigned char>(s[0]);
+		size_t len;
+		uint32_t min;
+		if (lead < 0xC2) return 0;
+		else if (lead < 0xE0) { len = 2; min = 0x80; cp = lead & 0x1F; }
+		else if (lead < 0xF0) { len = 3; min = 0x800; cp = lead & 0x0F; }
+		else if (lead < 0xF8) { len = 4; min = 0x10000; cp = lead & 0x07; }
+		else if (lead < 0xFC) { len = 5; min = 0x200000; cp = lead & 0x03; }
+		else if (lead < 0xFE) { len = 6; min = 0x4000000; cp = lead & 0x01; }
+		else return 0;
+
+		if (s.size() < len) return 0;
+		for (size_t i = 1; i < len; ++i) {
+			const auto c = static_cast<unsigned char>(s[i]);
+			if (not is_cont(c)) return 0;
+			cp = (cp << 6) | (c & 0x3F);
+		}
+		if (cp < min or (cp >= 0xD800 and cp <= 0xDFFF)) return 0;
+		return len;
+	}
+
+	//* Terminal columns used by an ASCII character
+	inline size_t ascii_width(unsigned char c) { return c >= 0x20 and c != 0x7F; }
+
+	//* The longest prefix of a string that fits in a number of columns
+	struct fit_prefix {
+		size_t bytes;
+		size_t width;
+	};
+
+	//* Longest prefix of <s> that fits in <max_width> columns, nullopt if <s> isn't valid UTF-8
+	//* Blocks of ASCII are added a block at a time, anything else one code point at a time through the width tables
+	std::optional<fit_prefix> wide_prefix(std::string_view s, size_t max_width) {
+		size_t width = 0, pos = 0;
+		std::optional<fit_prefix> fit;
+		while (pos < s.size()) {
+			if (not fit) {
+				for (; pos + simd_block <= s.size(); pos += simd_block) {
+					const auto m = masks(s.data() + pos);
+					const size_t block_width = simd_block - std::popcount(m.ctrl);
+					if (m.high != 0 or width + block_width > max_width) break;
+					width += block_width;
+				}
+				if (pos == s.size()) break;
+			}
+			else {
+				//? Past the cut only validity matters, skip ASCII blocks
+				while (pos + simd_block <= s.size() and masks(s.data() + pos).high == 0) pos += simd_block;
+				if (pos == s.size()) break;
+			}
+
+			uint32_t cp = static_cast<unsigned char>(s[pos]);
+			size_t len = 1, char_width;
+			if (cp < 0x80) char_width = ascii_width(cp);
+			else if ((len = decode(s.substr(pos), cp)) == 0) return std::nullopt;
+			else char_width = widechar_wcwidth(cp);
+
+			if (not fit and width + char_width > max_width) fit = fit_prefix{pos, width};
+			if (not fit) width += char_width;
+			pos += len;
+		}
+		return fit.value_or(fit_prefix{s.size(), width});
+	}
+
+	//* Byte offset of code point number <n> in <s>, the size of <s> if it has fewer code points
+	size_t offset_of(std::string_view s, size_t n) {
+		size_t seen = 0, pos = 0;
+		for (; pos + simd_block <= s.size(); pos += simd_block) {
+			const size_t chars = simd_block - std::popcount(masks(s.data() + pos).cont);
+			if (seen + chars > n) break;
+			seen += chars;
+		}
+		for (; pos < s.size(); ++pos) {
+			if (is_cont(s[pos])) continue;
+			if (seen++ == n) return pos;
+		}
+		return s.size();
+	}
+}
 
 namespace Tools {
 
@@ -265,34 +473,25 @@ namespace Tools {
 		return str;
 	}
 
-	size_t wide_ulen(const std::string_view str) {
-		if (str.empty())
-			return 0;
-		unsigned int chars = 0;
-
-		const char* str_data = &str.data()[0];
-			size_t w_len = 1 + std::mbstowcs(nullptr, str_data, 0);
-		if (w_len <= 1)
-			return ulen(str);
-		vector<wchar_t> w_str(w_len);
-		std::mbstowcs(&w_str[0], str_data, w_len);
-
-		for (auto c : w_str) {
-			chars += widechar_wcwidth(c);
-
-		}
-
+	size_t ulen(const std::string_view str, bool wide) {
+		if (wide) return wide_ulen(str);
+		size_t chars = 0, pos = 0;
+		for (; pos + simd_block <= str.size(); pos += simd_block)
+			chars += simd_block - std::popcount(masks(str.data() + pos).cont);
+		for (; pos < str.size(); ++pos)
+			chars += not is_cont(str[pos]);
 		return chars;
 	}
 
-	size_t wide_ulen(const vector<wchar_t> w_str) {
-		unsigned int chars = 0;
-
-		for (auto c : w_str) {
-			chars += widechar_wcwidth(c);
-		}
+	size_t wide_ulen(const std::string_view str) {
+		//? Not valid UTF-8, count code points instead
+		if (const auto fit = wide_prefix(str, std::numeric_limits<size_t>::max()))
+			return fit->width;
+		return ulen(str);
+	}
 
-		return chars;
+	int char_width(uint32_t c) {
+		return widechar_wcwidth(c);
 	}
 
 	string uresize(string str, const size_t len, bool wide) {
@@ -300,41 +499,12 @@ namespace Tools {
 			return "";
 
 		if (wide) {
-			const char* str_data = &str.data()[0];
-			size_t w_len = 1 + std::mbstowcs(nullptr, str_data, 0);
-			if (w_len <= 1)
-				return uresize(str, len, false);
-			vector<wchar_t> w_str(w_len);
-			std::mbstowcs(&w_str[0], str_data, w_len);
-
-			//? Pop characters until display width fits, but preserve null terminator
-			while (w_str.size() > 1 and wide_ulen(w_str) > len) {
-				w_str.pop_back();
-				w_str.back() = L'\0';  //? Ensure null terminator at end
-			}
-
-			//? Calculate required buffer size for UTF-8 output (wcstombs returns bytes needed)
-			size_t mb_len = std::wcstombs(nullptr, &w_str[0], 0);
-			if (mb_len == static_cast<size_t>(-1)) {
-				//? Conversion error, fall back to non-wide resize
-				return uresize(str, len, false);
-			}
-			string n_str;
-			n_str.resize(mb_len);
-			std::wcstombs(&n_str[0], &w_str[0], mb_len);
-
-			return n_str;
-
-		}
-		else {
-			for (size_t x = 0, i = 0; i < str.size(); i++) {
-				if ((static_cast<unsigned char>(str.at(i)) & 0xC0) != 0x80) x++;
-				if (x >= len + 1) {
-					str.resize(i);
-					break;
-				}
+			if (const auto fit = wide_prefix(str, len)) {
+				str.resize(fit->bytes);
+				return str;
 			}
 		}
+		str.resize(offset_of(str, len));
 		str.shrink_to_fit();
 		return str;
 	}
@@ -343,17 +513,26 @@ namespace Tools {
 		if (len < 1 or str.empty())
 			return "";
 
-		for (size_t x = 0, last_pos = 0, i = str.size() - 1; i > 0 ; i--) {
-			if (wide and static_cast<unsigned char>(str.at(i)) > 0xef) {
+		//? Counted back from the end, a byte >= 0xF0 (four byte sequences, mostly emoji) counts as two with <wide>
+		//? Whole blocks are skipped while they can't reach <len>, index 0 is never looked at
+		size_t x = 0, i = str.size();
+		for (; i >= simd_block + 1; i -= simd_block) {
+			const auto m = masks(str.data() + i - simd_block);
+			const size_t count = simd_block - std::popcount(m.cont) + (wide ? std::popcount(m.lead4) : 0);
+			if (x + count >= len) break;
+			x += count;
+		}
+		for (size_t last_pos = 0; i-- > 1;) {
+			if (wide and static_cast<unsigned char>(str[i]) > 0xef) {
 				x += 2;
-				last_pos = max((size_t)0, i - 1);
+				last_pos = i - 1;
 			}
-			else if ((static_cast<unsigned char>(str.at(i)) & 0xC0) != 0x80) {
+			else if (not is_cont(str[i])) {
 				x++;
 				last_pos = i;
 			}
 			if (x >= len) {
-				str = str.substr(last_pos);
+				str.erase(0, last_pos);
 				str.shrink_to_fit();
 				break;
 			}
@@ -383,52 +562,49 @@ namespace Tools {
 		return str;
 	}
 
-	string ljust(string str, const size_t x, bool utf, bool wide, bool limit) {
-		if (utf) {
-			if (limit and ulen(str, wide) > x)
-				return uresize(str, x, wide);
-
-			return str + string(max((int)(x - ulen(str, wide)), 0), ' ');
-		}
-		else {
+	//* Columns used by <str> when it fits in <x>, nullopt if it doesn't fit and was cut to <x> columns
+	static std::optional<size_t> fit_width(string& str, const size_t x, bool utf, bool wide, bool limit) {
+		if (not utf) {
 			if (limit and str.size() > x) {
 				str.resize(x);
-				return str;
+				return std::nullopt;
 			}
-			return str + string(max((int)(x - str.size()), 0), ' ');
+			return str.size();
 		}
+		if (wide and limit and x > 0) {
+			if (const auto fit = wide_prefix(str, x)) {
+				if (fit->bytes == str.size()) return fit->width;
+				str.resize(fit->bytes);
+				return std::nullopt;
+			}
+		}
+		const size_t len = ulen(str, wide);
+		if (limit and len > x) {
+			str = uresize(str, x, wide);
+			return std::nullopt;
+		}
+		return len;
 	}
 
-	string rjust(string str, const size_t x, bool utf, bool wide, bool limit) {
-		if (utf) {
-			if (limit and ulen(str, wide) > x)
-				return uresize(str, x, wide);
+	string ljust(string str, const size_t x, bool utf, bool wide, bool limit) {
+		if (const auto len = fit_width(str, x, utf, wide, limit); len and *len < x)
+			str.append(x - *len, ' ');
+		return str;
+	}
 
-			return string(max((int)(x - ulen(str, wide)), 0), ' ') + str;
-		}
-		else {
-			if (limit and str.size() > x) {
-				str.resize(x);
-				return str;
-			};
-			return string(max((int)(x - str.size()), 0), ' ') + str;
-		}
+	string rjust(string str, const size_t x, bool utf, bool wide, bool limit) {
+		if (const auto len = fit_width(str, x, utf, wide, limit); len and *len < x)
+			str.insert(0, x - *len, ' ');
+		return str;
 	}
 
 	string cjust(string str, const size_t x, bool utf, bool wide, bool limit) {
-		if (utf) {
-			if (limit and ulen(str, wide) > x)
-				return uresize(str, x, wide);
-
-			return string(max((int)ceil((double)(x - ulen(str, wide)) / 2), 0), ' ') + str + string(max((int)floor((double)(x - ulen(str, wide)) / 2), 0), ' ');
-		}
-		else {
-			if (limit and str.size() > x) {
-				str.resize(x);
-				return str;
-			}
-			return string(max((int)ceil((double)(x - str.size()) / 2), 0), ' ') + str + string(max((int)floor((double)(x - str.size()) / 2), 0), ' ');
+		if (const auto len = fit_width(str, x, utf, wide, limit); len and *len < x) {
+			const size_t pad = x - *len;
+			str.insert(0, (pad + 1) / 2, ' ');
+			str.append(pad / 2, ' ');
 		}
+		return str;
 	}
 
 	string trans(const string& str) {
@@ -640,6 +816,153 @@ namespace Tools {
 		this->atom.notify_all();
 	}
 
+	WorkerPool::WorkerPool(size_t threads) : wanted(threads) {}
+
+	WorkerPool::~WorkerPool() { stop_workers(); }
+
+	void WorkerPool::worker_loop() {
+		//? Signals should only ever be delivered to the main and runner threads
+		sigset_t mask;
+		sigfillset(&mask);
+		pthread_sigmask(SIG_BLOCK, &mask, nullptr);
+
+		for (;;) {
+			std::packaged_task<void()> task;
+			{
+				std::unique_lock lock(mtx);
+				cv.wait(lock, [this] { return stopping or not tasks.empty(); });
+				if (tasks.empty()) return;
+				task = std::move(tasks.front());
+				tasks.pop_front();
+			}
+			task();
+		}
+	}
+
+	void WorkerPool::start_workers() {
+		workers.reserve(wanted);
+		while (workers.size() < wanted) workers.emplace_back(&WorkerPool::worker_loop, this);
+	}
+
+	void WorkerPool::stop_workers() {
+		{
+			std::lock_guard lock(mtx);
+			stopping = true;
+		}
+		cv.notify_all();
+		for (auto& worker : workers) worker.join();
+		workers.clear();
+		stopping = false;
+	}
+
+	void WorkerPool::resize(size_t threads) {
+		if (threads == wanted) return;
+		if (threads < workers.size()) stop_workers();
+		wanted = threads;
+	}
+
+	auto WorkerPool::submit(std::function<void()> task) -> std::future<void> {
+		std::packaged_task<void()> packaged(std::move(task));
+		auto future = packaged.get_future();
+		if (wanted == 0) {
+			packaged();
+			return future;
+		}
+		if (workers.size() < wanted) start_workers();
+		{
+			std::lock_guard lock(mtx);
+			tasks.push_back(std::move(packaged));
+		}
+		cv.notify_one();
+		return future;
+	}
+
+	void WorkerPool::parallel_for(size_t count, const std::function<void(size_t, size_t)>& fn, size_t min_shard) {
+		if (count == 0) return;
+		const size_t shards = std::clamp<size_t>(count / max<size_t>(min_shard, 1), 1, wanted + 1);
+		if (shards == 1) {
+			fn(0, count);
+			return;
+		}
+
+		//? Even split with the remainder spread over the first shards, so shard boundaries only depend on count and shards
+		const size_t base = count / shards, extra = count % shards;
+		vector<std::future<void>> pending;
+		pending.reserve(shards - 1);
+		size_t begin = 0;
+		for (size_t i = 0; i < shards - 1; ++i) {
+			const size_t end = begin + base + (i < extra ? 1 : 0);
+			pending.push_back(submit([&fn, begin, end] { fn(begin, end); }));
+			begin = end;
+		}
+
+		std::exception_ptr error;
+		try { fn(begin, count); }
+		catch (...) { error = std::current_exception(); }
+
+		for (auto& shard : pending) {
+			try { shard.get(); }
+			catch (...) { if (not error) error = std::current_exception(); }
+		}
+		if (error) std::rethrow_exception(error);
+	}
+
+	TimerWheel::TimerWheel(size_t slot_count, uint64_t tick) : slots(max<size_t>(slot_count, 1)), tick(max<uint64_t>(tick, 1)) {}
+
+	void TimerWheel::unlink(size_t id) {
+		if (not armed(id)) return;
+		auto& slot = slots[slot_of(timers[id].due)];
+		slot.erase(std::ranges::find(slot, id));
+		timers[id].armed = false;
+	}
+
+	void TimerWheel::set(size_t id, uint64_t interval, uint64_t due) {
+		if (id >= timers.size()) timers.resize(id + 1);
+		unlink(id);
+		//? A deadline already passed is due at the last expire(), in a slot behind it neither next_due() nor expire() would look
+		due = max(due, last);
+		timers[id] = {due, max<uint64_t>(interval, 1), true};
+		slots[slot_of(due)].push_back(id);
+	}
+
+	void TimerWheel::cancel(size_t id) {
+		unlink(id);
+	}
+
+	uint64_t TimerWheel::next_due() const {
+		//? Walk one revolution from the current slot, the first slot holding a timer due within that revolution has the answer
+		const uint64_t start = last / tick;
+		for (uint64_t t = start; t < start + slots.size(); ++t) {
+			uint64_t best = UINT64_MAX;
+			for (const auto id : slots[t % slots.size()])
+				if (timers[id].due / tick <= t) best = min(best, timers[id].due);
+			if (best != UINT64_MAX) return best;
+		}
+		//? Everything is at least a revolution away
+		uint64_t best = UINT64_MAX;
+		for (const auto& timer : timers)
+			if (timer.armed) best = min(best, timer.due);
+		return best;
+	}
+
+	void TimerWheel::expire(uint64_t now, vector<size_t>& fired) {
+		const size_t first = fired.size();
+		//? Visit the slots passed since the last call, all of them once if that's more than a revolution
+		const uint64_t from = min(last, now) / tick, to = now / tick;
+		const uint64_t steps = min<uint64_t>(to - from + 1, slots.size());
+		for (uint64_t t = to + 1 - steps; t <= to; ++t)
+			for (const auto id : slots[t % slots.size()])
+				if (timers[id].due <= now) fired.push_back(id);
+		last = now;
+
+		const auto new_fired = std::ranges::subrange(fired.begin() + first, fired.end());
+		std::ranges::sort(new_fired);
+		for (const auto id : new_fired) {
+			const auto& timer = timers[id];
+			set(id, timer.interval, timer.due + ((now - timer.due) / timer.interval + 1) * timer.interval);
+		}
+	}
+
 	string readfile(const std::filesystem::path& path, const string& fallback) {
 		if (not fs::exists(path)) return fallback;
 		string out;
@@ -791,3 +1114,33 @@ namespace Tools {
 		#endif
 	}
 }
+
+#ifdef MBTOP_ALLOC_STATS
+//? Global operator new and delete pass through to malloc and free, counting the allocations made by each thread
+static thread_local uint64_t allocations{};
+
+namespace Tools {
+	uint64_t thread_allocations() noexcept {
+		return allocations;
+	}
+}
+
+void* operator new(std::size_t size) {
+	++allocations;
+	if (size == 0) size = 1;
+	while (true) {
+		if (void* ptr = std::malloc(size)) return ptr;
+		if (auto handler = std::get_new_handler()) handler();
+		else throw std::bad_alloc();
+	}
+}
+
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+
+//? The sized form forwards to the unsized one like the default does, so only one function pairs free with new
+void operator delete(void* ptr, std::size_t) noexcept {
+	::operator delete(ptr);
+}
+#endif
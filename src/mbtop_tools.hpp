@@ -27,16 +27,21 @@ tab-size = 4
 #include <atomic>
 #include <charconv>          // for std::from_chars (safe numeric conversion)
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
+#include <functional>
+#include <future>
 #include <limits.h>
+#include <mutex>
 #include <pthread.h>
 #include <ranges>
-#include <regex>
 #include <string>
 #include <string_view>
 #include <thread>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 #ifdef BTOP_DEBUG
@@ -88,15 +93,16 @@ namespace Fx {
 	//* Reset text effects and restore theme foregrund and background color
 	extern string reset;
 
-	//* Regex for matching color, style and cursor move escape sequences
-	const std::regex escape_regex("\033\\[\\d+;?\\d?;?\\d*;?\\d*;?\\d*(m|f|s|u|C|D|A|B){1}");
-
-	//* Regex for matching only color and style escape sequences
-	const std::regex color_regex("\033\\[\\d+;?\\d?;?\\d*;?\\d*;?\\d*(m){1}");
+	//* Length of the color, style or cursor move escape sequence at the start of <s>, 0 if there is none
+	//* Matches ESC [ followed by digits with up to four ';' and one of m, f, s, u, C, D, A, B, or only m if <color_only>
+	//* (the sequences matched by the regex \033\[\d+;?\d?;?\d*;?\d*;?\d*(m|f|s|u|C|D|A|B) used before)
+	size_t escape_len(string_view s, bool color_only = false) noexcept;
 
 	//* Return a string with all colors and text styling removed
-	inline string uncolor(const string& s) { return std::regex_replace(s, color_regex, ""); }
-	// string uncolor(const string& s);
+	string uncolor(string_view s);
+
+	//* Return a string with all colors, text styling and cursor moves removed
+	string unescape(string_view s);
 
 }
 
@@ -170,13 +176,14 @@ namespace Tools {
 		virtual std::string do_grouping() const override { return "\03"; }
 	};
 
+	//* Number of terminal columns needed for UTF8 string <str>, number of UTF8 characters if it isn't valid UTF8
 	size_t wide_ulen(const std::string_view str);
-	size_t wide_ulen(const vector<wchar_t> w_str);
+
+	//* Number of terminal columns used by unicode code point <c>, 0 for combining and non printable characters
+	int char_width(uint32_t c);
 
 	//* Return number of UTF8 characters in a string (wide=true for column size needed on terminal)
-	inline size_t ulen(const std::string_view str, bool wide = false) {
-		return (wide ? wide_ulen(str) : std::ranges::count_if(str, [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; }));
-	}
+	size_t ulen(const std::string_view str, bool wide = false);
 
 	//* Resize a string consisting of UTF8 characters (only reduces size)
 	string uresize(const string str, const size_t len, bool wide = false);
@@ -251,6 +258,11 @@ namespace Tools {
 		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 	}
 
+#ifdef MBTOP_ALLOC_STATS
+	//* Number of heap allocations made by the calling thread so far, counted by the global operator new in mbtop_tools.cpp
+	uint64_t thread_allocations() noexcept;
+#endif
+
 	//* Check if a string is a valid bool value
 	inline bool isbool(const std::string_view str) {
 		return is_in(str, "true", "false", "True", "False");
@@ -317,6 +329,16 @@ namespace Tools {
 	//* Add std::string operator * : Repeat string <str> <n> number of times
 	std::string operator*(const string& str, int64_t n);
 
+	//* Append <parts> to <out> in order, same as out += a + b + ... without building the concatenated temporaries
+	template <typename... T>
+	void append(string& out, const T&... parts) {
+		auto add = [&out]<typename P>(const P& part) {
+			if constexpr (std::is_same_v<P, char>) out += part;
+			else out.append(std::string_view(part));
+		};
+		(add(parts), ...);
+	}
+
 	template <typename K, typename T>
 #ifdef BTOP_DEBUG
 	const T& safeVal(const std::unordered_map<K, T>& map, const K& key, const T& fallback = T{}, std::source_location loc = std::source_location::current()) {
@@ -399,6 +421,78 @@ namespace Tools {
 		atomic_lock& operator=(atomic_lock&& other) = delete;
 	};
 
+	//* Bounded pool of worker threads, threads are started lazily and block all signals
+	//* Usage example: Tools::WorkerPool pool(3); pool.parallel_for(items.size(), [&](size_t begin, size_t end) { ... });
+	class WorkerPool {
+		vector<std::thread> workers;
+		std::deque<std::packaged_task<void()>> tasks;
+		std::mutex mtx;
+		std::condition_variable cv;
+		size_t wanted{};
+		bool stopping{};
+
+		void worker_loop();
+		void start_workers();
+		void stop_workers();
+	public:
+		explicit WorkerPool(size_t threads = 0);
+		~WorkerPool();
+		WorkerPool(const WorkerPool& other) = delete;
+		WorkerPool& operator=(const WorkerPool& other) = delete;
+		WorkerPool(WorkerPool&& other) = delete;
+		WorkerPool& operator=(WorkerPool&& other) = delete;
+
+		//* Number of worker threads, not counting the calling thread
+		size_t size() const noexcept { return wanted; }
+
+		//* Change the number of worker threads, waits for queued tasks to finish if shrinking
+		void resize(size_t threads);
+
+		//* Queue a task and return a future that is ready when it has run, runs inline if the pool has no threads
+		auto submit(std::function<void()> task) -> std::future<void>;
+
+		//* Split [0, count) into at most size() + 1 contiguous shards of at least <min_shard> items and call fn(begin, end) for each
+		//* The calling thread runs the last shard itself, returns when all shards are done and rethrows the first exception
+		void parallel_for(size_t count, const std::function<void(size_t, size_t)>& fn, size_t min_shard = 1);
+	};
+
+	//* Hashed timer wheel of repeating timers identified by a small index, each slot covers <tick> milliseconds
+	//* A timer fires every <interval> ms counted from its first due time, periods missed while nobody called expire() are skipped
+	//* Usage example: wheel.set(0, 250, now); ... wheel.expire(time_ms(), fired); sleep until wheel.next_due()
+	class TimerWheel {
+		struct timer {
+			uint64_t due{};
+			uint64_t interval{};
+			bool armed{};
+		};
+		vector<timer> timers;
+		vector<vector<size_t>> slots;
+		uint64_t tick;
+		uint64_t last{};	//? Time passed to the last expire()
+
+		size_t slot_of(uint64_t time) const noexcept { return (time / tick) % slots.size(); }
+		void unlink(size_t id);
+	public:
+		explicit TimerWheel(size_t slot_count = 256, uint64_t tick = 10);
+
+		//* Arm timer <id> to first fire at <due> and then every <interval> ms, replaces any earlier setting of <id>
+		//* A <due> before the last expire() is moved up to it, so the timer fires on the next expire()
+		void set(size_t id, uint64_t interval, uint64_t due);
+
+		//* Disarm timer <id>
+		void cancel(size_t id);
+
+		bool armed(size_t id) const noexcept { return id < timers.size() and timers[id].armed; }
+		uint64_t interval(size_t id) const noexcept { return armed(id) ? timers[id].interval : 0; }
+		uint64_t due(size_t id) const noexcept { return armed(id) ? timers[id].due : 0; }
+
+		//* Earliest due time of all armed timers, UINT64_MAX if none is armed
+		uint64_t next_due() const;
+
+		//* Append the ids of all timers due at <now> to <fired> in ascending order and move them on to their next period
+		void expire(uint64_t now, vector<size_t>& fired);
+	};
+
 	//* Read a complete file and return as a string
 	string readfile(const std::filesystem::path& path, const string& fallback = "");
 
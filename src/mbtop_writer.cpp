@@ -0,0 +1,157 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "mbtop_writer.hpp"
+
+namespace Term {
+
+	Writer::~Writer() { stop(); }
+
+	void Writer::start(int out_fd, std::function<void(std::string&)> on_catch_up) {
+		if (started()) return;
+		catch_up = std::move(on_catch_up);
+		fd = out_fd;
+		own_fd = false;
+		//? O_NONBLOCK is a property of the open file, set on stdout it would also apply to everything else writing to it
+		if (isatty(out_fd)) {
+			if (const char* path = ttyname(out_fd); path != nullptr) {
+				if (const int tty = open(path, O_WRONLY | O_NONBLOCK | O_NOCTTY | O_CLOEXEC); tty >= 0) {
+					fd = tty;
+					own_fd = true;
+				}
+			}
+		}
+		thread = std::thread(&Writer::writer_loop, this);
+	}
+
+	void Writer::stop() {
+		{
+			std::lock_guard lock(mtx);
+			stopping = true;
+		}
+		cv.notify_all();
+		if (thread.joinable()) thread.join();
+		if (own_fd) close(fd);
+		fd = -1;
+		own_fd = false;
+		busy = queued = missed = stopping = false;
+	}
+
+	bool Writer::reserve() {
+		std::lock_guard lock(mtx);
+		if (busy) {
+			++stats.dropped;
+			missed = true;
+			return false;
+		}
+		busy = true;
+		return true;
+	}
+
+	void Writer::submit(std::string& data) {
+		{
+			std::lock_guard lock(mtx);
+			buffer.swap(data);
+			queued = true;
+		}
+		data.clear();
+		cv.notify_all();
+	}
+
+	bool Writer::drain(uint64_t timeout_ms) {
+		std::unique_lock lock(mtx);
+		return cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this] { return not busy; });
+	}
+
+	auto Writer::get_counters() -> counters {
+		std::lock_guard lock(mtx);
+		return stats;
+	}
+
+	void Writer::write_buffer() {
+		size_t done = 0;
+		uint64_t stalled = 0;
+		while (done < buffer.size()) {
+			const ssize_t n = write(fd, buffer.data() + done, buffer.size() - done);
+			if (n > 0) {
+				done += static_cast<size_t>(n);
+				continue;
+			}
+			if (n < 0 and errno == EINTR) continue;
+			if (n < 0 and (errno == EAGAIN or errno == EWOULDBLOCK)) {
+				++stalled;
+				{
+					std::lock_guard lock(mtx);
+					if (stopping) break;
+				}
+				pollfd pfd{fd, POLLOUT, 0};
+				poll(&pfd, 1, 100);
+				continue;
+			}
+			//? Terminal gone or some other error, nothing more will get through
+			break;
+		}
+		std::lock_guard lock(mtx);
+		++stats.writes;
+		stats.bytes += done;
+		stats.stalls += stalled;
+	}
+
+	void Writer::writer_loop() {
+		//? Signals should only ever be delivered to the main and runner threads
+		sigset_t mask;
+		sigfillset(&mask);
+		pthread_sigmask(SIG_BLOCK, &mask, nullptr);
+
+		std::unique_lock lock(mtx);
+		for (;;) {
+			cv.wait(lock, [this] { return stopping or queued; });
+			if (not queued) return;
+			queued = false;
+			lock.unlock();
+			if (not buffer.empty()) write_buffer();
+
+			//? Changes of buffers dropped meanwhile go out right away instead of with the next submit
+			for (;;) {
+				lock.lock();
+				if (not missed or not catch_up or stopping) break;
+				missed = false;
+				lock.unlock();
+				buffer.clear();
+				catch_up(buffer);
+				if (buffer.empty()) continue;
+				{
+					std::lock_guard count_lock(mtx);
+					++stats.coalesced;
+				}
+				write_buffer();
+			}
+			buffer.clear();
+			busy = missed = false;
+			cv.notify_all();
+		}
+	}
+}
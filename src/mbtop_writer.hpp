@@ -0,0 +1,89 @@
+/* Copyright 2021 Aristocratos (jakob@qvantnet.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+indent = tab
+tab-size = 4
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Term {
+
+	//* Writes output to a file descriptor from its own thread, so a terminal that can't keep up never blocks the caller
+	//* Holds one buffer at a time, reserve() is refused while the last one is still being written and the buffer counted
+	//* as dropped. The caller keeps what it couldn't send and the catch up callback is asked for it as soon as the
+	//* writer is done, so the changes of all dropped buffers go out coalesced into one write.
+	//* Usage example: writer.start(STDOUT_FILENO, [](std::string& out) { out = changes_since_last_write(); });
+	//*                if (writer.reserve()) writer.submit(frame);
+	class Writer {
+	public:
+		struct counters {
+			uint64_t writes{};		//? Buffers written, submitted and catch up
+			uint64_t bytes{};
+			uint64_t dropped{};		//? Buffers refused because the last one was still being written
+			uint64_t coalesced{};	//? Catch up writes that carried the changes of dropped buffers
+			uint64_t stalls{};		//? Times the file descriptor couldn't take more and the writer had to wait
+		};
+
+	private:
+		int fd{-1};
+		bool own_fd{};
+		std::thread thread;
+		std::mutex mtx;
+		std::condition_variable cv;
+		std::string buffer;			//? Being written by the thread, swapped with the caller's so both keep their capacity
+		bool busy{};				//? Reserved or writing
+		bool queued{};				//? Submitted and not picked up by the thread yet
+		bool missed{};				//? A buffer was dropped since the thread last asked for catch up output
+		bool stopping{};
+		std::function<void(std::string&)> catch_up;
+		counters stats;
+
+		void writer_loop();
+		void write_buffer();
+	public:
+		Writer() = default;
+		~Writer();
+		Writer(const Writer& other) = delete;
+		Writer& operator=(const Writer& other) = delete;
+		Writer(Writer&& other) = delete;
+		Writer& operator=(Writer&& other) = delete;
+
+		//* Start the writer thread for <out_fd>, a terminal is opened again non-blocking so <out_fd> itself is left as is
+		//* <on_catch_up> fills its argument with the changes of dropped buffers, called from the writer thread
+		void start(int out_fd, std::function<void(std::string&)> on_catch_up = {});
+
+		//* Claim the writer for the next submit(), false and counted as dropped if the last buffer is still being written
+		bool reserve();
+
+		//* Write <data> after a successful reserve(), swaps it with the writer's empty buffer
+		void submit(std::string& data);
+
+		//* Wait at most <timeout_ms> for everything submitted and any catch up output to be written
+		bool drain(uint64_t timeout_ms);
+
+		//* Stop the writer thread, output the file descriptor doesn't take by then is dropped
+		void stop();
+
+		bool started() const noexcept { return thread.joinable(); }
+		counters get_counters();
+	};
+}
@@ -655,6 +655,7 @@ namespace Cpu {
 		if (Config::getB("show_battery") and has_battery)
 			current_bat = get_battery();
 
+		++data_version;
 		return current_cpu;
 	}
 } // namespace Cpu
@@ -910,6 +911,7 @@ namespace Mem {
 
 			old_uptime = uptime;
 		}
+		++data_version;
 		return mem;
 	}
 
@@ -1067,6 +1069,7 @@ namespace Net {
 			}
 
 			timestamp = new_timestamp;
+			++data_version;
 		}
 		//? Return empty net_info struct if no interfaces was found
 		if (net.empty())
@@ -1277,18 +1280,19 @@ namespace Proc {
 						continue;
 					}
 					new_proc.name = kproc->p_comm;
+					string cmd;
 					char** argv = kvm_getargv2(kd.get(), kproc, 0);
 					if (argv) {
-						for (int i = 0; argv[i] and cmp_less(new_proc.cmd.size(), 1000); i++) {
-							new_proc.cmd += argv[i] + " "s;
+						for (int i = 0; argv[i] and cmp_less(cmd.size(), 1000); i++) {
+							cmd += argv[i] + " "s;
 						}
-						if (not new_proc.cmd.empty()) new_proc.cmd.pop_back();
+						if (not cmd.empty()) cmd.pop_back();
 					}
-					if (new_proc.cmd.empty()) new_proc.cmd = new_proc.name;
-					if (new_proc.cmd.size() > 1000) {
-						new_proc.cmd.resize(1000);
-						new_proc.cmd.shrink_to_fit();
+					if (cmd.empty()) cmd = new_proc.name;
+					if (cmd.size() > 1000) {
+						cmd.resize(1000);
 					}
+					new_proc.cmd = cmd;
 					new_proc.ppid = kproc->p_ppid;
 					new_proc.cpu_s = round(kproc->p_ustart_sec);
 					struct passwd *pwd = getpwuid(kproc->p_uid);
@@ -1354,6 +1358,7 @@ namespace Proc {
 			}
 
 			old_cputimes = cputimes;
+			++data_version;
 
 		}
 
@@ -1401,47 +1406,29 @@ namespace Proc {
 					else if (expand > -1) {
 						collapser->collapsed = false;
 					}
-					if (Config::ints.at("proc_selected") > 0) locate_selection = true;
+					if (Config::getI("proc_selected") > 0) locate_selection = true;
 				}
 				collapse = expand = -1;
 			}
 			if (should_filter or not filter.empty()) filter_found = 0;
 
-			vector<tree_proc> tree_procs;
-			tree_procs.reserve(current_procs.size());
-
 			if (!pause_proc_list) {
 				for (auto& p : current_procs) {
 					if (not v_contains(found, p.ppid)) p.ppid = 0;
 				}
 			}
 
-			//? Stable sort to retain selected sorting among processes with the same parent
-			rng::stable_sort(current_procs, rng::less{}, & proc_info::ppid);
-
-			//? Start recursive iteration over processes with the lowest shared parent pids
-			for (auto& p : rng::equal_range(current_procs, current_procs.at(0).ppid, rng::less{}, &proc_info::ppid)) {
-				_tree_gen(p, current_procs, tree_procs, 0, false, filter, false, no_update, should_filter);
-			}
-
-			//? Recursive sort over tree structure to account for collapsed processes in the tree
-			int index = 0;
-			tree_sort(tree_procs, sorting, reverse, (pause_proc_list and not (sorted_change or tree_mode_change)), index, current_procs.size());
-
-			//? Recursive construction of ASCII tree prefixes.
-			for (auto t = tree_procs.begin(); t != tree_procs.end(); ++t) {
-				_collect_prefixes(*t, t == tree_procs.end() - 1);
-			}
-
-			//? Final sort based on tree index
-			rng::stable_sort(current_procs, rng::less {}, &proc_info::tree_index);
+			//? Build the tree from the parent pids, sort each level and order the list by tree position
+			process_tree.build(current_procs, sorting, reverse, (pause_proc_list and not (sorted_change or tree_mode_change)), filter, no_update, should_filter);
 
 			//? Move current selection/view to the selected process when collapsing/expanding in the tree
 			if (locate_selection) {
 				int loc = rng::find(current_procs, Proc::selected_pid, &proc_info::pid)->tree_index;
-				if (Config::ints.at("proc_start") >= loc or Config::ints.at("proc_start") <= loc - Proc::select_max)
-					Config::ints.at("proc_start") = max(0, loc - 1);
-				Config::ints.at("proc_selected") = loc - Config::ints.at("proc_start") + 1;
+				//? Changes made on a collector thread aren't read back until the runner has them, so keep the new start here
+				int proc_start = Config::getI("proc_start");
+				if (proc_start >= loc or proc_start <= loc - Proc::select_max)
+					Config::set("proc_start", proc_start = max(0, loc - 1));
+				Config::set("proc_selected", loc - proc_start + 1);
 			}
 		}
 
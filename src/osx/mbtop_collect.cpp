@@ -1064,6 +1064,7 @@ namespace Cpu {
 		if (Config::getB("show_battery") and has_battery)
 			current_bat = get_battery();
 
+		++data_version;
 		return cpu;
 	}
 }  // namespace Cpu
@@ -1445,6 +1446,7 @@ namespace Mem {
 
 			old_uptime = uptime;
 		}
+		++data_version;
 		return mem;
 	}
 
@@ -1615,6 +1617,7 @@ namespace Net {
 			}
 
 			timestamp = new_timestamp;
+			++data_version;
 		}
 		//? Return empty net_info struct if no interfaces was found
 		if (net.empty())
@@ -2053,6 +2056,7 @@ namespace Proc {
 							f_name = f_name.substr(lastSlash + 1);
 						}
 						new_proc.name = f_name;
+						string cmd;
 						//? Get process arguments if possible, fallback to process path in case of failure
 						if (Shared::arg_max > 0) {
 							std::unique_ptr<char[]> proc_chars(new char[Shared::arg_max]);
@@ -2064,21 +2068,21 @@ namespace Proc {
 								std::string_view proc_args(proc_chars.get(), argmax);
 								if (size_t null_pos = proc_args.find('\0', sizeof(argc)); null_pos != string::npos) {
 									if (size_t start_pos = proc_args.find_first_not_of('\0', null_pos); start_pos != string::npos) {
-										while (argc-- > 0 and null_pos != string::npos and cmp_less(new_proc.cmd.size(), 1000)) {
+										while (argc-- > 0 and null_pos != string::npos and cmp_less(cmd.size(), 1000)) {
 											null_pos = proc_args.find('\0', start_pos);
-											new_proc.cmd += (string)proc_args.substr(start_pos, null_pos - start_pos) + ' ';
+											cmd += (string)proc_args.substr(start_pos, null_pos - start_pos) + ' ';
 											start_pos = null_pos + 1;
 										}
 									}
 								}
-								if (not new_proc.cmd.empty()) new_proc.cmd.pop_back();
+								if (not cmd.empty()) cmd.pop_back();
 							}
 						}
-						if (new_proc.cmd.empty()) new_proc.cmd = f_name;
-						if (new_proc.cmd.size() > 1000) {
-							new_proc.cmd.resize(1000);
-							new_proc.cmd.shrink_to_fit();
+						if (cmd.empty()) cmd = f_name;
+						if (cmd.size() > 1000) {
+							cmd.resize(1000);
 						}
+						new_proc.cmd = cmd;
 						new_proc.ppid = kproc.kp_eproc.e_ppid;
 						new_proc.cpu_s = kproc.kp_proc.p_starttime.tv_sec * 1'000'000 + kproc.kp_proc.p_starttime.tv_usec;
 						struct passwd *pwd = getpwuid(kproc.kp_eproc.e_ucred.cr_uid);
@@ -2215,6 +2219,7 @@ namespace Proc {
 
 				old_cputimes = cputimes;
 			}
+			++data_version;
 		}
 
 		//* ---------------------------------------------Collection done-----------------------------------------------
@@ -2240,8 +2245,8 @@ namespace Proc {
 		if (Proc::filter_tagged) {
 			for (auto &p : current_procs) {
 				if (not p.filtered) {
-					auto cfg = Config::find_process_config(p.name, p.cmd);
-					if (not cfg.has_value() or not cfg->has_tagging()) {
+					const auto* cfg = Config::find_process_config(p.pid, p.cpu_s, p.name, p.cmd);
+					if (cfg == nullptr or not cfg->has_tagging()) {
 						p.filtered = true;
 						filter_found++;
 					}
@@ -2269,7 +2274,7 @@ namespace Proc {
 							}
 						}
 					}
-					if (Config::ints.at("proc_selected") > 0) locate_selection = true;
+					if (Config::getI("proc_selected") > 0) locate_selection = true;
 				}
 				toggle_children = -1;
 			}
@@ -2286,47 +2291,29 @@ namespace Proc {
 					else if (expand > -1) {
 						collapser->collapsed = false;
 					}
-					if (Config::ints.at("proc_selected") > 0) locate_selection = true;
+					if (Config::getI("proc_selected") > 0) locate_selection = true;
 				}
 				collapse = expand = -1;
 			}
 			if (should_filter or not filter.empty()) filter_found = 0;
 
-			vector<tree_proc> tree_procs;
-			tree_procs.reserve(current_procs.size());
-
 			if (!pause_proc_list) {
 				for (auto& p : current_procs) {
 					if (not found.contains(p.ppid)) p.ppid = 0;
 				}
 			}
 
-			//? Stable sort to retain selected sorting among processes with the same parent
-			rng::stable_sort(current_procs, rng::less{}, & proc_info::ppid);
-
-			//? Start recursive iteration over processes with the lowest shared parent pids
-			for (auto& p : rng::equal_range(current_procs, current_procs.at(0).ppid, rng::less{}, &proc_info::ppid)) {
-				_tree_gen(p, current_procs, tree_procs, 0, false, filter, false, no_update, should_filter);
-			}
-
-			//? Recursive sort over tree structure to account for collapsed processes in the tree
-			int index = 0;
-			tree_sort(tree_procs, sorting, reverse, (pause_proc_list and not (sorted_change or tree_mode_change)), index, current_procs.size());
-
-			//? Recursive construction of ASCII tree prefixes.
-			for (auto t = tree_procs.begin(); t != tree_procs.end(); ++t) {
-				_collect_prefixes(*t, t == tree_procs.end() - 1);
-			}
-
-			//? Final sort based on tree index
-			rng::stable_sort(current_procs, rng::less {}, &proc_info::tree_index);
+			//? Build the tree from the parent pids, sort each level and order the list by tree position
+			process_tree.build(current_procs, sorting, reverse, (pause_proc_list and not (sorted_change or tree_mode_change)), filter, no_update, should_filter);
 
 			//? Move current selection/view to the selected process when collapsing/expanding in the tree
 			if (locate_selection) {
 				int loc = rng::find(current_procs, Proc::selected_pid, &proc_info::pid)->tree_index;
-				if (Config::ints.at("proc_start") >= loc or Config::ints.at("proc_start") <= loc - Proc::select_max)
-					Config::ints.at("proc_start") = max(0, loc - 1);
-				Config::ints.at("proc_selected") = loc - Config::ints.at("proc_start") + 1;
+				//? Changes made on a collector thread aren't read back until the runner has them, so keep the new start here
+				int proc_start = Config::getI("proc_start");
+				if (proc_start >= loc or proc_start <= loc - Proc::select_max)
+					Config::set("proc_start", proc_start = max(0, loc - 1));
+				Config::set("proc_selected", loc - proc_start + 1);
 			}
 		}
 
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <climits>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mbtop_config.hpp"
+
+TEST(config, keys_match_the_registry) {
+	EXPECT_EQ(Config::bool_key("proc_tree").id, Config::id_of(Config::bool_options, "proc_tree"));
+	EXPECT_EQ(Config::int_key("update_ms").id, Config::id_of(Config::int_options, "update_ms"));
+	EXPECT_EQ(Config::string_key("color_theme").id, 0u);
+
+	const std::string name = "proc_tree";
+	EXPECT_EQ(Config::getB(name), Config::getB("proc_tree"));
+	EXPECT_EQ(Config::getI(std::string("update_ms")), 2000);
+	EXPECT_THROW(Config::getB(std::string("no_such_option")), std::out_of_range);
+	EXPECT_THROW(Config::getI(name), std::out_of_range);
+}
+
+TEST(config, tables_work_as_maps) {
+	EXPECT_TRUE(Config::strings.contains("graph_symbol"));
+	EXPECT_FALSE(Config::strings.contains("proc_tree"));
+	EXPECT_EQ(Config::bools.find("no_such_option"), Config::bools.end());
+
+	const auto it = Config::ints.find("update_ms");
+	ASSERT_NE(it, Config::ints.end());
+	EXPECT_EQ(it->first, "update_ms");
+	EXPECT_EQ(&it->second, &Config::ints.at("update_ms"));
+
+	size_t id = 0;
+	for (const auto& [name, value] : Config::bools) {
+		EXPECT_EQ(name, Config::bool_options[id].name);
+		EXPECT_EQ(value, Config::bool_options[id].value);
+		++id;
+	}
+	EXPECT_EQ(id, Config::bools.size());
+}
+
+TEST(config, cycle_reads_its_snapshot) {
+	Config::publish();
+	auto* snapshot = Config::acquire();
+	ASSERT_NE(snapshot, nullptr);
+
+	{
+		Config::cycle_view view(snapshot);
+		//? Written by the main thread after the cycle started, not seen until the next snapshot
+		Config::ints.at("update_ms") = 1234;
+		EXPECT_EQ(Config::getI("update_ms"), 2000);
+
+		//? Written by the cycle, seen by the cycle right away and by the main thread after merge()
+		Config::set("disk_start", 7);
+		Config::flip("proc_tree");
+		EXPECT_EQ(Config::getI("disk_start"), 7);
+		EXPECT_TRUE(Config::getB("proc_tree"));
+	}
+	EXPECT_EQ(Config::getI("disk_start"), 0);
+	EXPECT_FALSE(Config::getB("proc_tree"));
+
+	Config::publish();
+	EXPECT_EQ(Config::getI("disk_start"), 7);
+	EXPECT_TRUE(Config::getB("proc_tree"));
+	{
+		Config::cycle_view view(Config::acquire());
+		EXPECT_EQ(Config::getI("update_ms"), 1234);
+	}
+
+	Config::set("update_ms", 2000);
+	Config::set("disk_start", 0);
+	Config::set("proc_tree", false);
+}
+
+TEST(config, last_write_wins) {
+	Config::publish();
+	{
+		Config::cycle_view view(Config::acquire());
+		Config::set("mem_selected", 3);
+	}
+	//? The main thread changing the option after the cycle drops the cycle's change
+	Config::set("mem_selected", 5);
+	Config::merge();
+	EXPECT_EQ(Config::getI("mem_selected"), 5);
+
+	Config::set("mem_selected", 0);
+}
+
+TEST(config, collectors_queue_their_changes) {
+	Config::publish();
+	Config::cycle_view view(Config::acquire());
+	//? A collector thread shares the runner's snapshot, its change waits for the runner to sync
+	std::thread collector([snapshot = Config::view] {
+		Config::cycle_view collector_view(snapshot, true);
+		Config::set("disk_start", 7);
+		EXPECT_EQ(Config::getI("disk_start"), 0);
+	});
+	collector.join();
+	EXPECT_EQ(Config::getI("disk_start"), 0);
+	Config::sync_view();
+	EXPECT_EQ(Config::getI("disk_start"), 7);
+
+	Config::merge();
+	EXPECT_EQ(Config::ints.at("disk_start"), 7);
+	Config::ints.at("disk_start") = 0;
+}
+
+namespace {
+	//* find_process_config as it was before the index, a linear scan with a regex built for every wildcard
+	const Config::ProcessLogConfig* legacy_find(const std::string& name, const std::string& cmdline) {
+		const Config::ProcessLogConfig* best = nullptr;
+		int best_specificity = 0;
+		for (const auto& cfg : Config::logging.processes) {
+			if (cfg.name != name or cfg.command.empty()) continue;
+			bool matched = false, exact = false;
+			if (cfg.compiled_pattern.has_value()) matched = std::regex_search(cmdline, *cfg.compiled_pattern);
+			else if (cfg.command.find('*') != std::string::npos) {
+				std::string regex_str;
+				for (char c : cfg.command) {
+					if (c == '*') regex_str += ".*";
+					else if (std::string(".?+[](){}^$|\\").find(c) != std::string::npos) regex_str += {'\\', c};
+					else regex_str += c;
+				}
+				matched = std::regex_match(cmdline, std::regex(regex_str));
+			}
+			else matched = exact = cfg.command == cmdline;
+			if (not matched) continue;
+			int specificity = INT_MAX;
+			if (not exact) specificity = static_cast<int>(cfg.command.size() - std::ranges::count(cfg.command, '*'));
+			if (best == nullptr or specificity > best_specificity) {
+				best = &cfg;
+				best_specificity = specificity;
+			}
+		}
+		return best;
+	}
+
+	//* Config for processes named <name> running <command>, or matching <pattern> when given
+	Config::ProcessLogConfig process_config(const std::string& name, const std::string& command, const std::string& pattern, const std::string& display_name) {
+		return {.name = name, .command = command, .command_pattern = pattern, .log_path = "", .display_name = display_name,
+				.tagged = false, .tag_color = "", .compiled_pattern = std::nullopt};
+	}
+}
+
+TEST(config, process_configs_match_the_linear_scan) {
+	const std::vector<Config::ProcessLogConfig> configs = {
+		process_config("python3", "python3 *", "", "any python"),
+		process_config("python3", "python3 *worker.py*", "", "worker"),
+		process_config("python3", "python3 -m *.serve", "", "server"),
+		process_config("python3", "python3 manage.py runserver", "", "django"),
+		process_config("python3", "python3 *a*b*", "", "a then b"),
+		process_config("node", "node", "--inspect(=\\d+)?", "debugged"),
+		process_config("node", "*(x)*", "", "parens"),
+		process_config("bash", "*", "", "every shell"),
+	};
+	for (const auto& cfg : configs) Config::save_process_config(cfg);
+
+	const std::pair<std::string, std::string> processes[] = {
+		{"python3", "python3 worker.py --jobs 4"}, {"python3", "python3 /srv/app/worker.py"}, {"python3", "python3 -m app.serve"},
+		{"python3", "python3 -m appXserve"}, {"python3", "python3 manage.py runserver"}, {"python3", "python3"},
+		{"python3", "python3 ab"}, {"python3", "python3 ba"}, {"python3", "python3 worker.py\nsecond line"},
+		{"node", "node --inspect=9229 app.js"}, {"node", "node app (x).js"}, {"node", "node app.js"},
+		{"bash", ""}, {"bash", "-bash"}, {"zsh", "zsh"},
+	};
+	size_t pid = 100;
+	for (const auto& [name, cmdline] : processes) {
+		const auto* want = legacy_find(name, cmdline);
+		const auto got = Config::find_process_config(name, cmdline);
+		ASSERT_EQ(want != nullptr, got.has_value()) << name << ": " << cmdline;
+		if (want != nullptr) {
+			EXPECT_EQ(want->display_name, got->display_name) << name << ": " << cmdline;
+		}
+
+		//? Resolved once per process and then remembered
+		const auto* cached = Config::find_process_config(pid, 1, name, cmdline);
+		EXPECT_EQ(cached, Config::find_process_config(pid++, 1, name, cmdline));
+		ASSERT_EQ(want != nullptr, cached != nullptr) << name << ": " << cmdline;
+		if (want != nullptr) {
+			EXPECT_EQ(want->display_name, cached->display_name) << name << ": " << cmdline;
+		}
+	}
+
+	//? A changed config is seen by processes resolved before the change
+	Config::save_process_config(process_config("bash", "*", "", "renamed"));
+	EXPECT_EQ(Config::find_process_config(113, 1, "bash", "-bash")->display_name, "renamed");
+	//? Same pid with another start time is another process
+	EXPECT_EQ(Config::find_process_config(113, 2, "zsh", "-zsh"), nullptr);
+
+	for (const auto& cfg : configs) Config::remove_process_config(cfg.name, cfg.command);
+	EXPECT_EQ(Config::find_process_config(113, 2, "bash", "-bash"), nullptr);
+}
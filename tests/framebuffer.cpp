@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "mbtop_framebuffer.hpp"
+#include "mbtop_tools.hpp"
+
+namespace {
+	//* Terminal at <width>x<height> that has received everything flushed from <fb> so far
+	void expect_same_screen(const Term::FrameBuffer& fb, const Term::FrameBuffer& terminal) {
+		for (int r = 0; r < fb.height(); ++r) {
+			for (int c = 0; c < fb.width(); ++c) {
+				const auto& want = fb.get(r, c);
+				const auto& got = terminal.get(r, c);
+				EXPECT_EQ(std::string(want.glyph.data(), want.len), std::string(got.glyph.data(), got.len)) << "at " << r << "," << c;
+				EXPECT_EQ(want.width, got.width) << "at " << r << "," << c;
+				//? Blank cells only need the right background
+				if (want.len == 1 and want.glyph[0] == ' ') EXPECT_EQ(want.style.bg, got.style.bg) << "at " << r << "," << c;
+				else EXPECT_EQ(want.style, got.style) << "at " << r << "," << c;
+			}
+		}
+	}
+}
+
+TEST(framebuffer, interprets_cursor_moves_and_sgr) {
+	Term::FrameBuffer fb(20, 4);
+	fb.write(Mv::to(2, 3) + "ab" + Mv::r(2) + "c" + Mv::d(1) + Mv::l(2) + Fx::b + "\x1b[38;2;1;2;3m" + "d");
+	EXPECT_EQ(fb.text(1), "  ab  c             ");
+	EXPECT_EQ(fb.text(2), "     d              ");
+	const auto& cell = fb.get(2, 5);
+	EXPECT_EQ(cell.style.attrs, Term::FrameBuffer::bold);
+	EXPECT_EQ(cell.style.fg, Term::FrameBuffer::color_rgb | 0x010203u);
+
+	fb.write(Fx::ub + "\x1b[0m" + Mv::to(2, 1) + Term::clear_eol);
+	EXPECT_EQ(fb.text(1), std::string(20, ' '));
+	fb.write(Term::clear + "x");
+	EXPECT_EQ(fb.text(0), "x" + std::string(19, ' '));
+	EXPECT_EQ(fb.text(2), std::string(20, ' '));
+}
+
+TEST(framebuffer, wide_and_multibyte_glyphs) {
+	Term::FrameBuffer fb(6, 2);
+	fb.write(Mv::to(1, 1) + "⣿│日x");
+	EXPECT_EQ(fb.get(0, 0).width, 1);
+	EXPECT_EQ(fb.get(0, 2).width, 2);
+	EXPECT_EQ(fb.get(0, 3).width, 0);
+	EXPECT_EQ(fb.text(0), "⣿│日x ");
+
+	//? Overwriting the right half of a wide glyph blanks the left half
+	fb.write(Mv::to(1, 4) + "y");
+	EXPECT_EQ(fb.text(0), "⣿│ yx ");
+}
+
+TEST(framebuffer, flush_writes_only_changes) {
+	const std::string frame = Term::clear + "\x1b[38;5;200m" + Mv::to(1, 1) + "cpu 12%" + Mv::to(3, 1) + "mem 40%";
+	Term::FrameBuffer fb(40, 5), terminal(40, 5);
+
+	fb.write(frame);
+	const auto first = fb.flush();
+	terminal.write(first);
+	expect_same_screen(fb, terminal);
+
+	//? Same frame again, nothing to write
+	fb.write(frame);
+	EXPECT_TRUE(fb.flush().empty());
+
+	//? One changed digit
+	fb.write(Term::clear + "\x1b[38;5;200m" + Mv::to(1, 1) + "cpu 13%" + Mv::to(3, 1) + "mem 40%");
+	const auto diff = fb.flush();
+	EXPECT_LT(diff.size(), 20u);
+	terminal.write(diff);
+	expect_same_screen(fb, terminal);
+
+	//? After invalidate() every cell is written
+	fb.invalidate();
+	EXPECT_GE(fb.flush().size(), 40u * 5u);
+}
+
+TEST(framebuffer, flush_matches_full_output) {
+	Term::FrameBuffer fb(30, 6), terminal(30, 6);
+	std::string frames[] = {
+		Term::clear + Fx::reset + Mv::to(1, 1) + "╭─cpu─╮" + Mv::to(2, 1) + "│" + "\x1b[31m" + "⣀⣤⣶" + "\x1b[0m" + "│",
+		Mv::to(2, 2) + "\x1b[1;4;48;2;10;20;30m" + "⣤⣶⣿" + Fx::ub + "\x1b[24m" + Mv::to(4, 5) + "日本" + Mv::to(6, 29) + "ab",
+		Mv::to(4, 6) + "x" + "\x1b[2;9m" + Mv::to(5, 1) + "dim struck" + "\x1b[22;29;93m" + " bright" + "\x1b[0K",
+		Mv::save + Mv::to(1, 3) + "\x1b[7m" + "mem" + Mv::restore + "\x1b[27m" + "z",
+	};
+	for (const auto& frame : frames) {
+		fb.write(frame);
+		terminal.write(fb.flush());
+		expect_same_screen(fb, terminal);
+	}
+}
+
+TEST(framebuffer, passes_private_sequences_through) {
+	Term::FrameBuffer fb(10, 2);
+	fb.flush();
+	fb.write(Term::hide_cursor + "\x1b]0;title\a" + "a");
+	const auto out = fb.flush();
+	EXPECT_EQ(out.find(Term::hide_cursor), 0u);
+	EXPECT_NE(out.find("\x1b]0;title\a"), std::string::npos);
+	EXPECT_EQ(fb.text(0), "a" + std::string(9, ' '));
+}
+
+TEST(framebuffer, sgr_changes_turn_attributes_off) {
+	Term::FrameBuffer::pen bold_red{Term::FrameBuffer::color_basic | 1, 0, Term::FrameBuffer::bold | Term::FrameBuffer::underline};
+	Term::FrameBuffer::pen red{Term::FrameBuffer::color_basic | 1, 0, Term::FrameBuffer::underline};
+	std::string out;
+	Term::FrameBuffer::append_sgr(out, bold_red, red);
+	EXPECT_EQ(out, "\x1b[22m");
+
+	out.clear();
+	Term::FrameBuffer::append_sgr(out, bold_red, Term::FrameBuffer::pen{});
+	EXPECT_EQ(out, "\x1b[0m");
+
+	out.clear();
+	Term::FrameBuffer::append_sgr(out, std::nullopt, red);
+	EXPECT_EQ(out, "\x1b[0;4;31m");
+}
+
+TEST(framebuffer, minimizer_keeps_the_screen) {
+	const std::string frames[] = {
+		Term::clear + Fx::reset + Mv::to(1, 1) + "\x1b[38;5;2m" + "cpu" + "\x1b[38;5;2m" + " 12%" + Fx::ub + Fx::reset + "\x1b[31m" + Mv::to(2, 1) + "⣀⣤",
+		Mv::to(2, 3) + "\x1b[31m" + "⣶" + "\x1b[31m" + "⣿" + Mv::to(3, 1) + Mv::r(2) + Mv::d(1) + Fx::b + "mem" + Fx::ub + Fx::b + "!" + "\x1b[0K",
+		Mv::save + Mv::to(1, 25) + Mv::r(10) + Mv::l(3) + "x" + Mv::restore + "\x1b[7m" + "y" + "\x1b[27m" + Mv::l(1) + Mv::l(1) + Mv::r(4) + "z",
+		"\x1b[1;2;4m" + Mv::to(5, 1) + "a" + "\x1b[22;2m" + "b" + Fx::reset + Mv::u(9) + Mv::u(1) + "c" + Fx::reset,
+	};
+	Term::FrameBuffer raw(30, 6), minimized(30, 6);
+	Term::OutputMinimizer minimizer;
+	minimizer.resize(30, 6);
+	size_t raw_bytes = 0, minimized_bytes = 0;
+	for (const auto& frame : frames) {
+		const auto& out = minimizer.minimize(frame);
+		raw.write(frame);
+		minimized.write(out);
+		expect_same_screen(raw, minimized);
+		raw_bytes += frame.size();
+		minimized_bytes += out.size();
+	}
+	EXPECT_LT(minimized_bytes, raw_bytes);
+}
+
+TEST(framebuffer, minimizer_folds_moves_and_drops_repeats) {
+	Term::OutputMinimizer minimizer;
+	minimizer.resize(20, 10);
+	//? State before the first reset is unknown and passed through as is
+	EXPECT_EQ(minimizer.minimize("\x1b[31m" "a"), "\x1b[31m" "a");
+	EXPECT_EQ(minimizer.minimize(Fx::reset + "\x1b[31m" + "a" + "\x1b[31m" + "b"), "\x1b[0;31mab");
+	EXPECT_EQ(minimizer.minimize(Mv::to(2, 3) + Mv::r(2) + Mv::to(3, 1) + Mv::r(40) + Mv::l(2) + "c"), "\x1b[3;18fc");
+	EXPECT_EQ(minimizer.minimize(Mv::r(2) + Mv::r(3) + Mv::d(1) + "d"), "\x1b[B\x1b[5Cd");
+	EXPECT_EQ(minimizer.minimize(Mv::r(2) + Mv::l(3) + "e"), "\x1b[2C\x1b[3De");
+	EXPECT_EQ(minimizer.minimize(Fx::reset + Fx::b + Fx::ub + "f"), "\x1b[39mf");
+}
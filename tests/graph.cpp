@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mbtop_draw.hpp"
+#include "mbtop_framebuffer.hpp"
+#include "mbtop_theme.hpp"
+#include "mbtop_tools.hpp"
+
+namespace {
+	struct Options {
+		int width, height;
+		std::string symbol = "braille";
+		int direction = 0;
+		bool invert = false, no_zero = false;
+		std::string gradient = "";
+	};
+
+	//* Screen rows after drawing a graph fed with 12 values and then ticked 9 times, the golden output for <opt>
+	std::vector<std::string> golden(const Options& opt) {
+		Theme::setTheme();
+		std::deque<long long> data;
+		auto value = [n = 0]() mutable { n++; return (n % 5 == 0) ? 0ll : (n * 37) % 101; };
+		for (int i = 0; i < 12; ++i) data.push_back(value());
+
+		Draw::Graph graph(opt.width, opt.height, opt.gradient, data, opt.symbol, opt.invert, opt.no_zero, 0, 0, opt.direction);
+		std::string out = graph();
+		for (int tick = 0; tick < 9; ++tick) {
+			data.push_back(value());
+			data.pop_front();
+			out = graph(data);
+		}
+
+		Term::FrameBuffer fb(opt.width, opt.height);
+		fb.write(Term::clear + Mv::to(opt.direction == 3 ? opt.height : 1, 1) + out);
+		std::vector<std::string> rows;
+		for (int r = 0; r < opt.height; ++r) rows.push_back(fb.text(r));
+		return rows;
+	}
+}
+
+TEST(graph, rtl_braille) {
+	EXPECT_EQ(golden({8, 3, "braille", 0}), (std::vector<std::string>{
+		" ⡆ ⢀ ⡆⢸ ",
+		"⢰⡇ ⣸ ⡇⣾⢸",
+		"⣾⣿ ⣿⡄⣷⣿⢸",
+	}));
+}
+
+TEST(graph, ltr_braille) {
+	EXPECT_EQ(golden({8, 3, "braille", 1}), (std::vector<std::string>{
+		" ⡇⢰ ⡀ ⢰ ",
+		"⡇⣷⢸ ⣇ ⢸⡆",
+		"⡇⣿⣾⢠⣿ ⣿⣷",
+	}));
+}
+
+TEST(graph, rtl_braille_inverted) {
+	EXPECT_EQ(golden({8, 3, "braille", 0, true}), (std::vector<std::string>{
+		"⢿⣿ ⣿⠃⡿⣿⢸",
+		"⠸⡇ ⢹ ⡇⢿⢸",
+		" ⠇ ⠈ ⠇⢸ ",
+	}));
+}
+
+TEST(graph, ltr_braille_inverted) {
+	EXPECT_EQ(golden({8, 3, "braille", 1, true}), (std::vector<std::string>{
+		"⡇⣿⢿⠘⣿ ⣿⡿",
+		"⡇⡿⢸ ⡏ ⢸⠇",
+		" ⡇⠸ ⠁ ⠸ ",
+	}));
+}
+
+TEST(graph, rtl_block_single_row) {
+	EXPECT_EQ(golden({10, 1, "block", 0, false, true, "cpu"}), (std::vector<std::string>{
+		"▙▄▟▙▄▟▄▙█▟",
+	}));
+}
+
+TEST(graph, ltr_block_single_row) {
+	EXPECT_EQ(golden({10, 1, "block", 1, false, true, "cpu"}), (std::vector<std::string>{
+		"▙█▟▄▙▄▟▙▄▟",
+	}));
+}
+
+TEST(graph, rtl_tty) {
+	EXPECT_EQ(golden({6, 2, "tty", 0}), (std::vector<std::string>{
+		"▒▒░█▒░",
+		"▒███▒▒",
+	}));
+}
+
+TEST(graph, ltr_tty) {
+	EXPECT_EQ(golden({6, 2, "tty", 1}), (std::vector<std::string>{
+		"░▒█░▒▒",
+		"▒▒███▒",
+	}));
+}
+
+TEST(graph, ttb) {
+	EXPECT_EQ(golden({8, 3, "braille", 2}), (std::vector<std::string>{
+		"⣯⣭⣭⣭⡭⠥⠤⠄",
+		"⣟⠓⠒⠒⠒⠒⠒⠀",
+		"⡟⠛⠛⠉⠉⠉⠀⠀",
+	}));
+}
+
+TEST(graph, btt) {
+	EXPECT_EQ(golden({8, 3, "braille", 3}), (std::vector<std::string>{
+		"⣧⣤⣤⣀⣀⣀⠀⠀",
+		"⣯⡤⠤⠤⠤⠤⠤⠀",
+		"⣟⣛⣛⣛⣓⡒⠒⠂",
+	}));
+}
+
+TEST(graph, ttb_inverted) {
+	EXPECT_EQ(golden({8, 3, "braille", 2, true, false, "download"}), (std::vector<std::string>{
+		"⠠⠤⠬⢭⣭⣭⣭⣽",
+		"⠀⠒⠒⠒⠒⠒⠚⣻",
+		"⠀⠀⠉⠉⠉⠛⠛⢻",
+	}));
+}
+
+TEST(graph, btt_inverted) {
+	EXPECT_EQ(golden({8, 3, "braille", 3, true}), (std::vector<std::string>{
+		"⠀⠀⣀⣀⣀⣤⣤⣼",
+		"⠀⠤⠤⠤⠤⠤⢤⣽",
+		"⠐⠒⢒⣚⣛⣛⣛⣻",
+	}));
+}
+
+TEST(graph, rtl_partly_filled) {
+	EXPECT_EQ(golden({24, 2, "braille", 0}), (std::vector<std::string>{
+		"              ⡄ ⢀⡇ ⢠ ⡆⣸⢠",
+		"             ⢰⣇⡇⣼⣷ ⣾⡀⣧⣿⢸",
+	}));
+}
+
+TEST(graph, ltr_partly_filled) {
+	EXPECT_EQ(golden({24, 2, "braille", 1}), (std::vector<std::string>{
+		"⡄⣇⢰ ⡄ ⢸⡀ ⢠              ",
+		"⡇⣿⣼⢀⣷ ⣾⣧⢸⣸⡆             ",
+	}));
+}
+
+TEST(graph, ttb_partly_filled) {
+	EXPECT_EQ(golden({4, 8, "braille", 2}), (std::vector<std::string>{
+		"⣯⣭⠥⠄",
+		"⡗⠒⠒⠂",
+		"⡟⠋⠉⠀",
+		"⠀⠀⠀⠀",
+		"⠀⠀⠀⠀",
+		"⠀⠀⠀⠀",
+		"⠀⠀⠀⠀",
+		"⠀⠀⠀⠀",
+	}));
+}
+
+TEST(graph, btt_partly_filled) {
+	EXPECT_EQ(golden({4, 8, "braille", 3}), (std::vector<std::string>{
+		"⠀⠀⠀⠀",
+		"⠀⠀⠀⠀",
+		"⠀⠀⠀⠀",
+		"⠀⠀⠀⠀",
+		"⠀⠀⠀⠀",
+		"⣧⣄⣀⠀",
+		"⡧⠤⠤⠄",
+		"⣟⣛⡒⠂",
+	}));
+}
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mbtop_config.hpp"
+#include "mbtop_draw.hpp"
+#include "mbtop_shared.hpp"
+#include "mbtop_theme.hpp"
+#include "mbtop_tools.hpp"
+
+using Proc::proc_info;
+
+//? Set by Shared::init() in mbtop, Mem::get_totalMem() reads meminfo from here
+namespace Shared {
+	extern std::filesystem::path procPath;
+}
+
+namespace {
+	std::vector<proc_info> make_list() {
+		std::vector<proc_info> plist(20);
+		for (size_t i = 0; auto& p : plist) {
+			p.pid = 1000 + i;
+			p.name = "process_" + std::to_string(i);
+			p.cmd = "/usr/bin/" + p.name;
+			p.short_cmd = p.name;
+			p.user = "user";
+			p.threads = 1;
+			p.state = 'S';
+			p.ppid = 1;
+			++i;
+		}
+		return plist;
+	}
+
+	//* The frame after a full redraw, with the io counters of the first process changed in between
+	std::string next_frame(std::vector<proc_info> plist, uint64_t io_read, uint64_t io_write) {
+		std::string out;
+		Proc::draw(out, plist, true, false);
+		plist.front().io_read = io_read;
+		plist.front().io_write = io_write;
+		out.clear();
+		Proc::draw(out, plist, false, false);
+		return out;
+	}
+}
+
+TEST(proc_draw, redraws_rows_when_only_the_io_split_changes) {
+	Shared::procPath = "/proc";
+	Shared::clk_tck = 100;
+	Config::set("shown_boxes", "proc"s);
+	Config::set("proc_full_width", true);
+	Theme::setTheme();
+	Term::width = 200;
+	Term::height = 40;
+	Draw::calcSizes();
+
+	auto plist = make_list();
+	Proc::numpids = (int)plist.size();
+	plist.front().io_read = 0;
+	plist.front().io_write = 1;
+	const std::string want = next_frame(plist, 0, 1);
+
+	//? Read and write only swap weight, the row drawn for the first frame must not be reused
+	plist.front().io_read = 2;
+	plist.front().io_write = 0;
+	EXPECT_EQ(next_frame(plist, 0, 1), want);
+
+	Config::set("proc_full_width", false);
+}
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "linux/proc_events.hpp"
+
+using ProcEvents::tracker;
+
+TEST(proc_events, needs_resync_first) {
+	tracker state;
+	std::vector<size_t> pids;
+	EXPECT_FALSE(state.pids(pids));
+
+	state.begin_resync();
+	EXPECT_FALSE(state.pids(pids));
+	state.resync({1, 2, 300});
+	ASSERT_TRUE(state.pids(pids));
+	EXPECT_EQ(pids, (std::vector<size_t>{1, 2, 300}));
+}
+
+TEST(proc_events, fork_and_exit) {
+	tracker state;
+	state.begin_resync();
+	state.resync({1, 10});
+
+	state.fork(20);
+	state.fork(15);
+	state.exit(10);
+	std::vector<size_t> pids;
+	ASSERT_TRUE(state.pids(pids));
+	EXPECT_EQ(pids, (std::vector<size_t>{1, 15, 20}));
+
+	//? Exit of a pid that was never seen is ignored
+	state.exit(12345);
+	ASSERT_TRUE(state.pids(pids));
+	EXPECT_EQ(pids.size(), 3u);
+}
+
+TEST(proc_events, short_lived) {
+	tracker state;
+	state.begin_resync();
+	state.resync({1});
+
+	//? Forked and exited before anyone looked
+	state.fork(100);
+	state.exit(100);
+	state.fork(101);
+	state.exit(101);
+	//? Still alive, or started before the last sample
+	state.fork(102);
+	state.exit(1);
+	EXPECT_EQ(state.take_short_lived(), 2u);
+	EXPECT_EQ(state.take_short_lived(), 0u);
+
+	//? Seen by the previous take, so not short-lived anymore
+	state.exit(102);
+	EXPECT_EQ(state.take_short_lived(), 0u);
+}
+
+TEST(proc_events, events_during_resync) {
+	tracker state;
+	state.begin_resync();
+	//? The scan below missed 50 which forked after its directory was read, and still lists 7 which exited meanwhile
+	state.fork(50);
+	state.exit(7);
+	state.resync({1, 7, 9});
+
+	std::vector<size_t> pids;
+	ASSERT_TRUE(state.pids(pids));
+	EXPECT_EQ(pids, (std::vector<size_t>{1, 9, 50}));
+}
+
+TEST(proc_events, overflow_forces_scan) {
+	tracker state;
+	state.begin_resync();
+	state.resync({1});
+	state.overflow();
+	std::vector<size_t> pids;
+	EXPECT_FALSE(state.pids(pids));
+
+	state.begin_resync();
+	state.resync({1, 2});
+	EXPECT_TRUE(state.pids(pids));
+}
+
+TEST(proc_events, execs) {
+	tracker state;
+	state.exec(5);
+	state.exec(6);
+	std::vector<size_t> execs;
+	state.take_execs(execs);
+	EXPECT_EQ(execs, (std::vector<size_t>{5, 6}));
+	state.take_execs(execs);
+	EXPECT_TRUE(execs.empty());
+}
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mbtop_shared.hpp"
+#include "mbtop_tools.hpp"
+
+namespace Legacy {
+	//* Proc::matches_filter as it was before filters were compiled
+	bool matches_filter(const Proc::proc_info& proc, const std::string& filter) {
+		if (filter.starts_with("!")) {
+			if (filter.size() == 1) return true;
+			try {
+				std::regex regex { filter.substr(1), std::regex::extended };
+				return std::regex_search(std::to_string(proc.pid), regex) || std::regex_search(proc.name.str(), regex) ||
+					std::regex_match(proc.cmd.str(), regex) || std::regex_search(proc.user.str(), regex);
+			} catch (std::regex_error&) {
+				return false;
+			}
+		}
+		return std::to_string(proc.pid).contains(filter) || Tools::s_contains_ic(proc.name, filter) ||
+			Tools::s_contains_ic(proc.cmd, filter) || Tools::s_contains_ic(proc.user, filter);
+	}
+}
+
+namespace {
+	std::vector<Proc::proc_info> processes() {
+		std::vector<Proc::proc_info> out;
+		const auto add = [&](size_t pid, std::string name, std::string cmd, std::string user) {
+			Proc::proc_info p{pid};
+			p.name = std::move(name);
+			p.cmd = std::move(cmd);
+			p.user = std::move(user);
+			p.cpu_s = pid * 7;
+			out.push_back(std::move(p));
+		};
+		add(1, "systemd", "/sbin/init splash", "root");
+		add(412, "Xorg", "/usr/lib/xorg/Xorg -nolisten tcp :0", "root");
+		add(1337, "python3", "python3 -m http.server 8080", "alice");
+		add(2048, "Python", "/usr/bin/Python3.12 manage.py runserver", "bob");
+		add(31415, "bash", "bash", "alice");
+		add(4242, "kworker/0:1", "", "root");
+		add(55555, "firefox", "/usr/lib/firefox/firefox -contentproc -childID 5", "carol");
+		add(60000, "a+b[c]", "echo a+b[c] (x|y)", "dave");
+		return out;
+	}
+}
+
+TEST(proc_filter, matches_like_before) {
+	const std::vector<std::string> filters = {
+		"", "1", "13", "py", "PY", "pYtHoN3", "root", "usr/lib", "xorg -no", "zzz", "a+b[c]", "/0:", "!", "!py", "!^py",
+		"!python3$", "!bash", "!^bash$", "!Py.*on", "![Pp]ython", "!serv(er|ice)", "!http\\.server", "!a\\+b\\[c\\]", "!1337",
+		"!^[0-9]+$", "!x{2}", "!ro+t", "!fire?fox", "![[:upper:]]", "!([", "!(unclosed", "!a|b", "!python3 -m http.server 8080",
+		"!/sbin/init splash", "!sbin", "!bas?h",
+	};
+	const auto procs = processes();
+	for (const auto& filter : filters) {
+		const Proc::filter_matcher matcher(filter);
+		for (const auto& p : procs) {
+			EXPECT_EQ(matcher.matches(p), Legacy::matches_filter(p, filter)) << "filter '" << filter << "' on " << p.name;
+			EXPECT_EQ(Proc::matches_filter(p, filter), Legacy::matches_filter(p, filter)) << "filter '" << filter << "' on " << p.name;
+		}
+	}
+}
+
+TEST(proc_filter, cache_follows_typing_and_changes) {
+	auto procs = processes();
+	Proc::filter_cache cache;
+	const auto expect_same = [&](const std::string& filter) {
+		cache.set_filter(filter);
+		for (const auto& p : procs) EXPECT_EQ(cache.matches(p), Legacy::matches_filter(p, filter)) << "filter '" << filter << "' on " << p.name;
+	};
+	for (const std::string filter : {"p", "py", "pyt", "pytho", "python3", "python", "pyth", "ba", "!ba", "bash", ""}) expect_same(filter);
+
+	EXPECT_TRUE(Proc::filter_matcher("python").narrows(Proc::filter_matcher("yth")));
+	EXPECT_FALSE(Proc::filter_matcher("pyth").narrows(Proc::filter_matcher("python")));
+	EXPECT_FALSE(Proc::filter_matcher("!python").narrows(Proc::filter_matcher("!py")));
+
+	//? A process that changed its command or a reused pid is matched again
+	expect_same("sleep");
+	procs[4].cmd = "sleep 10";
+	expect_same("sleep");
+	procs[5] = Proc::proc_info{procs[5].pid};
+	procs[5].name = "sleep";
+	expect_same("sleep");
+	cache.retain([](size_t pid) { return pid == 1; });
+	EXPECT_EQ(cache.size(), 1u);
+}
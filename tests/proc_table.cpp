@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "mbtop_shared.hpp"
+
+TEST(interned_string, equal_strings_share_one_entry) {
+	Tools::interned_string a = std::string("php-fpm: pool www");
+	Tools::interned_string b = "php-fpm: pool www";
+	Tools::interned_string c = std::string_view("php-fpm: pool api");
+	EXPECT_EQ(a, b);
+	EXPECT_EQ(a.c_str(), b.c_str());
+	EXPECT_NE(a, c);
+	EXPECT_LT(c, a);
+	EXPECT_EQ(a, "php-fpm: pool www");
+	EXPECT_EQ(a, std::string("php-fpm: pool www"));
+	EXPECT_EQ(fmt::format("[{}]", a), "[php-fpm: pool www]");
+	EXPECT_EQ(a + "!", "php-fpm: pool www!");
+	EXPECT_EQ(a.substr(0, 7), "php-fpm");
+
+	Tools::interned_string empty;
+	EXPECT_TRUE(empty.empty());
+	EXPECT_EQ(empty, Tools::interned_string(""));
+	EXPECT_EQ(empty.str(), "");
+
+	//? A string no one refers to any more is freed by the next sweep
+	const size_t before = Tools::interned_string::pool_size();
+	{
+		Tools::interned_string gone = "only used in this scope";
+		Tools::interned_string copy = gone;
+		EXPECT_EQ(Tools::interned_string::pool_size(), before + 1);
+	}
+	Tools::interned_string::sweep();
+	EXPECT_LE(Tools::interned_string::pool_size(), before);
+	EXPECT_EQ(a, b);
+}
+
+TEST(proc_table, sorts_like_a_stable_sort) {
+	const char* names[] = {"bash", "postgres", "python3", "nginx", "bash", "kworker/0:1"};
+	const char* users[] = {"root", "postgres", "alice"};
+	std::vector<Proc::proc_info> procs;
+	for (size_t i = 0; i < 300; ++i) {
+		Proc::proc_info p{1000 + (i * 37) % 300};
+		p.name = names[i % 6];
+		p.cmd = "/usr/bin/" + p.name + " --worker " + std::to_string(i % 5);
+		p.user = users[i % 3];
+		p.cpu_p = static_cast<double>((i * 13) % 7);
+		p.mem = (i * 17) % 11;
+		p.threads = i % 4;
+		p.state = "RSZ"[i % 3];
+		p.io_read = i % 5;
+		p.io_write = (i * 3) % 7;
+		procs.push_back(std::move(p));
+	}
+
+	for (const auto& [sorting, reverse] : std::vector<std::pair<std::string, bool>>{
+			{"pid", false}, {"name", false}, {"command", true}, {"user", false}, {"memory", true},
+			{"cpu direct", false}, {"threads", false}, {"io", false}, {"state", true}}) {
+		auto want = procs, got = procs;
+		const auto by = [&](auto key, bool descending) {
+			std::ranges::stable_sort(want, [&](const auto& a, const auto& b) { return descending != reverse ? key(a) > key(b) : key(a) < key(b); });
+		};
+		if (sorting == "pid") by([](const auto& p) { return p.pid; }, true);
+		else if (sorting == "name") by([](const auto& p) { return p.name.str(); }, false);
+		else if (sorting == "command") by([](const auto& p) { return p.cmd.str(); }, false);
+		else if (sorting == "user") by([](const auto& p) { return p.user.str(); }, false);
+		else if (sorting == "memory") by([](const auto& p) { return p.mem; }, true);
+		else if (sorting == "cpu direct") by([](const auto& p) { return p.cpu_p; }, true);
+		else if (sorting == "threads") by([](const auto& p) { return p.threads; }, true);
+		else if (sorting == "io") by([](const auto& p) { return p.io_read + p.io_write; }, true);
+		else if (sorting == "state") by([](const auto& p) { return p.state; }, false);
+
+		Proc::proc_sorter(got, sorting, reverse, false);
+		ASSERT_EQ(want.size(), got.size());
+		for (size_t i = 0; i < want.size(); ++i) {
+			ASSERT_EQ(want[i].pid, got[i].pid) << sorting << " at " << i;
+			ASSERT_EQ(want[i].cmd, got[i].cmd) << sorting << " at " << i;
+		}
+	}
+}
+
+TEST(proc_table, sorts_the_visible_rows_first) {
+	std::vector<Proc::proc_info> procs;
+	for (size_t i = 0; i < 500; ++i) {
+		Proc::proc_info p{1 + i};
+		p.cpu_p = static_cast<double>((i * 7919) % 101);
+		p.filtered = i % 5 == 0;
+		procs.push_back(std::move(p));
+	}
+	auto full = procs;
+	EXPECT_EQ(Proc::proc_sorter(full, "cpu direct", false), SIZE_MAX);
+	std::erase_if(full, [](const auto& p) { return p.filtered; });
+
+	const auto expect_rows = [&](const std::vector<Proc::proc_info>& got, size_t rows) {
+		size_t n = 0;
+		for (const auto& p : got) {
+			if (p.filtered) continue;
+			if (n == rows) break;
+			//? Equal values are in the order they had before, which isn't the same in both lists after the first sort
+			ASSERT_EQ(p.cpu_p, full[n].cpu_p) << "row " << n;
+			++n;
+		}
+		EXPECT_EQ(n, std::min(rows, full.size()));
+	};
+
+	//? The first rows are in order, the rest is only extended when scrolled to
+	auto partial = procs;
+	EXPECT_EQ(Proc::proc_sorter(partial, "cpu direct", false, false, 40), 40u);
+	expect_rows(partial, 40);
+	EXPECT_EQ(partial.size(), procs.size());
+	EXPECT_EQ(Proc::proc_sorter(partial, "cpu direct", false, false, 120, 40), 120u);
+	expect_rows(partial, 120);
+	EXPECT_EQ(Proc::proc_sorter(partial, "cpu direct", false, false, 1000, 120), SIZE_MAX);
+	expect_rows(partial, full.size());
+
+	//? The tree needs the whole list in order
+	auto tree = procs;
+	EXPECT_EQ(Proc::proc_sorter(tree, "cpu direct", false, true, 40), SIZE_MAX);
+}
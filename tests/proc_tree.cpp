@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mbtop_config.hpp"
+#include "mbtop_shared.hpp"
+
+namespace rng = std::ranges;
+using Proc::proc_info;
+
+namespace Legacy {
+	//* The process tree as it was built before tree_builder, recursive over a tree of references to the list
+	struct tree_proc {
+		std::reference_wrapper<proc_info> entry;
+		std::vector<tree_proc> children;
+	};
+
+	void tree_gen(proc_info& cur_proc, std::vector<proc_info>& in_procs, std::vector<tree_proc>& out_procs, int cur_depth, bool collapsed,
+				  const std::string& filter, bool found, bool no_update, bool should_filter) {
+		bool filtering = false;
+		if (not found and (should_filter or not filter.empty())) {
+			if (not Proc::matches_filter(cur_proc, filter)) {
+				filtering = true;
+				cur_proc.filtered = true;
+				Proc::filter_found++;
+			}
+			else {
+				found = true;
+				cur_depth = 0;
+			}
+		}
+		else if (cur_proc.filtered) cur_proc.filtered = false;
+		cur_proc.depth = cur_depth;
+
+		out_procs.push_back({cur_proc, {}});
+		if (not collapsed and not filtering and cur_proc.short_cmd.empty() and not cur_proc.cmd.empty()) {
+			std::string_view cmd_view = cur_proc.cmd;
+			cmd_view = cmd_view.substr((size_t)0, std::min(cmd_view.find(' '), cmd_view.size()));
+			cmd_view = cmd_view.substr(std::min(cmd_view.find_last_of('/') + 1, cmd_view.size()));
+			cur_proc.short_cmd = std::string{cmd_view};
+		}
+
+		const auto add = [&](const proc_info& p) {
+			cur_proc.cpu_p += p.cpu_p;
+			cur_proc.cpu_c += p.cpu_c;
+			cur_proc.mem += p.mem;
+			cur_proc.threads += p.threads;
+		};
+		for (auto& p : rng::equal_range(in_procs, cur_proc.pid, rng::less{}, &proc_info::ppid)) {
+			if (collapsed and not filtering) cur_proc.filtered = true;
+			tree_gen(p, in_procs, out_procs.back().children, cur_depth + 1, (collapsed or cur_proc.collapsed), filter, found, no_update, should_filter);
+			if (not no_update and not filtering and (collapsed or cur_proc.collapsed)) {
+				if (p.state != 'X') add(p);
+				Proc::filter_found++;
+				p.filtered = true;
+			}
+			else if (Config::getB("proc_aggregate") and p.state != 'X') add(p);
+		}
+	}
+
+	//? Only the columns the tests sort by
+	void tree_sort(std::vector<tree_proc>& proc_vec, const std::string& sorting, bool reverse, bool paused, int& c_index, const int index_max, bool collapsed = false) {
+		if (proc_vec.size() > 1 and not paused) {
+			const auto by = [&](auto key) {
+				rng::stable_sort(proc_vec, [&](const auto& a, const auto& b) { return reverse ? key(a.entry.get()) < key(b.entry.get()) : key(a.entry.get()) > key(b.entry.get()); });
+			};
+			if (sorting == "cpu direct") by([](const proc_info& p) { return p.cpu_p; });
+			else if (sorting == "threads") by([](const proc_info& p) { return p.threads; });
+		}
+		for (auto& r : proc_vec) {
+			r.entry.get().tree_index = (collapsed or r.entry.get().filtered ? index_max : c_index++);
+			if (not r.children.empty()) {
+				tree_sort(r.children, sorting, reverse, paused, c_index, index_max, (collapsed or r.entry.get().collapsed or r.entry.get().tree_index == (size_t)index_max));
+			}
+		}
+	}
+
+	void collect_prefixes(tree_proc& t, const bool is_last, const std::string& header = "") {
+		const bool is_filtered = t.entry.get().filtered;
+		if (is_filtered) t.entry.get().depth = 0;
+		if (not t.children.empty()) t.entry.get().prefix = header + (t.entry.get().collapsed ? "[+]─" : "[-]─");
+		else t.entry.get().prefix = header + (is_last ? " └─" : " ├─");
+		for (auto child = t.children.begin(); child != t.children.end(); ++child) {
+			collect_prefixes(*child, child == (t.children.end() - 1), is_filtered ? "" : header + (is_last ? "   " : " │ "));
+		}
+	}
+
+	void build(std::vector<proc_info>& procs, const std::string& sorting, bool reverse, bool keep_order, const std::string& filter, bool no_update) {
+		std::vector<tree_proc> tree_procs;
+		rng::stable_sort(procs, rng::less{}, &proc_info::ppid);
+		for (auto& p : rng::equal_range(procs, procs.at(0).ppid, rng::less{}, &proc_info::ppid)) {
+			tree_gen(p, procs, tree_procs, 0, false, filter, false, no_update, false);
+		}
+		int index = 0;
+		tree_sort(tree_procs, sorting, reverse, keep_order, index, procs.size());
+		for (auto t = tree_procs.begin(); t != tree_procs.end(); ++t) collect_prefixes(*t, t == tree_procs.end() - 1);
+		rng::stable_sort(procs, rng::less{}, &proc_info::tree_index);
+	}
+}
+
+namespace {
+	//* Two roots below pid 0, a chain deeper than any recursion should go and wide levels with repeating values
+	std::vector<proc_info> make_tree() {
+		const char* names[] = {"bash", "python3", "nginx", "postgres", "sshd"};
+		std::vector<proc_info> procs;
+		const auto add = [&](size_t pid, size_t ppid) {
+			proc_info p{pid};
+			p.ppid = ppid;
+			p.name = names[pid % 5];
+			p.cmd = "/usr/bin/" + p.name + " --id " + std::to_string(pid);
+			p.cpu_p = static_cast<double>((pid * 7) % 13);
+			p.cpu_c = static_cast<double>(pid % 3);
+			p.mem = (pid * 11) % 17;
+			p.threads = 1 + pid % 4;
+			p.state = pid % 23 == 0 ? 'X' : 'S';
+			p.collapsed = pid % 97 == 0;
+			procs.push_back(std::move(p));
+		};
+		add(1, 0);
+		add(2, 0);
+		for (size_t pid = 3; pid < 1500; ++pid) add(pid, pid % 4 == 0 ? 2 : 1 + (pid * 31) % (pid - 1));
+		for (size_t pid = 1500; pid < 4000; ++pid) add(pid, pid - 1);
+		//? Parents don't come before their children in the list
+		std::vector<proc_info> shuffled;
+		for (size_t i = 0; i < procs.size(); ++i) shuffled.push_back(procs[(i * 1009) % procs.size()]);
+		return shuffled;
+	}
+
+	void expect_same_tree(const std::vector<proc_info>& want, const std::vector<proc_info>& got, const std::string& what) {
+		ASSERT_EQ(want.size(), got.size());
+		std::unordered_map<size_t, const proc_info*> by_pid;
+		for (const auto& p : got) by_pid[p.pid] = &p;
+		for (size_t i = 0; i < want.size(); ++i) {
+			const auto& w = want[i];
+			//? Hidden processes come last in no particular order
+			if (w.tree_index != want.size()) {
+				ASSERT_EQ(w.pid, got[i].pid) << what << " at row " << i;
+			}
+			const auto& g = *by_pid.at(w.pid);
+			ASSERT_EQ(w.tree_index, g.tree_index) << what << " pid " << w.pid;
+			ASSERT_EQ(w.filtered, g.filtered) << what << " pid " << w.pid;
+			ASSERT_EQ(w.depth, g.depth) << what << " pid " << w.pid;
+			ASSERT_EQ(w.prefix, g.prefix) << what << " pid " << w.pid;
+			ASSERT_EQ(w.short_cmd, g.short_cmd) << what << " pid " << w.pid;
+			ASSERT_EQ(w.cpu_p, g.cpu_p) << what << " pid " << w.pid;
+			ASSERT_EQ(w.cpu_c, g.cpu_c) << what << " pid " << w.pid;
+			ASSERT_EQ(w.mem, g.mem) << what << " pid " << w.pid;
+			ASSERT_EQ(w.threads, g.threads) << what << " pid " << w.pid;
+		}
+	}
+}
+
+TEST(proc_tree, builds_like_the_recursive_tree) {
+	const auto procs = make_tree();
+	struct variant {
+		std::string sorting;
+		bool reverse, keep_order, no_update, aggregate;
+		std::string filter;
+	};
+	for (const auto& v : std::vector<variant>{
+			{"cpu direct", false, false, false, false, ""}, {"threads", true, false, false, true, ""},
+			{"pid", false, false, true, false, ""}, {"cpu direct", false, true, false, false, ""},
+			{"cpu direct", false, false, false, true, "python"}, {"threads", false, false, true, false, "nginx"}}) {
+		const std::string what = v.sorting + " filter '" + v.filter + "'";
+		Config::set("proc_aggregate", v.aggregate);
+		auto want = procs, got = procs;
+		Proc::filter_found = 0;
+		Legacy::build(want, v.sorting, v.reverse, v.keep_order, v.filter, v.no_update);
+		const int want_found = Proc::filter_found;
+		Proc::filter_found = 0;
+		Proc::tree_builder tree;
+		tree.build(got, v.sorting, v.reverse, v.keep_order, v.filter, v.no_update, false);
+		EXPECT_EQ(want_found, Proc::filter_found) << what;
+		expect_same_tree(want, got, what);
+	}
+	Config::set("proc_aggregate", false);
+	Proc::filter_found = 0;
+}
+
+TEST(proc_tree, keeps_prefixes_until_the_tree_changes) {
+	const auto procs = make_tree();
+	Proc::tree_builder tree;
+	auto first = procs;
+	tree.build(first, "cpu direct", false, false, "", false, false);
+	EXPECT_EQ(tree.rebuilt_prefixes(), procs.size());
+
+	//? The next update starts from the prefixes the processes had
+	const auto next_update = [&](const std::vector<proc_info>& last, size_t collapse_pid) {
+		std::unordered_map<size_t, std::string> prefixes;
+		for (const auto& p : last) prefixes[p.pid] = p.prefix;
+		auto next = procs;
+		for (auto& p : next) {
+			p.prefix = prefixes.at(p.pid);
+			if (p.pid == collapse_pid) p.collapsed = true;
+		}
+		return next;
+	};
+	auto same = next_update(first, 0);
+	tree.build(same, "cpu direct", false, false, "", false, false);
+	EXPECT_EQ(tree.rebuilt_prefixes(), 0u);
+
+	//? Collapsing a process changes its own prefix and the prefixes of the processes it hides, the rest are kept
+	auto collapsed = next_update(same, 1520);
+	tree.build(collapsed, "cpu direct", false, false, "", false, false);
+	std::unordered_map<size_t, std::string> before;
+	for (const auto& p : same) before[p.pid] = p.prefix;
+	size_t changed = 0;
+	for (const auto& p : collapsed) {
+		if (p.prefix == before.at(p.pid)) continue;
+		++changed;
+		EXPECT_TRUE(p.pid == 1520 or p.tree_index == procs.size()) << "pid " << p.pid;
+	}
+	EXPECT_EQ(tree.rebuilt_prefixes(), changed);
+	EXPECT_LT(changed, procs.size() / 10);
+
+	auto want = next_update(same, 1520);
+	Legacy::build(want, "cpu direct", false, false, "", false);
+	expect_same_tree(want, collapsed, "collapsed");
+}
@@ -0,0 +1,344 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "linux/procfs.hpp"
+#include "linux/read_batch.hpp"
+#include "mbtop_tools.hpp"
+
+namespace fs = std::filesystem;
+
+TEST(procfs, parse_stat) {
+	const std::string line =
+		"1234 (bash) S 1000 1234 1234 34816 1234 4194304 2914 16092 0 3 7 5 12 9 20 -5 3 0 4242 23478272 1337 "
+		"18446744073709551615 1 1 0 0 0 0 65536 3670020 1266777851 0 0 0 17 2 0 0 0 0 0\n";
+	Procfs::stat_fields stat;
+	ASSERT_TRUE(Procfs::parse_stat(line, stat));
+	EXPECT_EQ(stat.state, 'S');
+	EXPECT_EQ(stat.ppid, 1000u);
+	EXPECT_EQ(stat.utime, 7u);
+	EXPECT_EQ(stat.stime, 5u);
+	EXPECT_EQ(stat.nice, -5);
+	EXPECT_EQ(stat.threads, 3u);
+	EXPECT_EQ(stat.starttime, 4242u);
+	EXPECT_EQ(stat.rss_pages, 1337u);
+}
+
+TEST(procfs, parse_stat_odd_names) {
+	Procfs::stat_fields stat;
+	//? Spaces and parentheses are allowed in the command name
+	ASSERT_TRUE(Procfs::parse_stat("77 (Web (Content) 2) R 1 0 0 0 0 0 0 0 0 0 100 200 0 0 20 0 31 0 999 0 512\n", stat));
+	EXPECT_EQ(stat.state, 'R');
+	EXPECT_EQ(stat.ppid, 1u);
+	EXPECT_EQ(stat.utime, 100u);
+	EXPECT_EQ(stat.stime, 200u);
+	EXPECT_EQ(stat.threads, 31u);
+	EXPECT_EQ(stat.starttime, 999u);
+	EXPECT_EQ(stat.rss_pages, 512u);
+}
+
+TEST(procfs, parse_stat_truncated) {
+	Procfs::stat_fields stat;
+	EXPECT_FALSE(Procfs::parse_stat("", stat));
+	EXPECT_FALSE(Procfs::parse_stat("12 bash S 1", stat));
+	EXPECT_FALSE(Procfs::parse_stat("12 (bash) S 1 0 0 0 0 0 0 0 0 0 100 200", stat));
+}
+
+TEST(procfs, field_helpers) {
+	EXPECT_EQ(Procfs::parse_statm_resident("5917 1337 744 250 0 1082 0\n"), 1337u);
+	EXPECT_EQ(Procfs::parse_statm_resident("5917"), std::nullopt);
+
+	EXPECT_EQ(Procfs::parse_cpu_total("cpu  10 20 30 40 0 0 0 0 0 0\ncpu0 5 10 15 20 0 0 0 0 0 0\n"), 100u);
+
+	const std::string status = "Name:\tbash\nUmask:\t0022\nState:\tS (sleeping)\nUid:\t1000\t1000\t1000\t1000\nGid:\t100\n";
+	EXPECT_EQ(Procfs::find_key(status, "Uid"), "1000");
+	EXPECT_EQ(Procfs::find_key(status, "State"), "S");
+	EXPECT_EQ(Procfs::find_key(status, "Ui"), "");
+	EXPECT_EQ(Procfs::find_key(status, "VmRSS"), "");
+
+	EXPECT_EQ(Procfs::sum_smaps_rss("Size:  8 kB\nRss:   4 kB\nPss: 4 kB\nSize: 12 kB\nRss:  12 kB\n"), 16u);
+
+	EXPECT_EQ(Procfs::to_u64("123abc"), 123u);
+	EXPECT_EQ(Procfs::to_u64("abc", 7), 7u);
+}
+
+TEST(procfs, cmdline) {
+	std::string cmd;
+	Procfs::cmdline_to(std::string_view{"/usr/bin/python3\0-m\0http.server\0", 32}, cmd);
+	EXPECT_EQ(cmd, "/usr/bin/python3 -m http.server");
+
+	//? Processes that rewrite their argv might not terminate it
+	Procfs::cmdline_to("nginx: worker process", cmd);
+	EXPECT_EQ(cmd, "nginx: worker process");
+
+	Procfs::cmdline_to("", cmd);
+	EXPECT_EQ(cmd, "");
+
+	Procfs::cmdline_to(std::string(2000, 'x'), cmd);
+	EXPECT_EQ(cmd.size(), 999u);
+}
+
+TEST(procfs, read_pid) {
+	const auto root = fs::temp_directory_path() / ("mbtop_procfs_" + std::to_string(getpid()));
+	fs::create_directories(root / "42");
+	std::ofstream(root / "42" / "comm") << "worker\n";
+	//? Larger than the initial buffer to exercise growth
+	std::ofstream(root / "42" / "environ") << std::string(10000, 'e');
+
+	const int dir_fd = Procfs::open_dir(root.c_str());
+	ASSERT_GE(dir_fd, 0);
+
+	auto comm = Procfs::read_pid(dir_fd, 42, "comm");
+	ASSERT_TRUE(comm.has_value());
+	EXPECT_EQ(*comm, "worker\n");
+
+	auto environ = Procfs::read_pid(dir_fd, 42, "environ");
+	ASSERT_TRUE(environ.has_value());
+	EXPECT_EQ(environ->size(), 10000u);
+
+	EXPECT_FALSE(Procfs::read_pid(dir_fd, 43, "comm").has_value());
+
+	close(dir_fd);
+	fs::remove_all(root);
+}
+
+TEST(procfs, sample_all_sharded_matches_serial) {
+	const auto root = fs::temp_directory_path() / ("mbtop_procfs_sample_" + std::to_string(getpid()));
+	constexpr size_t pids = 1200;
+	constexpr uint64_t statm_min_pages = 100000;
+
+	//? Every few pids is missing a file or has a malformed one, to cover every stage sample() can stop at
+	for (size_t pid = 1; pid <= pids; ++pid) {
+		const auto dir = root / std::to_string(pid);
+		fs::create_directories(dir);
+		std::ofstream(dir / "comm") << "proc " << pid << '\n';
+		if (pid % 7 != 0) std::ofstream(dir / "cmdline") << "/usr/bin/proc" << '\0' << "--id" << '\0' << pid << '\0';
+		std::ofstream(dir / "status") << "Name:\tproc\nUid:\t" << pid % 3 * 1000 << "\t0\t0\t0\n";
+		if (pid % 11 == 0) continue;
+		if (pid % 13 == 0) std::ofstream(dir / "stat") << pid << " (proc) S 1";
+		else {
+			const uint64_t rss = (pid % 5 == 0) ? statm_min_pages + pid : pid * 10;
+			std::ofstream(dir / "stat") << pid << " (proc " << pid << ") S " << pid / 2 << " 0 0 0 0 0 0 0 0 0 "
+				<< pid * 3 << ' ' << pid << " 0 0 20 " << static_cast<int>(pid % 40) - 20 << ' ' << pid % 9 + 1 << " 0 "
+				<< pid * 100 << " 0 " << rss << '\n';
+		}
+		if (pid % 17 != 0) std::ofstream(dir / "statm") << "1000 " << pid * 4 << " 0 0 0 0 0\n";
+	}
+
+	const int dir_fd = Procfs::open_dir(root.c_str());
+	ASSERT_GE(dir_fd, 0);
+
+	std::vector<Procfs::pid_sample> serial(pids);
+	for (size_t i = 0; i < pids; ++i) {
+		serial[i].pid = i + 1;
+		serial[i].with_names = (i % 2 == 0);
+	}
+	const auto input = serial;
+	Procfs::sample_all(dir_fd, serial, statm_min_pages);
+
+	EXPECT_EQ(serial[0].reached, Procfs::stage::stat);
+	EXPECT_EQ(serial[0].name, "proc 1");
+	EXPECT_EQ(serial[0].cmd, "/usr/bin/proc --id 1");
+	EXPECT_EQ(serial[6].reached, Procfs::stage::comm);
+	EXPECT_EQ(serial[10].reached, Procfs::stage::status);
+	EXPECT_EQ(serial[12].reached, Procfs::stage::stat_read);
+	EXPECT_EQ(serial[4].statm_pages, 20u);
+	EXPECT_EQ(serial[3].statm_pages, std::nullopt);
+
+	for (const size_t threads : {1, 2, 3, 7}) {
+		Tools::WorkerPool pool(threads);
+		auto sharded = input;
+		Procfs::sample_all(dir_fd, sharded, statm_min_pages, &pool);
+		ASSERT_EQ(sharded.size(), serial.size());
+		for (size_t i = 0; i < pids; ++i)
+			EXPECT_TRUE(sharded[i] == serial[i]) << "pid " << i + 1 << " differs with " << threads << " threads";
+	}
+
+	close(dir_fd);
+	fs::remove_all(root);
+}
+
+TEST(procfs, fd_cache) {
+	auto open_null = [] { return open("/dev/null", O_RDONLY | O_CLOEXEC); };
+	Procfs::fd_cache cache(3);
+	const int a = open_null(), b = open_null(), c = open_null();
+	cache.put(1, 100, a);
+	cache.put(2, 200, b);
+	cache.put(3, 300, c);
+	EXPECT_EQ(cache.size(), 3u);
+
+	//? Full, the least recently used descriptor is closed to make room for the new one
+	EXPECT_EQ(cache.get(1, 100), a);
+	const int d = open_null();
+	cache.put(4, 400, d);
+	EXPECT_EQ(cache.size(), 3u);
+	EXPECT_EQ(fcntl(b, F_GETFD), -1);
+	EXPECT_EQ(cache.get(2, 200), -1);
+	EXPECT_EQ(cache.get(4, 400), d);
+	EXPECT_EQ(cache.get(3, 300), c);
+
+	//? Different start time is a reused pid, the stale entry is dropped and closed
+	EXPECT_EQ(cache.get(3, 301), -1);
+	EXPECT_EQ(cache.size(), 2u);
+	EXPECT_EQ(fcntl(c, F_GETFD), -1);
+
+	//? Shrinking evicts the least recently used
+	EXPECT_EQ(cache.get(1, 100), a);
+	cache.resize(1);
+	EXPECT_EQ(cache.size(), 1u);
+	EXPECT_EQ(cache.get(4, 400), -1);
+	EXPECT_EQ(fcntl(d, F_GETFD), -1);
+	EXPECT_EQ(cache.get(1, 100), a);
+
+	cache.retain([](size_t pid) { return pid != 1; });
+	EXPECT_EQ(cache.size(), 0u);
+	EXPECT_EQ(fcntl(a, F_GETFD), -1);
+
+	EXPECT_GT(Procfs::fd_budget(), 0u);
+}
+
+TEST(procfs, sample_stat_fd_and_reuse) {
+	const auto root = fs::temp_directory_path() / ("mbtop_procfs_reuse_" + std::to_string(getpid()));
+	const auto dir = root / "42";
+	fs::create_directories(dir);
+	std::ofstream(dir / "comm") << "old\n";
+	std::ofstream(dir / "cmdline") << "old";
+	std::ofstream(dir / "status") << "Uid:\t1000\n";
+	std::ofstream(dir / "stat") << "42 (old) S 1 0 0 0 0 0 0 0 0 0 10 20 0 0 20 0 1 0 5000 0 100\n";
+
+	const int dir_fd = Procfs::open_dir(root.c_str());
+	ASSERT_GE(dir_fd, 0);
+
+	//? First sample opens the descriptor for the caller to keep
+	Procfs::pid_sample sample;
+	sample.pid = 42;
+	sample.keep_stat_fd = true;
+	Procfs::sample(dir_fd, sample, -1);
+	ASSERT_EQ(sample.reached, Procfs::stage::stat);
+	ASSERT_GE(sample.opened_fd, 0);
+	const int stat_fd = sample.opened_fd;
+
+	//? Following samples read through it
+	std::ofstream(dir / "stat") << "42 (old) S 1 0 0 0 0 0 0 0 0 0 15 25 0 0 20 0 1 0 5000 0 100\n";
+	sample.keep_stat_fd = false;
+	sample.stat_fd = stat_fd;
+	sample.starttime = 5000;
+	Procfs::sample(dir_fd, sample, -1);
+	EXPECT_EQ(sample.reached, Procfs::stage::stat);
+	EXPECT_FALSE(sample.stale_fd);
+	EXPECT_FALSE(sample.reused);
+	EXPECT_EQ(sample.opened_fd, -1);
+	EXPECT_EQ(sample.stat.utime, 15u);
+	close(stat_fd);
+
+	//? A descriptor that can't be read is stale and stat is read by path, which here belongs to a new process
+	std::ofstream(dir / "comm") << "new\n";
+	std::ofstream(dir / "stat") << "42 (new) R 7 0 0 0 0 0 0 0 0 0 1 1 0 0 20 0 1 0 9000 0 100\n";
+	sample.stat_fd = dir_fd;
+	Procfs::sample(dir_fd, sample, -1);
+	EXPECT_TRUE(sample.stale_fd);
+	EXPECT_TRUE(sample.reused);
+	EXPECT_TRUE(sample.with_names);
+	EXPECT_EQ(sample.reached, Procfs::stage::stat);
+	EXPECT_EQ(sample.name, "new");
+	EXPECT_EQ(sample.stat.starttime, 9000u);
+	EXPECT_EQ(sample.stat.ppid, 7u);
+
+	close(dir_fd);
+	fs::remove_all(root);
+}
+
+TEST(procfs, read_batch) {
+	const auto root = fs::temp_directory_path() / ("mbtop_procfs_batch_" + std::to_string(getpid()));
+	fs::create_directories(root);
+	const std::string large(10000, 'x');
+	std::ofstream(root / "a") << "1\n";
+	std::ofstream(root / "b") << large;
+
+	//? Same results with and without io_uring, the latter falls back to pread where io_uring isn't available
+	for (const bool use_uring : {false, true}) {
+		Procfs::read_batch batch;
+		std::ofstream(root / "a") << "1\n";
+
+		//? Unknown files are read right away
+		EXPECT_EQ(batch.read(root / "a"), "1\n");
+		EXPECT_EQ(batch.read(root / "b"), large);
+		EXPECT_EQ(batch.read(root / "missing"), std::nullopt);
+		EXPECT_EQ(batch.size(), 3u);
+
+		//? Known files are read by run() and served from its buffers
+		std::ofstream(root / "a") << "22\n";
+		batch.run(use_uring);
+		EXPECT_EQ(batch.uses_uring(), use_uring and Procfs::read_batch::uring_supported());
+		EXPECT_EQ(batch.last_read_count(), 2u);
+		EXPECT_EQ(batch.last_syscall_count(), batch.uses_uring() ? 1u : 2u);
+		EXPECT_EQ(batch.read(root / "a"), "22\n");
+		EXPECT_EQ(batch.read(root / "b"), large);
+		EXPECT_EQ(batch.read(root / "missing"), std::nullopt);
+
+		//? Files that weren't asked for since the last run are dropped
+		batch.run(use_uring);
+		EXPECT_EQ(batch.read(root / "a"), "22\n");
+		batch.run(use_uring);
+		EXPECT_EQ(batch.size(), 1u);
+		EXPECT_EQ(batch.last_read_count(), 1u);
+	}
+
+	fs::remove_all(root);
+}
+
+TEST(procfs, dir_lister) {
+	const auto root = fs::temp_directory_path() / ("mbtop_procfs_list_" + std::to_string(getpid()));
+	fs::create_directories(root / "self");
+	std::ofstream(root / "stat") << "";
+	//? Enough entries to need several getdents64() calls with a small buffer
+	std::set<size_t> expected;
+	for (size_t pid = 1; pid <= 3000; pid += 3) {
+		fs::create_directory(root / std::to_string(pid));
+		expected.insert(pid);
+	}
+
+	const int dir_fd = Procfs::open_dir(root.c_str());
+	ASSERT_GE(dir_fd, 0);
+	Procfs::dir_lister lister(1024);
+
+	//? Listing twice starts over from the beginning
+	for (int round = 0; round < 2; round++) {
+		std::vector<size_t> pids;
+		ASSERT_TRUE(lister.numbers(dir_fd, pids));
+		EXPECT_EQ(std::set<size_t>(pids.begin(), pids.end()), expected);
+		EXPECT_EQ(pids.size(), expected.size());
+	}
+
+	std::set<std::string> names;
+	ASSERT_TRUE(lister.each(root.c_str(), [&](std::string_view name, unsigned char type) {
+		if (name[0] >= '0' and name[0] <= '9') return;
+		names.emplace(name);
+		if (name == "self") { EXPECT_EQ(type, DT_DIR); }
+		if (name == "stat") { EXPECT_EQ(type, DT_REG); }
+	}));
+	EXPECT_TRUE(names.contains("self"));
+	EXPECT_TRUE(names.contains("stat"));
+	EXPECT_FALSE(names.contains("."));
+	EXPECT_FALSE(names.contains(".."));
+
+	//? Returning false stops the listing
+	size_t seen = 0;
+	EXPECT_TRUE(lister.each(dir_fd, [&](std::string_view, unsigned char) { return ++seen < 10; }));
+	EXPECT_EQ(seen, 10u);
+
+	EXPECT_FALSE(lister.each((root / "missing").c_str(), [](std::string_view, unsigned char) {}));
+
+	close(dir_fd);
+	fs::remove_all(root);
+}
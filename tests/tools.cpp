@@ -1,5 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
+#include <random>
+#include <regex>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include <limits>
 #include <cstdint>
@@ -28,6 +33,36 @@ TEST(tools, string_split) {
 // Safe Numeric Conversion Tests
 // =============================================================================
 
+TEST(escape_scanner, strips_sequences) {
+	EXPECT_EQ(Fx::uncolor(Fx::b + "cpu" + Fx::ub + "\x1b[38;2;10;200;3m" + "12%" + Fx::reset_base), "cpu12%");
+	EXPECT_EQ(Fx::uncolor(Mv::to(3, 4) + "a"), Mv::to(3, 4) + "a");
+	EXPECT_EQ(Fx::unescape(Mv::to(3, 4) + "a" + Mv::r(2) + "\x1b[31m" + "b"), "ab");
+
+	//? Not matched: no digit (like save and restore cursor), two digits in the second of five fields, six fields, other finals
+	for (const std::string s : {"\x1b[m", "\x1b[s", "\x1b[38;22;1;2;3m", "\x1b[1;2;3;4;5;6m", "\x1b[?25l", "\x1b[2J", "\x1b[12", "\x1b"})
+		EXPECT_EQ(Fx::unescape(s), s);
+
+	EXPECT_EQ(Fx::escape_len("\x1b[1;2;3;4;5mx"), 12u);
+	EXPECT_EQ(Fx::escape_len("\x1b[1;2f", true), 0u);
+	EXPECT_EQ(Fx::escape_len("x\x1b[1m"), 0u);
+}
+
+TEST(escape_scanner, matches_former_regexes) {
+	const std::regex escape_regex("\033\\[\\d+;?\\d?;?\\d*;?\\d*;?\\d*(m|f|s|u|C|D|A|B){1}");
+	const std::regex color_regex("\033\\[\\d+;?\\d?;?\\d*;?\\d*;?\\d*(m){1}");
+	const std::vector<std::string> pieces = {
+		"\x1b[", "\x1b[", "\x1b", "[", "0", "1", "7", "38", "255", ";", ";", ";;",
+		"m", "m", "f", "s", "u", "C", "D", "A", "B", "H", "J", "?", "x", " ", "│", "⣿"
+	};
+	std::mt19937 rng(2024);
+	for (int n = 0; n < 20000; ++n) {
+		std::string s;
+		for (int i = 0, count = static_cast<int>(rng() % 24); i < count; ++i) s += pieces[rng() % pieces.size()];
+		ASSERT_EQ(Fx::uncolor(s), std::regex_replace(s, color_regex, "")) << s;
+		ASSERT_EQ(Fx::unescape(s), std::regex_replace(s, escape_regex, "")) << s;
+	}
+}
+
 TEST(safe_conversions, stoi_safe_valid_input) {
 	EXPECT_EQ(Tools::stoi_safe("0"), 0);
 	EXPECT_EQ(Tools::stoi_safe("42"), 42);
@@ -229,3 +264,132 @@ TEST(edge_cases, real_world_parsing) {
 	idx = Tools::stoi_safe(pstate.substr(1), -1) - 1;
 	EXPECT_EQ(idx, 2);  // P3 -> index 2
 }
+
+TEST(worker_pool, parallel_for_covers_range_once) {
+	for (const size_t threads : {0, 1, 3}) {
+		Tools::WorkerPool pool(threads);
+		for (const size_t count : {0, 1, 5, 1000, 1001}) {
+			std::vector<int> hits(count);
+			std::atomic<size_t> shards{};
+			pool.parallel_for(count, [&](size_t begin, size_t end) {
+				++shards;
+				for (size_t i = begin; i < end; ++i) ++hits[i];
+			}, 100);
+			EXPECT_EQ(std::ranges::count(hits, 1), static_cast<long>(count));
+			EXPECT_LE(shards.load(), threads + 1);
+		}
+	}
+}
+
+TEST(worker_pool, parallel_for_rethrows) {
+	Tools::WorkerPool pool(2);
+	EXPECT_THROW(pool.parallel_for(300, [](size_t begin, size_t) {
+		if (begin == 0) throw std::runtime_error("shard failed");
+	}), std::runtime_error);
+
+	//? The pool is still usable afterwards
+	std::atomic<size_t> total{};
+	pool.parallel_for(300, [&](size_t begin, size_t end) { total += end - begin; });
+	EXPECT_EQ(total.load(), 300u);
+}
+
+TEST(worker_pool, resize_and_submit) {
+	Tools::WorkerPool pool;
+	int ran = 0;
+	pool.submit([&] { ++ran; }).get();
+	EXPECT_EQ(ran, 1);
+
+	pool.resize(4);
+	EXPECT_EQ(pool.size(), 4u);
+	std::atomic<int> count{};
+	std::vector<std::future<void>> futures;
+	for (int i = 0; i < 50; ++i) futures.push_back(pool.submit([&] { ++count; }));
+	for (auto& f : futures) f.get();
+	EXPECT_EQ(count.load(), 50);
+
+	pool.resize(1);
+	EXPECT_EQ(pool.size(), 1u);
+	pool.submit([&] { ++count; }).get();
+	EXPECT_EQ(count.load(), 51);
+}
+
+TEST(timer_wheel, fires_each_timer_on_its_own_interval) {
+	Tools::TimerWheel wheel(16, 10);
+	wheel.set(0, 250, 1000);
+	wheel.set(1, 2000, 1000);
+	EXPECT_EQ(wheel.next_due(), 1000u);
+
+	std::vector<size_t> fired;
+	std::vector<size_t> counts(2);
+	for (uint64_t now = 1000; now < 5000; now += 50) {
+		fired.clear();
+		wheel.expire(now, fired);
+		for (const auto id : fired) ++counts[id];
+		EXPECT_GT(wheel.next_due(), now);
+	}
+	EXPECT_EQ(counts[0], 16u);
+	EXPECT_EQ(counts[1], 2u);
+	EXPECT_EQ(wheel.due(0), 5000u);
+	EXPECT_EQ(wheel.due(1), 5000u);
+}
+
+TEST(timer_wheel, next_due_beyond_one_revolution) {
+	Tools::TimerWheel wheel(8, 10);
+	wheel.set(2, 5000, 5000);
+	wheel.set(0, 100, 130);
+	EXPECT_EQ(wheel.next_due(), 130u);
+
+	std::vector<size_t> fired;
+	wheel.expire(129, fired);
+	EXPECT_TRUE(fired.empty());
+	wheel.expire(130, fired);
+	EXPECT_EQ(fired, std::vector<size_t>{0});
+	EXPECT_EQ(wheel.next_due(), 230u);
+
+	wheel.cancel(0);
+	EXPECT_FALSE(wheel.armed(0));
+	EXPECT_EQ(wheel.next_due(), 5000u);
+	EXPECT_EQ(Tools::TimerWheel().next_due(), UINT64_MAX);
+}
+
+TEST(timer_wheel, skips_missed_periods) {
+	Tools::TimerWheel wheel(4, 10);
+	wheel.set(1, 100, 100);
+	wheel.set(0, 300, 100);
+	std::vector<size_t> fired;
+	wheel.expire(1050, fired);
+	EXPECT_EQ(fired, (std::vector<size_t>{0, 1}));
+	EXPECT_EQ(wheel.due(1), 1100u);
+	EXPECT_EQ(wheel.due(0), 1300u);
+
+	//? Resetting a timer replaces its earlier schedule
+	wheel.set(1, 500, 2000);
+	fired.clear();
+	wheel.expire(1999, fired);
+	EXPECT_EQ(fired, std::vector<size_t>{0});
+	EXPECT_EQ(wheel.interval(1), 500u);
+	EXPECT_EQ(wheel.next_due(), 2000u);
+}
+
+TEST(timer_wheel, fires_timers_armed_in_the_past) {
+	Tools::TimerWheel wheel(16, 10);
+	wheel.set(0, 1000, 5000);
+	std::vector<size_t> fired;
+	wheel.expire(1000, fired);
+	EXPECT_TRUE(fired.empty());
+
+	//? Behind the slot of the last expire(), due right away instead of after the rest of the revolution
+	wheel.set(1, 500, 920);
+	EXPECT_EQ(wheel.next_due(), 1000u);
+	wheel.expire(1005, fired);
+	EXPECT_EQ(fired, std::vector<size_t>{1});
+	EXPECT_EQ(wheel.due(1), 1500u);
+
+	//? After the clock stepped back
+	fired.clear();
+	wheel.expire(700, fired);
+	wheel.set(2, 100, 600);
+	EXPECT_EQ(wheel.next_due(), 700u);
+	wheel.expire(700, fired);
+	EXPECT_EQ(fired, std::vector<size_t>{2});
+}
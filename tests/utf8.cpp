@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mbtop_tools.hpp"
+#include "widechar_width.hpp"
+
+using std::string;
+using std::vector;
+
+//* The byte by byte implementations the kernels replaced, kept as they were
+namespace Legacy {
+	size_t ulen(const std::string_view str, bool wide = false);
+
+	size_t wide_ulen(const std::string_view str) {
+		if (str.empty())
+			return 0;
+		unsigned int chars = 0;
+
+		const char* str_data = &str.data()[0];
+			size_t w_len = 1 + std::mbstowcs(nullptr, str_data, 0);
+		if (w_len <= 1)
+			return ulen(str);
+		vector<wchar_t> w_str(w_len);
+		std::mbstowcs(&w_str[0], str_data, w_len);
+
+		for (auto c : w_str) {
+			chars += widechar_wcwidth(c);
+
+		}
+
+		return chars;
+	}
+
+	size_t wide_ulen(const vector<wchar_t> w_str) {
+		unsigned int chars = 0;
+
+		for (auto c : w_str) {
+			chars += widechar_wcwidth(c);
+		}
+
+		return chars;
+	}
+
+	size_t ulen(const std::string_view str, bool wide) {
+		return (wide ? wide_ulen(str) : std::ranges::count_if(str, [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; }));
+	}
+
+	string uresize(string str, const size_t len, bool wide = false) {
+		if (len < 1 or str.empty())
+			return "";
+
+		if (wide) {
+			const char* str_data = &str.data()[0];
+			size_t w_len = 1 + std::mbstowcs(nullptr, str_data, 0);
+			if (w_len <= 1)
+				return uresize(str, len, false);
+			vector<wchar_t> w_str(w_len);
+			std::mbstowcs(&w_str[0], str_data, w_len);
+
+			//? Pop characters until display width fits, but preserve null terminator
+			while (w_str.size() > 1 and wide_ulen(w_str) > len) {
+				w_str.pop_back();
+				w_str.back() = L'\0';  //? Ensure null terminator at end
+			}
+
+			//? Calculate required buffer size for UTF-8 output (wcstombs returns bytes needed)
+			size_t mb_len = std::wcstombs(nullptr, &w_str[0], 0);
+			if (mb_len == static_cast<size_t>(-1)) {
+				//? Conversion error, fall back to non-wide resize
+				return uresize(str, len, false);
+			}
+			string n_str;
+			n_str.resize(mb_len);
+			std::wcstombs(&n_str[0], &w_str[0], mb_len);
+
+			return n_str;
+
+		}
+		else {
+			for (size_t x = 0, i = 0; i < str.size(); i++) {
+				if ((static_cast<unsigned char>(str.at(i)) & 0xC0) != 0x80) x++;
+				if (x >= len + 1) {
+					str.resize(i);
+					break;
+				}
+			}
+		}
+		str.shrink_to_fit();
+		return str;
+	}
+
+	string luresize(string str, const size_t len, bool wide = false) {
+		if (len < 1 or str.empty())
+			return "";
+
+		for (size_t x = 0, last_pos = 0, i = str.size() - 1; i > 0 ; i--) {
+			if (wide and static_cast<unsigned char>(str.at(i)) > 0xef) {
+				x += 2;
+				last_pos = std::max((size_t)0, i - 1);
+			}
+			else if ((static_cast<unsigned char>(str.at(i)) & 0xC0) != 0x80) {
+				x++;
+				last_pos = i;
+			}
+			if (x >= len) {
+				str = str.substr(last_pos);
+				str.shrink_to_fit();
+				break;
+			}
+		}
+		return str;
+	}
+
+	string ljust(string str, const size_t x, bool utf = false, bool wide = false, bool limit = true) {
+		if (utf) {
+			if (limit and ulen(str, wide) > x)
+				return uresize(str, x, wide);
+
+			return str + string(std::max((int)(x - ulen(str, wide)), 0), ' ');
+		}
+		else {
+			if (limit and str.size() > x) {
+				str.resize(x);
+				return str;
+			}
+			return str + string(std::max((int)(x - str.size()), 0), ' ');
+		}
+	}
+
+	string rjust(string str, const size_t x, bool utf = false, bool wide = false, bool limit = true) {
+		if (utf) {
+			if (limit and ulen(str, wide) > x)
+				return uresize(str, x, wide);
+
+			return string(std::max((int)(x - ulen(str, wide)), 0), ' ') + str;
+		}
+		else {
+			if (limit and str.size() > x) {
+				str.resize(x);
+				return str;
+			};
+			return string(std::max((int)(x - str.size()), 0), ' ') + str;
+		}
+	}
+
+	string cjust(string str, const size_t x, bool utf = false, bool wide = false, bool limit = true) {
+		if (utf) {
+			if (limit and ulen(str, wide) > x)
+				return uresize(str, x, wide);
+
+			return string(std::max((int)ceil((double)(x - ulen(str, wide)) / 2), 0), ' ') + str + string(std::max((int)floor((double)(x - ulen(str, wide)) / 2), 0), ' ');
+		}
+		else {
+			if (limit and str.size() > x) {
+				str.resize(x);
+				return str;
+			}
+			return string(std::max((int)ceil((double)(x - str.size()) / 2), 0), ' ') + str + string(std::max((int)floor((double)(x - str.size()) / 2), 0), ' ');
+		}
+	}
+}
+
+namespace {
+	//* Random strings from ASCII runs, control characters, multi byte and wide characters, combining marks and invalid bytes
+	vector<string> random_strings(size_t count) {
+		const vector<string> pieces = {
+			"a", "Z", "0", " ", "process_name", "/usr/bin/some-long-command --with arguments", "\t", "\x1b", "\x7f",
+			"é", "ß", "│", "⣿", "日本", "語", "́", "😀", "\U00020000", "Ａ",
+			"\x80", "\xbf", "\xc3", "\xe6\x97", "\xf0\x9f", "\xc0\x80", "\xed\xa0\x80", "\xfe", "\xff"
+		};
+		std::mt19937 rng(7);
+		vector<string> out;
+		for (size_t n = 0; n < count; ++n) {
+			string s;
+			for (int i = 0, parts = static_cast<int>(rng() % 12); i < parts; ++i) {
+				//? Mostly valid strings, one in four may contain invalid bytes
+				const size_t range = (n % 4 == 0 ? pieces.size() : pieces.size() - 8);
+				s += pieces[rng() % range];
+			}
+			out.push_back(s);
+		}
+		return out;
+	}
+
+	class utf8 : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			if (std::setlocale(LC_ALL, "C.UTF-8") == nullptr and std::setlocale(LC_ALL, "en_US.UTF-8") == nullptr)
+				GTEST_SKIP() << "No UTF-8 locale, the legacy implementations depend on it";
+		}
+		void TearDown() override { std::setlocale(LC_ALL, "C"); }
+	};
+}
+
+TEST_F(utf8, lengths_match_legacy) {
+	for (const auto& s : random_strings(4000)) {
+		ASSERT_EQ(Tools::ulen(s), Legacy::ulen(s)) << s;
+		ASSERT_EQ(Tools::ulen(s, true), Legacy::ulen(s, true)) << s;
+	}
+	//? Long ASCII and long mixed strings go through whole blocks
+	const string ascii(1000, 'x'), mixed = string(100, 'x') + "日本語" + string(50, '\t') + "é" + string(70, 'y');
+	EXPECT_EQ(Tools::ulen(ascii, true), 1000u);
+	EXPECT_EQ(Tools::ulen(mixed), Legacy::ulen(mixed));
+	EXPECT_EQ(Tools::ulen(mixed, true), Legacy::ulen(mixed, true));
+}
+
+TEST_F(utf8, resize_matches_legacy) {
+	auto strings = random_strings(1500);
+	strings.push_back(string(80, 'x') + "日本語" + string(40, 'y') + "😀" + string(40, 'z'));
+	for (const auto& s : strings) {
+		const size_t cols = Legacy::ulen(s, true) + 2;
+		for (size_t len = 0; len <= cols; ++len) {
+			for (const bool wide : {false, true}) {
+				ASSERT_EQ(Tools::uresize(s, len, wide), Legacy::uresize(s, len, wide)) << s << " " << len << " " << wide;
+				ASSERT_EQ(Tools::luresize(s, len, wide), Legacy::luresize(s, len, wide)) << s << " " << len << " " << wide;
+			}
+		}
+	}
+}
+
+TEST_F(utf8, justify_matches_legacy) {
+	for (const auto& s : random_strings(1000)) {
+		const size_t cols = Legacy::ulen(s, true) + 3;
+		for (size_t x = 0; x <= cols; ++x) {
+			for (const bool utf : {false, true}) {
+				for (const bool wide : {false, true}) {
+					for (const bool limit : {false, true}) {
+						ASSERT_EQ(Tools::ljust(s, x, utf, wide, limit), Legacy::ljust(s, x, utf, wide, limit)) << s << " " << x;
+						ASSERT_EQ(Tools::rjust(s, x, utf, wide, limit), Legacy::rjust(s, x, utf, wide, limit)) << s << " " << x;
+						ASSERT_EQ(Tools::cjust(s, x, utf, wide, limit), Legacy::cjust(s, x, utf, wide, limit)) << s << " " << x;
+					}
+				}
+			}
+		}
+	}
+}
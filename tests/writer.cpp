@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cerrno>
+#include <string>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "mbtop_writer.hpp"
+
+namespace {
+	//* Pipe closed when the test ends, the write end stands in for the terminal
+	struct pipe_fds {
+		int fds[2]{-1, -1};
+		pipe_fds() { EXPECT_EQ(pipe(fds), 0); }
+		~pipe_fds() {
+			close(fds[0]);
+			close(fds[1]);
+		}
+	};
+
+	//* Read from <fd> until <size> bytes came in or nothing did for a second
+	std::string read_all(int fd, size_t size) {
+		std::string out;
+		char buf[65536];
+		while (out.size() < size) {
+			pollfd pfd{fd, POLLIN, 0};
+			if (poll(&pfd, 1, 1000) <= 0) break;
+			const ssize_t n = read(fd, buf, sizeof(buf));
+			if (n <= 0) break;
+			out.append(buf, static_cast<size_t>(n));
+		}
+		return out;
+	}
+}
+
+TEST(writer, writes_what_was_submitted) {
+	pipe_fds p;
+	Term::Writer writer;
+	writer.start(p.fds[1]);
+
+	std::string frame = "first frame";
+	ASSERT_TRUE(writer.reserve());
+	writer.submit(frame);
+	EXPECT_TRUE(frame.empty());
+	EXPECT_TRUE(writer.drain(1000));
+	EXPECT_EQ(read_all(p.fds[0], 11), "first frame");
+
+	const auto counters = writer.get_counters();
+	EXPECT_EQ(counters.writes, 1u);
+	EXPECT_EQ(counters.bytes, 11u);
+	EXPECT_EQ(counters.dropped, 0u);
+}
+
+TEST(writer, drops_and_coalesces_while_the_reader_is_slow) {
+	pipe_fds p;
+	ASSERT_EQ(fcntl(p.fds[1], F_SETFL, fcntl(p.fds[1], F_GETFL) | O_NONBLOCK), 0);
+	int catch_ups = 0;
+	Term::Writer writer;
+	writer.start(p.fds[1], [&](std::string& out) {
+		++catch_ups;
+		out = "changes of the dropped frames";
+	});
+
+	//? More than the pipe holds, the writer waits for the reader
+	std::string frame(1 << 20, 'x');
+	ASSERT_TRUE(writer.reserve());
+	writer.submit(frame);
+	EXPECT_FALSE(writer.reserve());
+	EXPECT_FALSE(writer.reserve());
+
+	const auto got = read_all(p.fds[0], (1 << 20) + 29);
+	EXPECT_TRUE(writer.drain(1000));
+	EXPECT_EQ(got, std::string(1 << 20, 'x') + "changes of the dropped frames");
+	EXPECT_EQ(catch_ups, 1);
+
+	const auto counters = writer.get_counters();
+	EXPECT_EQ(counters.writes, 2u);
+	EXPECT_EQ(counters.dropped, 2u);
+	EXPECT_EQ(counters.coalesced, 1u);
+	EXPECT_GT(counters.stalls, 0u);
+	EXPECT_TRUE(writer.reserve());
+}